@@ -0,0 +1,70 @@
+/* Generated from ../../include/ldap_dirs.h.in on 2026-10-18 10:32:00+00:00 */
+/* $ReOpenLDAP$ */
+/* Copyright 1992-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/*
+ * This file works in conjunction with ReOpenLDAP configure system.
+ * If you do no like the values below, adjust your configure options.
+ */
+
+#ifndef _LDAP_DIRS_H
+#define _LDAP_DIRS_H
+
+/* directory separator */
+#ifndef LDAP_DIRSEP
+#define LDAP_DIRSEP "/"
+#endif
+
+/* directory for temporary files */
+#if defined(_P_tmpdir)
+#define LDAP_TMPDIR _P_tmpdir
+#elif defined(P_tmpdir)
+#define LDAP_TMPDIR P_tmpdir
+#elif defined(_PATH_TMPDIR)
+#define LDAP_TMPDIR _PATH_TMPDIR
+#else
+#define LDAP_TMPDIR LDAP_DIRSEP "tmp"
+#endif
+
+/* directories */
+#ifndef LDAP_BINDIR
+#define LDAP_BINDIR "/opt/reopenldap/bin"
+#endif
+#ifndef LDAP_SBINDIR
+#define LDAP_SBINDIR "/opt/reopenldap/sbin"
+#endif
+#ifndef LDAP_DATADIR
+#define LDAP_DATADIR "/opt/reopenldap/share"
+#endif
+#ifndef LDAP_SYSCONFDIR
+#define LDAP_SYSCONFDIR "/opt/reopenldap/etc"
+#endif
+/*#ifndef LDAP_LIBEXECDIR
+#	define LDAP_LIBEXECDIR	"/opt/reopenldap/libexec"
+#endif*/
+#ifndef LDAP_MODULEDIR
+#define LDAP_MODULEDIR "/opt/reopenldap/lib/reopenldap"
+#endif
+#ifndef LDAP_RUNDIR
+#define LDAP_RUNDIR "/opt/reopenldap/var/run"
+#endif
+#ifndef LDAP_LOCALEDIR
+#define LDAP_LOCALEDIR "/opt/reopenldap/share/locale"
+#endif
+#ifndef LDAP_VARDIR
+#define LDAP_VARDIR "/opt/reopenldap/var"
+#endif
+
+#endif /* _LDAP_DIRS_H */
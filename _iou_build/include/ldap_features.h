@@ -0,0 +1,42 @@
+/* include/ldap_features.h.  Generated from ldap_features.h.in by configure.  */
+/* $ReOpenLDAP$ */
+/* Copyright 1992-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/*
+ * LDAP Features
+ */
+
+#ifndef _LDAP_FEATURES_H
+#define _LDAP_FEATURES_H
+
+/* ReOpenLDAP API version macros */
+#define LDAP_VENDOR_VERSION 10200
+#define LDAP_VENDOR_VERSION_MAJOR 1
+#define LDAP_VENDOR_VERSION_MINOR 2
+#define LDAP_VENDOR_VERSION_PATCH 0
+
+/*
+ * The -lreldap implementation is basic thread safety,
+ * but also should be:
+ *	LDAP_API_FEATURE_SESSION_THREAD_SAFE
+ *	LDAP_API_FEATURE_OPERATION_THREAD_SAFE
+ */
+
+#define LDAP_API_FEATURE_X_OPENLDAP_THREAD_SAFE 1
+
+/* LDAP v2 Referrals */
+/* #undef LDAP_API_FEATURE_X_OPENLDAP_V2_REFERRALS */
+
+#endif /* LDAP_FEATURES */
@@ -0,0 +1,25 @@
+/* Copyright 1992-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+#include "reldap_autoconf.h"
+
+static __attribute__((unused,used)) const char lutil_Copyright[] =
+"The ReOpenLDAP Project <https://gitflic.ru/project/erthink/reopenldap/wiki>.\n"
+"Copyright 1992-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.\n"
+"All rights reserved. COPYING RESTRICTIONS APPLY.\n";
+
+static __attribute__((unused,used)) const char lutil_Version[] =
+"@(#) $ReOpenLDAP: liblutil 1.2.0-Devel" REOPENLDAP_BUILDID_SUFFIX " (" __DATE__ " " __TIME__ ") $\n"
+"\troot@vm:/root/repo/_iou_build/libraries/liblutil g27746a04de9b-t0feb97d6267250bd\n";
+
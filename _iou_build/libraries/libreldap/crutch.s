@@ -0,0 +1,1332 @@
+	.file	"crutch.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/_iou_build/libraries/libreldap" "../../../libraries/libreldap/crutch.c"
+	.section	.text.unlikely,"ax",@progbits
+	.weak	__ldap_assert_fail
+	.type	__ldap_assert_fail, @function
+__ldap_assert_fail:
+.LVL0:
+.LFB12:
+	.file 1 "../../../libraries/libreldap/crutch.c"
+	.loc 1 83 111 view -0
+	.cfi_startproc
+	.loc 1 84 3 view .LVU1
+	.loc 1 83 111 is_stmt 0 view .LVU2
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	.loc 1 84 3 view .LVU3
+	call	__assert_fail@PLT
+.LVL1:
+	.loc 1 84 3 view .LVU4
+	.cfi_endproc
+.LFE12:
+	.size	__ldap_assert_fail, .-__ldap_assert_fail
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"../../../libraries/libreldap/crutch.c"
+	.align 8
+.LC1:
+	.string	"source and destination MUST NOT overlap"
+	.section	.text.unlikely
+.LCOLDB2:
+	.section	.text.hot,"ax",@progbits
+.LHOTB2:
+	.p2align 4
+	.section	.text.unlikely
+.Ltext_cold0:
+	.section	.text.hot
+	.globl	ber_memcpy_safe
+	.type	ber_memcpy_safe, @function
+ber_memcpy_safe:
+.LVL2:
+.LFB11:
+	.loc 1 68 141 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 69 3 view .LVU6
+	.loc 1 71 3 view .LVU7
+	.loc 1 69 8 is_stmt 0 view .LVU8
+	movq	%rdi, %rcx
+	subq	%rsi, %rcx
+.LVL3:
+	.loc 1 71 39 view .LVU9
+	movq	%rcx, %rax
+	negq	%rax
+	cmovs	%rcx, %rax
+	.loc 1 71 6 view .LVU10
+	cmpq	%rdx, %rax
+	jb	.L11
+	.loc 1 79 3 is_stmt 1 view .LVU11
+	.loc 1 79 10 is_stmt 0 view .LVU12
+	jmp	memcpy@PLT
+.LVL4:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 72 5 is_stmt 1 view .LVU13
+	.loc 1 72 8 is_stmt 0 view .LVU14
+	cmpq	%rsi, %rdi
+	je	.L5
+	.loc 1 74 5 is_stmt 1 view .LVU15
+	.loc 1 74 8 is_stmt 0 view .LVU16
+	testb	$2, reopenldap_flags(%rip)
+	jne	.L7
+	.loc 1 76 5 is_stmt 1 view .LVU17
+	.loc 1 76 12 is_stmt 0 view .LVU18
+	jmp	memmove@PLT
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 1 80 1 view .LVU19
+	movq	%rdi, %rax
+	ret
+	.loc 1 80 1 view .LVU20
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	ber_memcpy_safe.cold, @function
+ber_memcpy_safe.cold:
+.LFSB11:
+.L7:
+	.loc 1 75 7 is_stmt 1 view -0
+	.loc 1 68 141 is_stmt 0 view .LVU22
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	.loc 1 75 7 view .LVU23
+	leaq	__FUNCTION__.0(%rip), %rcx
+.LVL6:
+	.loc 1 75 7 view .LVU24
+	movl	$75, %edx
+.LVL7:
+	.loc 1 75 7 view .LVU25
+	leaq	.LC0(%rip), %rsi
+.LVL8:
+	.loc 1 75 7 view .LVU26
+	leaq	.LC1(%rip), %rdi
+.LVL9:
+	.loc 1 75 7 view .LVU27
+	call	__ldap_assert_fail
+.LVL10:
+	.cfi_endproc
+.LFE11:
+	.section	.text.hot
+	.size	ber_memcpy_safe, .-ber_memcpy_safe
+	.section	.text.unlikely
+	.size	ber_memcpy_safe.cold, .-ber_memcpy_safe.cold
+.LCOLDE2:
+	.section	.text.hot
+.LHOTE2:
+	.section	.rodata
+	.align 16
+	.type	__FUNCTION__.0, @object
+	.size	__FUNCTION__.0, 16
+__FUNCTION__.0:
+	.string	"ber_memcpy_safe"
+	.text
+.Letext0:
+	.section	.text.unlikely
+.Letext_cold0:
+	.file 2 "../../../include/reldap.h"
+	.file 3 "/usr/include/string.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2af
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF23
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL9
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xc
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3d
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xe
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x5
+	.long	0x7e
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x2
+	.value	0x103
+	.byte	0x47
+	.long	0x44
+	.uleb128 0x6
+	.long	0x85
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x6
+	.long	0xa8
+	.uleb128 0x10
+	.uleb128 0x11
+	.long	.LASF13
+	.byte	0x2
+	.byte	0xf5
+	.byte	0x7
+	.long	0xca
+	.uleb128 0x3
+	.long	0x97
+	.uleb128 0x3
+	.long	0x97
+	.uleb128 0x3
+	.long	0x67
+	.uleb128 0x3
+	.long	0x97
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x2b
+	.long	0x7c
+	.long	0xe8
+	.uleb128 0x3
+	.long	0x7c
+	.uleb128 0x3
+	.long	0xa3
+	.uleb128 0x3
+	.long	0x31
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x2f
+	.long	0x7c
+	.long	0x106
+	.uleb128 0x3
+	.long	0x7c
+	.uleb128 0x3
+	.long	0xa3
+	.uleb128 0x3
+	.long	0x31
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x52
+	.byte	0x8d
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19b
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x52
+	.byte	0xac
+	.long	0x97
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x52
+	.byte	0xc3
+	.long	0x97
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x53
+	.byte	0x53
+	.long	0x67
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x53
+	.byte	0x65
+	.long	0x97
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.quad	.LVL1
+	.long	0xa9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x44
+	.byte	0x56
+	.long	0x7c
+	.long	.LLRL4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x292
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x44
+	.byte	0x6c
+	.long	0x7c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.string	"src"
+	.byte	0x44
+	.byte	0x7e
+	.long	0xa3
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x44
+	.byte	0x8a
+	.long	0x31
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x14
+	.long	.LASF22
+	.byte	0x1
+	.byte	0x45
+	.byte	0x8
+	.long	0x2a
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x15
+	.long	.LASF27
+	.long	0x2a2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__FUNCTION__.0
+	.uleb128 0xa
+	.quad	.LVL4
+	.long	0x2a7
+	.long	0x236
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL5
+	.long	0xe8
+	.long	0x256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL10
+	.long	0x106
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__FUNCTION__.0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x85
+	.long	0x2a2
+	.uleb128 0x17
+	.long	0x3d
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	0x292
+	.uleb128 0x18
+	.long	.LASF14
+	.long	.LASF28
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE12-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE12-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE12-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE12-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL2
+	.uleb128 .LHOTE2-.LVL2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x6
+	.quad	.LFSB11
+	.byte	0x4
+	.uleb128 .LFSB11-.LFSB11
+	.uleb128 .LVL9-.LFSB11
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.LFSB11
+	.uleb128 .LFE11-.LFSB11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL2
+	.uleb128 .LHOTE2-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x6
+	.quad	.LFSB11
+	.byte	0x4
+	.uleb128 .LFSB11-.LFSB11
+	.uleb128 .LVL8-.LFSB11
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.LFSB11
+	.uleb128 .LFE11-.LFSB11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL2
+	.uleb128 .LHOTE2-.LVL2
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x6
+	.quad	.LFSB11
+	.byte	0x4
+	.uleb128 .LFSB11-.LFSB11
+	.uleb128 .LVL7-.LFSB11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.LFSB11
+	.uleb128 .LFE11-.LFSB11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL2
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL5-1-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL2
+	.uleb128 .LHOTE2-.LVL2
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x6
+	.quad	.LFSB11
+	.byte	0x4
+	.uleb128 .LFSB11-.LFSB11
+	.uleb128 .LVL6-.LFSB11
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL6-.LFSB11
+	.uleb128 .LVL8-.LFSB11
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LFSB11
+	.uleb128 .LVL9-.LFSB11
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LFSB11
+	.uleb128 .LFE11-.LFSB11
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x4c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext_cold0
+	.quad	.Letext_cold0-.Ltext_cold0
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB11
+	.quad	.LHOTE2-.LFB11
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LHOTE2-.LFB11
+	.byte	0x7
+	.quad	.LFSB11
+	.uleb128 .LCOLDE2-.LFSB11
+	.byte	0
+.LLRL9:
+	.byte	0x7
+	.quad	.Ltext_cold0
+	.uleb128 .Letext_cold0-.Ltext_cold0
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LHOTE2-.LFB11
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF4:
+	.string	"long long int"
+.LASF15:
+	.string	"memmove"
+.LASF27:
+	.string	"__FUNCTION__"
+.LASF20:
+	.string	"dest"
+.LASF24:
+	.string	"size_t"
+.LASF13:
+	.string	"__assert_fail"
+.LASF18:
+	.string	"line"
+.LASF3:
+	.string	"long unsigned int"
+.LASF12:
+	.string	"long long unsigned int"
+.LASF21:
+	.string	"reopenldap_flags"
+.LASF14:
+	.string	"memcpy"
+.LASF25:
+	.string	"__ldap_assert_fail"
+.LASF6:
+	.string	"unsigned char"
+.LASF19:
+	.string	"function"
+.LASF11:
+	.string	"char"
+.LASF16:
+	.string	"assertion"
+.LASF17:
+	.string	"file"
+.LASF22:
+	.string	"diff"
+.LASF23:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O2 -fasynchronous-unwind-tables"
+.LASF2:
+	.string	"long int"
+.LASF7:
+	.string	"short unsigned int"
+.LASF28:
+	.string	"__builtin_memcpy"
+.LASF5:
+	.string	"long double"
+.LASF10:
+	.string	"short int"
+.LASF8:
+	.string	"unsigned int"
+.LASF26:
+	.string	"ber_memcpy_safe"
+.LASF9:
+	.string	"signed char"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"../../../libraries/libreldap/crutch.c"
+.LASF1:
+	.string	"/root/repo/_iou_build/libraries/libreldap"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
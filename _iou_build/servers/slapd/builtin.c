@@ -0,0 +1,59 @@
+/* This file is automatically generated by configure; please do not edit. */
+#include "reldap.h"
+#include "slap.h"
+/*-----------------------------------------*/
+extern BI_init config_back_initialize;
+extern BI_init ldif_back_initialize;
+extern BI_init monitor_back_initialize;
+extern BI_init mdb_back_initialize;
+BackendInfo slap_binfo[] = {
+	{ "config", config_back_initialize },
+	{ "ldif", ldif_back_initialize },
+	{ "monitor", monitor_back_initialize },
+	{ "mdb", mdb_back_initialize },
+	{ NULL, NULL }
+};
+/*-----------------------------------------*/
+extern OV_init accesslog_over_initialize;
+extern OV_init auditlog_over_initialize;
+extern OV_init collect_over_initialize;
+extern OV_init constraint_over_initialize;
+extern OV_init dds_over_initialize;
+extern OV_init deref_over_initialize;
+extern OV_init dyngroup_over_initialize;
+extern OV_init dynlist_over_initialize;
+extern OV_init memberof_over_initialize;
+extern OV_init ppolicy_over_initialize;
+extern OV_init pcache_over_initialize;
+extern OV_init refint_over_initialize;
+extern OV_init retcode_over_initialize;
+extern OV_init rwm_over_initialize;
+extern OV_init seqmod_over_initialize;
+extern OV_init sssvlv_over_initialize;
+extern OV_init syncprov_over_initialize;
+extern OV_init translucent_over_initialize;
+extern OV_init unique_over_initialize;
+extern OV_init valsort_over_initialize;
+OverlayInit slap_oinfo[] = {
+	{ "accesslog", accesslog_over_initialize },
+	{ "auditlog", auditlog_over_initialize },
+	{ "collect", collect_over_initialize },
+	{ "constraint", constraint_over_initialize },
+	{ "dds", dds_over_initialize },
+	{ "deref", deref_over_initialize },
+	{ "dyngroup", dyngroup_over_initialize },
+	{ "dynlist", dynlist_over_initialize },
+	{ "memberof", memberof_over_initialize },
+	{ "ppolicy", ppolicy_over_initialize },
+	{ "pcache", pcache_over_initialize },
+	{ "refint", refint_over_initialize },
+	{ "retcode", retcode_over_initialize },
+	{ "rwm", rwm_over_initialize },
+	{ "seqmod", seqmod_over_initialize },
+	{ "sssvlv", sssvlv_over_initialize },
+	{ "syncprov", syncprov_over_initialize },
+	{ "translucent", translucent_over_initialize },
+	{ "unique", unique_over_initialize },
+	{ "valsort", valsort_over_initialize },
+	{ NULL, NULL }
+};
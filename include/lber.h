@@ -104,6 +104,16 @@ LDAP_BEGIN_DECL
 #define LBER_OPT_MEMORY_INUSE 0x8005 /* for memory debugging */
 #define LBER_OPT_LOG_PROC 0x8006     /* for external logging function */
 
+/* get/set per-thread BerElement buffer pool options */
+#define LBER_OPT_BUFPOOL_MAX 0x8007   /* bytes retained per thread, 0 disables */
+#define LBER_OPT_BUFPOOL_STATS 0x8008 /* get only, struct lber_bufpool_stats */
+
+struct lber_bufpool_stats {
+  unsigned long bps_hits;     /* buffers served from a pool */
+  unsigned long bps_misses;   /* buffers allocated from the heap */
+  unsigned long bps_retained; /* bytes currently kept in pools */
+};
+
 typedef int *(*BER_ERRNO_FN)(void);
 
 typedef void (*BER_LOG_PRINT_FN)(const char *buf);
@@ -53,6 +53,12 @@ LBER_V(BER_LOG_PRINT_FN) ber_pvt_log_print;
 LBER_F(int)
 ber_pvt_log_printf(int errlvl, int loglvl, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
 
+/*
+ * io.c
+ */
+LBER_F(int)
+ber_pvt_ber_reserve(BerElement *ber, ber_len_t len);
+
 /*
  * sockbuf.c
  */
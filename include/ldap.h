@@ -153,6 +153,10 @@ LDAP_BEGIN_DECL
 #define LDAP_OPT_X_TLS_CERT 0x6017
 #define LDAP_OPT_X_TLS_KEY 0x6018
 #define LDAP_OPT_X_TLS_PEERKEY_HASH 0x6019
+#define LDAP_OPT_X_TLS_SESSION_CACHE 0x601a   /* server only */
+#define LDAP_OPT_X_TLS_SESSION_TIMEOUT 0x601b /* server only */
+#define LDAP_OPT_X_TLS_TICKET_ROTATE 0x601c   /* server only, OpenSSL only */
+#define LDAP_OPT_X_TLS_KTLS 0x601d            /* server only, OpenSSL only */
 
 #define LDAP_OPT_X_TLS_NEVER 0
 #define LDAP_OPT_X_TLS_HARD 1
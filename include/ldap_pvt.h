@@ -328,6 +328,19 @@ LDAP_F(int) ldap_pvt_tls_get_peercert(void *s, struct berval *der);
 LDAP_F(int)
 ldap_pvt_tls_check_hostname(struct ldap *ld, void *s, const char *name_in);
 
+/* server side session resumption counters of a TLS context */
+typedef struct ldap_pvt_tls_stats {
+  unsigned long ts_accepts;  /* completed server handshakes */
+  unsigned long ts_hits;     /* resumed sessions */
+  unsigned long ts_misses;   /* session IDs not found in the cache */
+  unsigned long ts_timeouts; /* expired sessions offered by clients */
+  unsigned long ts_cached;   /* sessions currently in the cache */
+  unsigned long ts_tickets;  /* session tickets issued */
+  unsigned long ts_ktls;     /* sessions handed over to kernel TLS */
+} ldap_pvt_tls_stats;
+
+LDAP_F(int) ldap_pvt_tls_get_stats(void *ctx, ldap_pvt_tls_stats *ts);
+
 LDAP_END_DECL
 
 /*
@@ -273,6 +273,21 @@ ldap_pvt_thread_pool_setkey(void *ctx, void *key, void *data, ldap_pvt_thread_po
 LDAP_F(void)
 ldap_pvt_thread_pool_purgekey(void *key);
 
+LDAP_F(void *)
+ldap_pvt_thread_pool_attach(ldap_pvt_thread_pool_t *pool);
+
+LDAP_F(void)
+ldap_pvt_thread_pool_detach(void *ctx);
+
+LDAP_F(int)
+ldap_pvt_thread_pool_enter(void *ctx);
+
+LDAP_F(void)
+ldap_pvt_thread_pool_leave(void *ctx);
+
+LDAP_F(unsigned long)
+ldap_pvt_thread_pool_waited(void *ctx);
+
 LDAP_F(void *)
 ldap_pvt_thread_pool_context(void);
 
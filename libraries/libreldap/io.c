@@ -35,6 +35,7 @@
 
 #include "lber-int.h"
 #include "ldap_log.h"
+#include "ldap_pvt_thread.h"
 
 ber_slen_t ber_skip_data(BerElement *ber, ber_len_t len) {
   ber_len_t actuallen, nleft;
@@ -100,10 +101,206 @@ ber_slen_t ber_write(BerElement *ber, const char *buf, ber_len_t len,
   return ((ber_slen_t)len);
 }
 
+/*
+ * Per-thread pool of heap BER buffers, kept in power-of-two size classes
+ * from 256 bytes to 64K, plus a few spare BerElements. Buffers which were
+ * taken from the pool are recognized by a non-zero ber_bufsize and are
+ * returned there by ber_free_buf() regardless of ber_memctx. The memory
+ * kept by each thread is bounded by ber_int_bufpool_max.
+ *
+ * A pool hangs off the thread's tpool context, which releases it when the
+ * thread goes away. Threads without a context of their own only share the
+ * main one and so do not pool.
+ */
+#define LBER_BUFPOOL_MINSHIFT 8
+#define LBER_BUFPOOL_CLASSES 9
+#define LBER_BUFPOOL_MAXSIZE ((ber_len_t)1 << (LBER_BUFPOOL_MINSHIFT + LBER_BUFPOOL_CLASSES - 1))
+#define LBER_BUFPOOL_ELEMENTS 16
+#define LBER_BUFPOOL_KEY ((void *)ber_bufpool_free)
+
+ber_len_t ber_int_bufpool_max = 256 * 1024;
+
+struct ber_bufpool {
+  void *bp_bufs[LBER_BUFPOOL_CLASSES];
+  BerElement *bp_elems; /* linked through ber_buf */
+  unsigned bp_nelems;
+  ber_len_t bp_retained;
+};
+
+static int ber_bufpool_running;
+static unsigned long ber_bufpool_hits, ber_bufpool_misses, ber_bufpool_retained;
+
+/* Context key destructor, releases whatever the thread kept */
+static void ber_bufpool_free(void *key, void *data) {
+  struct ber_bufpool *bp = data;
+  BerElement *ber;
+  void *buf;
+  int i;
+
+  for (i = 0; i < LBER_BUFPOOL_CLASSES; i++) {
+    while ((buf = bp->bp_bufs[i]) != NULL) {
+      ASAN_UNPOISON_MEMORY_REGION(buf, sizeof(void *));
+      bp->bp_bufs[i] = *(void **)buf;
+      ber_memfree_x(buf, NULL);
+    }
+  }
+  while ((ber = bp->bp_elems) != NULL) {
+    bp->bp_elems = (BerElement *)ber->ber_buf;
+    ber_memfree_x(ber, NULL);
+  }
+  __sync_fetch_and_sub(&ber_bufpool_retained, bp->bp_retained);
+  ber_memfree_x(bp, NULL);
+}
+
+/* The pool of the calling thread, NULL when it has none and may not
+ * get one, or create is not set */
+static struct ber_bufpool *ber_bufpool_get(int create) {
+  void *ctx, *data = NULL;
+
+  if (!ber_bufpool_running)
+    return NULL;
+  ctx = ldap_pvt_thread_pool_context();
+  if (ctx == NULL || !ldap_pvt_thread_equal(ldap_pvt_thread_pool_tid(ctx), ldap_pvt_thread_self()))
+    return NULL;
+  if (ldap_pvt_thread_pool_getkey(ctx, LBER_BUFPOOL_KEY, &data, NULL) == 0 || !create)
+    return data;
+
+  data = ber_memcalloc_x(1, sizeof(struct ber_bufpool), NULL);
+  if (data != NULL && ldap_pvt_thread_pool_setkey(ctx, LBER_BUFPOOL_KEY, data, ber_bufpool_free, NULL, NULL) != 0) {
+    ber_memfree_x(data, NULL);
+    data = NULL;
+  }
+  return data;
+}
+
+/* Called by ldap_pvt_thread_initialize(), once thread contexts exist */
+void ber_int_bufpool_startup(void) { ber_bufpool_running = 1; }
+
+/* Called by ldap_pvt_thread_destroy(), releases the pool of the main thread */
+void ber_int_bufpool_shutdown(void) {
+  struct ber_bufpool *bp = ber_bufpool_get(0);
+
+  if (bp != NULL) {
+    ldap_pvt_thread_pool_setkey(ldap_pvt_thread_pool_context(), LBER_BUFPOOL_KEY, NULL, NULL, NULL, NULL);
+    ber_bufpool_free(LBER_BUFPOOL_KEY, bp);
+  }
+  ber_bufpool_running = 0;
+}
+
+static int ber_bufpool_class(ber_len_t size) {
+  ber_len_t csize = (ber_len_t)1 << LBER_BUFPOOL_MINSHIFT;
+  int i;
+
+  for (i = 0; csize < size; i++)
+    csize <<= 1;
+  return i;
+}
+
+/* Allocate a buffer of at least *sizep bytes for ber, from the pool
+ * when possible. *sizep is rounded up to the size class. */
+static char *ber_int_buf_alloc(BerElement *ber, ber_len_t *sizep) {
+  struct ber_bufpool *bp;
+  char *buf;
+  int i;
+
+  ber->ber_bufsize = 0;
+  if (ber->ber_memctx != NULL || *sizep > LBER_BUFPOOL_MAXSIZE || ber_int_bufpool_max == 0)
+    return ber_memalloc_x(*sizep, ber->ber_memctx);
+
+  i = ber_bufpool_class(*sizep);
+  *sizep = (ber_len_t)1 << (LBER_BUFPOOL_MINSHIFT + i);
+  bp = ber_bufpool_get(0);
+  buf = bp != NULL ? bp->bp_bufs[i] : NULL;
+  if (buf != NULL) {
+    ASAN_UNPOISON_MEMORY_REGION(buf, *sizep);
+    bp->bp_bufs[i] = *(void **)buf;
+    bp->bp_retained -= *sizep;
+    __sync_fetch_and_sub(&ber_bufpool_retained, *sizep);
+    __sync_fetch_and_add(&ber_bufpool_hits, 1);
+  } else {
+    buf = ber_memalloc_x(*sizep, NULL);
+    if (buf == NULL)
+      return NULL;
+    __sync_fetch_and_add(&ber_bufpool_misses, 1);
+  }
+  ber->ber_bufsize = *sizep;
+  return buf;
+}
+
+/* Return a buffer obtained by ber_int_buf_alloc() */
+static void ber_int_buf_release(char *buf, ber_len_t size) {
+  struct ber_bufpool *bp = ber_bufpool_get(1);
+  int i;
+
+  if (bp == NULL || bp->bp_retained + size > ber_int_bufpool_max) {
+    ber_memfree_x(buf, NULL);
+    return;
+  }
+
+  i = ber_bufpool_class(size);
+  assert(size == (ber_len_t)1 << (LBER_BUFPOOL_MINSHIFT + i));
+  *(void **)buf = bp->bp_bufs[i];
+  ASAN_POISON_MEMORY_REGION(buf, size);
+  bp->bp_bufs[i] = buf;
+  bp->bp_retained += size;
+  __sync_fetch_and_add(&ber_bufpool_retained, size);
+}
+
+void ber_int_bufpool_stats(struct lber_bufpool_stats *stats) {
+  stats->bps_hits = ber_bufpool_hits;
+  stats->bps_misses = ber_bufpool_misses;
+  stats->bps_retained = ber_bufpool_retained;
+}
+
+/* Make the buffer at least total bytes long, keeping its contents */
+static int ber_int_resize(BerElement *ber, ber_len_t total) {
+  ber_len_t offset, sos_offset, rw_offset, oldsize;
+  char *buf;
+
+  buf = ber->ber_buf;
+  if (ber->ber_bufsize >= total) {
+    /* the pooled buffer already has room, e.g. after ber_reset() */
+    ber->ber_end = buf + ber->ber_bufsize;
+    return (0);
+  }
+
+  offset = ber->ber_ptr - buf;
+  sos_offset = ber->ber_sos_ptr ? ber->ber_sos_ptr - buf : 0;
+  /* if ber_sos_ptr != NULL, it is > ber_buf so that sos_offset > 0 */
+  rw_offset = ber->ber_rwptr ? ber->ber_rwptr - buf : 0;
+
+  oldsize = ber->ber_bufsize;
+  if (buf == NULL || oldsize != 0) {
+    buf = ber_int_buf_alloc(ber, &total);
+    if (buf == NULL) {
+      ber->ber_bufsize = oldsize;
+      return (-1);
+    }
+    if (ber->ber_buf != NULL) {
+      memcpy(buf, ber->ber_buf, ber_pvt_ber_total(ber));
+      ber_int_buf_release(ber->ber_buf, oldsize);
+    }
+  } else {
+    buf = (char *)ber_memrealloc_x(buf, total, ber->ber_memctx);
+    if (buf == NULL) {
+      return (-1);
+    }
+  }
+
+  ber->ber_buf = buf;
+  ber->ber_end = buf + total;
+  ber->ber_ptr = buf + offset;
+  if (sos_offset)
+    ber->ber_sos_ptr = buf + sos_offset;
+  if (ber->ber_rwptr)
+    ber->ber_rwptr = buf + rw_offset;
+
+  return (0);
+}
+
 /* Resize the ber buffer */
 int ber_realloc(BerElement *ber, ber_len_t len) {
-  ber_len_t total, offset, sos_offset, rw_offset;
-  char *buf;
+  ber_len_t total;
 
   assert(ber != NULL);
   assert(LBER_VALID(ber));
@@ -135,43 +332,61 @@ int ber_realloc(BerElement *ber, ber_len_t len) {
     return (-1);
   }
 
-  buf = ber->ber_buf;
-  offset = ber->ber_ptr - buf;
-  sos_offset = ber->ber_sos_ptr ? ber->ber_sos_ptr - buf : 0;
-  /* if ber_sos_ptr != NULL, it is > ber_buf so that sos_offset > 0 */
-  rw_offset = ber->ber_rwptr ? ber->ber_rwptr - buf : 0;
+  return ber_int_resize(ber, total);
+}
 
-  buf = (char *)ber_memrealloc_x(buf, total, ber->ber_memctx);
-  if (buf == NULL) {
-    return (-1);
+/* Make room for at least len more bytes to be written, e.g. when the
+ * size of an encoding is known in advance. Unlike ber_realloc() the
+ * buffer is not grown by more than requested. */
+int ber_pvt_ber_reserve(BerElement *ber, ber_len_t len) {
+  ber_len_t total;
+  char *p;
+
+  assert(ber != NULL);
+  assert(LBER_VALID(ber));
+
+  p = ber->ber_sos_ptr == NULL ? ber->ber_ptr : ber->ber_sos_ptr;
+  if (ber->ber_buf != NULL && len < (ber_len_t)(ber->ber_end - p)) {
+    return (0);
   }
 
-  ber->ber_buf = buf;
-  ber->ber_end = buf + total;
-  ber->ber_ptr = buf + offset;
-  if (sos_offset)
-    ber->ber_sos_ptr = buf + sos_offset;
-  if (ber->ber_rwptr)
-    ber->ber_rwptr = buf + rw_offset;
+  total = (p - ber->ber_buf) + len + 1;
+  if (total <= len || total > (ber_len_t)-1 / 2 /* max ber_slen_t */) {
+    return (-1);
+  }
 
-  return (0);
+  return ber_int_resize(ber, total);
 }
 
 void ber_free_buf(BerElement *ber) {
   assert(LBER_VALID(ber));
 
-  if (ber->ber_buf)
-    ber_memfree_x(ber->ber_buf, ber->ber_memctx);
+  if (ber->ber_buf) {
+    if (ber->ber_bufsize)
+      ber_int_buf_release(ber->ber_buf, ber->ber_bufsize);
+    else
+      ber_memfree_x(ber->ber_buf, ber->ber_memctx);
+  }
 
   ber->ber_buf = NULL;
+  ber->ber_bufsize = 0;
   ber->ber_sos_ptr = NULL;
   ber->ber_valid = LBER_UNINITIALIZED;
 }
 
 void ber_free(BerElement *ber, int freebuf) {
   if (likely(ber != NULL)) {
+    struct ber_bufpool *bp;
+
     if (freebuf)
       ber_free_buf(ber);
+    if (ber->ber_memctx == NULL && ber_int_bufpool_max != 0 && (bp = ber_bufpool_get(1)) != NULL &&
+        bp->bp_nelems < LBER_BUFPOOL_ELEMENTS) {
+      ber->ber_buf = (char *)bp->bp_elems;
+      bp->bp_elems = ber;
+      bp->bp_nelems++;
+      return;
+    }
     ber_memfree_x((char *)ber, ber->ber_memctx);
   }
 }
@@ -219,12 +434,18 @@ int ber_flush2(Sockbuf *sb, BerElement *ber, int freeit) {
 }
 
 BerElement *ber_alloc_t(int options) {
+  struct ber_bufpool *bp = ber_bufpool_get(0);
   BerElement *ber;
 
-  ber = (BerElement *)LBER_CALLOC(1, sizeof(BerElement));
-
-  if (ber == NULL) {
-    return NULL;
+  if (bp != NULL && (ber = bp->bp_elems) != NULL) {
+    bp->bp_elems = (BerElement *)ber->ber_buf;
+    bp->bp_nelems--;
+    memset(ber, 0, sizeof(BerElement));
+  } else {
+    ber = (BerElement *)LBER_CALLOC(1, sizeof(BerElement));
+    if (ber == NULL) {
+      return NULL;
+    }
   }
 
   ber->ber_valid = LBER_VALID_BERELEMENT;
@@ -545,7 +766,8 @@ ber_tag_t ber_get_next(Sockbuf *sb, ber_len_t *len, BerElement *ber) {
         sock_errset(ERANGE);
         return LBER_DEFAULT;
       }
-      ber->ber_buf = (char *)ber_memalloc_x(ber->ber_len + 1, ber->ber_memctx);
+      ber_len_t size = ber->ber_len + 1;
+      ber->ber_buf = ber_int_buf_alloc(ber, &size);
       if (ber->ber_buf == NULL) {
         return LBER_DEFAULT;
       }
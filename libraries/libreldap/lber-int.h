@@ -94,6 +94,7 @@ struct berelement {
 
   char *ber_rwptr;
   void *ber_memctx;
+  ber_len_t ber_bufsize; /* size class of a pooled ber_buf, otherwise 0 */
 };
 #define LBER_VALID(ber) ((ber)->ber_valid == LBER_VALID_BERELEMENT)
 
@@ -132,6 +133,11 @@ struct sockbuf {
 LBER_F(int)
 ber_realloc(BerElement *ber, ber_len_t len);
 
+LBER_V(ber_len_t) ber_int_bufpool_max;
+LBER_F(void) ber_int_bufpool_stats(struct lber_bufpool_stats *stats);
+LBER_F(void) ber_int_bufpool_startup(void);
+LBER_F(void) ber_int_bufpool_shutdown(void);
+
 LBER_F(char *) ber_start(BerElement *);
 LBER_F(int) ber_len(BerElement *);
 LBER_F(int) ber_ptrlen(BerElement *);
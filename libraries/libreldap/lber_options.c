@@ -63,6 +63,14 @@ int ber_get_option(void *item, int option, void *outvalue) {
     case LBER_OPT_LOG_PRINT_FILE:
       *((FILE **)outvalue) = (FILE *)ber_pvt_err_file;
       return LBER_OPT_SUCCESS;
+
+    case LBER_OPT_BUFPOOL_MAX:
+      *((ber_len_t *)outvalue) = ber_int_bufpool_max;
+      return LBER_OPT_SUCCESS;
+
+    case LBER_OPT_BUFPOOL_STATS:
+      ber_int_bufpool_stats((struct lber_bufpool_stats *)outvalue);
+      return LBER_OPT_SUCCESS;
     }
 
     ber_errno = LBER_ERROR_PARAM;
@@ -163,6 +171,10 @@ int ber_set_option(void *item, int option, const void *invalue) {
     case LBER_OPT_LOG_PROC:
       ber_int_log_proc = (BER_LOG_FN)invalue;
       return LBER_OPT_SUCCESS;
+
+    case LBER_OPT_BUFPOOL_MAX:
+      ber_int_bufpool_max = *(const ber_len_t *)invalue;
+      return LBER_OPT_SUCCESS;
     }
 
     ber_errno = LBER_ERROR_PARAM;
@@ -112,6 +112,10 @@ struct ldaptls {
   char *lt_randfile; /* OpenSSL only */
   char *lt_ecname;   /* OpenSSL only */
   int lt_protocol_min;
+  int lt_session_cache;   /* server session cache entries, 0 = default */
+  int lt_session_timeout; /* server session lifetime in seconds, 0 = default */
+  int lt_ticket_rotate;   /* ticket key rotation period, 0 = library keys */
+  int lt_ktls;            /* kernel TLS offload of established sessions */
   struct berval lt_cacert;
   struct berval lt_cert;
   struct berval lt_key;
@@ -204,6 +208,10 @@ struct ldapoptions {
 #define ldo_tls_cacertdir ldo_tls_info.lt_cacertdir
 #define ldo_tls_ciphersuite ldo_tls_info.lt_ciphersuite
 #define ldo_tls_protocol_min ldo_tls_info.lt_protocol_min
+#define ldo_tls_session_cache ldo_tls_info.lt_session_cache
+#define ldo_tls_session_timeout ldo_tls_info.lt_session_timeout
+#define ldo_tls_ticket_rotate ldo_tls_info.lt_ticket_rotate
+#define ldo_tls_ktls ldo_tls_info.lt_ktls
 #define ldo_tls_crlfile ldo_tls_info.lt_crlfile
 #define ldo_tls_randfile ldo_tls_info.lt_randfile
 #define ldo_tls_cacert ldo_tls_info.lt_cacert
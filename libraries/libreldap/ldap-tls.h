@@ -31,6 +31,7 @@ typedef tls_ctx *(TI_ctx_new)(struct ldapoptions *lo);
 typedef void(TI_ctx_ref)(tls_ctx *ctx);
 typedef void(TI_ctx_free)(tls_ctx *ctx);
 typedef int(TI_ctx_init)(struct ldapoptions *lo, struct ldaptls *lt, int is_server);
+typedef int(TI_ctx_stats)(tls_ctx *ctx, ldap_pvt_tls_stats *ts);
 
 typedef tls_session *(TI_session_new)(tls_ctx *ctx, int is_server);
 typedef int(TI_session_connect)(LDAP *ld, tls_session *s);
@@ -58,6 +59,7 @@ typedef struct tls_impl {
   TI_ctx_ref *ti_ctx_ref;
   TI_ctx_free *ti_ctx_free;
   TI_ctx_init *ti_ctx_init;
+  TI_ctx_stats *ti_ctx_stats; /* optional */
 
   TI_session_new *ti_session_new;
   TI_session_connect *ti_session_connect;
@@ -133,6 +133,16 @@ int ldap_pvt_thread_pool_setkey(void *ctx, void *key, void *data, ldap_pvt_threa
 
 void ldap_pvt_thread_pool_purgekey(void *key) {}
 
+void *ldap_pvt_thread_pool_attach(ldap_pvt_thread_pool_t *tpool) { return (NULL); }
+
+void ldap_pvt_thread_pool_detach(void *vctx) {}
+
+int ldap_pvt_thread_pool_enter(void *vctx) { return (-1); }
+
+void ldap_pvt_thread_pool_leave(void *vctx) {}
+
+unsigned long ldap_pvt_thread_pool_waited(void *vctx) { return (0); }
+
 int ldap_pvt_thread_pool_pause(ldap_pvt_thread_pool_t *tpool) { return (0); }
 
 int ldap_pvt_thread_pool_resume(ldap_pvt_thread_pool_t *tpool) { return (0); }
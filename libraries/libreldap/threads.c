@@ -23,6 +23,7 @@
 #include <ac/unistd.h>
 
 #include "ldap_pvt_thread.h" /* Get the thread interface */
+#include "lber-int.h"
 
 /*
  * Common LDAP thread routines
@@ -49,12 +50,15 @@ int ldap_pvt_thread_initialize(void) {
     return rc;
 #endif
 
+  ber_int_bufpool_startup();
+
   /* kludge to pull symbol definitions in */
   ldap_pvt_thread_self();
   return 0;
 }
 
 int ldap_pvt_thread_destroy(void) {
+  ber_int_bufpool_shutdown();
 #ifndef LDAP_THREAD_HAVE_TPOOL
   (void)ldap_int_thread_pool_shutdown();
 #endif
@@ -512,6 +512,28 @@ int ldap_pvt_tls_config(LDAP *ld, int option, const char *arg) {
     }
     return ldap_pvt_tls_set_option(ld, option, &i);
   }
+  case LDAP_OPT_X_TLS_SESSION_CACHE:
+  case LDAP_OPT_X_TLS_SESSION_TIMEOUT:
+  case LDAP_OPT_X_TLS_TICKET_ROTATE: {
+    char *next;
+    long l;
+    l = strtol(arg, &next, 10);
+    if (l < 0 || l > INT_MAX || next == arg || *next != '\0')
+      return -1;
+    i = l;
+    return ldap_pvt_tls_set_option(ld, option, &i);
+  }
+  case LDAP_OPT_X_TLS_KTLS:
+    i = -1;
+    if ((strcasecmp(arg, "on") == 0) || (strcasecmp(arg, "yes") == 0) || (strcasecmp(arg, "true") == 0)) {
+      i = 1;
+    } else if ((strcasecmp(arg, "off") == 0) || (strcasecmp(arg, "no") == 0) || (strcasecmp(arg, "false") == 0)) {
+      i = 0;
+    }
+    if (i >= 0) {
+      return ldap_pvt_tls_set_option(ld, option, &i);
+    }
+    return -1;
 #if RELDAP_TLS == RELDAP_TLS_OPENSSL && defined(HAVE_OPENSSL_CRL)
   case LDAP_OPT_X_TLS_CRLCHECK: /* OpenSSL only */
     i = -1;
@@ -601,6 +623,18 @@ int ldap_pvt_tls_get_option(LDAP *ld, int option, void *arg) {
   case LDAP_OPT_X_TLS_PROTOCOL_MIN:
     *(int *)arg = lo->ldo_tls_protocol_min;
     break;
+  case LDAP_OPT_X_TLS_SESSION_CACHE:
+    *(int *)arg = lo->ldo_tls_session_cache;
+    break;
+  case LDAP_OPT_X_TLS_SESSION_TIMEOUT:
+    *(int *)arg = lo->ldo_tls_session_timeout;
+    break;
+  case LDAP_OPT_X_TLS_TICKET_ROTATE:
+    *(int *)arg = lo->ldo_tls_ticket_rotate;
+    break;
+  case LDAP_OPT_X_TLS_KTLS:
+    *(int *)arg = lo->ldo_tls_ktls;
+    break;
   case LDAP_OPT_X_TLS_RANDOM_FILE:
     *(char **)arg = lo->ldo_tls_randfile ? LDAP_STRDUP(lo->ldo_tls_randfile) : NULL;
     break;
@@ -826,6 +860,26 @@ int ldap_pvt_tls_set_option(LDAP *ld, int option, void *arg) {
       return -1;
     lo->ldo_tls_protocol_min = *(int *)arg;
     return 0;
+  case LDAP_OPT_X_TLS_SESSION_CACHE:
+    if (!arg || *(int *)arg < 0)
+      return -1;
+    lo->ldo_tls_session_cache = *(int *)arg;
+    return 0;
+  case LDAP_OPT_X_TLS_SESSION_TIMEOUT:
+    if (!arg || *(int *)arg < 0)
+      return -1;
+    lo->ldo_tls_session_timeout = *(int *)arg;
+    return 0;
+  case LDAP_OPT_X_TLS_TICKET_ROTATE:
+    if (!arg || *(int *)arg < 0)
+      return -1;
+    lo->ldo_tls_ticket_rotate = *(int *)arg;
+    return 0;
+  case LDAP_OPT_X_TLS_KTLS:
+    if (!arg)
+      return -1;
+    lo->ldo_tls_ktls = *(int *)arg != 0;
+    return 0;
   case LDAP_OPT_X_TLS_RANDOM_FILE:
     if (ld != NULL)
       return -1;
@@ -1103,6 +1157,15 @@ int ldap_pvt_tls_get_peercert(void *s, struct berval *der) {
   tls_session *session = s;
   return tls_imp->ti_session_peercert(session, der);
 }
+
+int ldap_pvt_tls_get_stats(void *c, ldap_pvt_tls_stats *ts) {
+  tls_ctx *ctx = c;
+
+  memset(ts, 0, sizeof(*ts));
+  if (!ctx || !tls_imp->ti_ctx_stats)
+    return -1;
+  return tls_imp->ti_ctx_stats(ctx, ts);
+}
 #endif /* WITH_TLS */
 
 int ldap_start_tls(LDAP *ld, LDAPControl **serverctrls, LDAPControl **clientctrls, int *msgidp) {
@@ -991,6 +991,7 @@ tls_impl ldap_int_tls_impl = {"GnuTLS",
                               tlsg_ctx_ref,
                               tlsg_ctx_free,
                               tlsg_ctx_init,
+                              NULL, /* ctx_stats */
 
                               tlsg_session_new,
                               tlsg_session_connect,
@@ -3445,6 +3445,7 @@ tls_impl ldap_int_tls_impl = {"MozNSS",
                               tlsm_ctx_ref,
                               tlsm_ctx_free,
                               tlsm_ctx_init,
+                              NULL, /* ctx_stats */
 
                               tlsm_session_new,
                               tlsm_session_connect,
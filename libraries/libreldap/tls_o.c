@@ -45,6 +45,10 @@
 #include <openssl/bn.h>
 #include <openssl/rsa.h>
 #include <openssl/dh.h>
+#include <openssl/hmac.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+#include <openssl/core_names.h>
+#endif
 #elif defined(HAVE_SSL_H)
 #include <ssl.h>
 #endif
@@ -100,6 +104,24 @@ static unsigned long tlso_thread_self(void) {
 static ldap_pvt_thread_mutex_t tlso_mutex;
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
 
+/*
+ * Session ticket keys, shared by all server contexts and listener threads.
+ * The current key encrypts new tickets, the previous one is still accepted
+ * for decryption (with renewal) during one more rotation period.
+ */
+typedef struct tlso_ticket_key {
+  unsigned char tk_name[16];
+  unsigned char tk_aes[32];
+  unsigned char tk_hmac[32];
+  time_t tk_born;
+} tlso_ticket_key;
+
+static ldap_pvt_thread_mutex_t tlso_ticket_mutex;
+static tlso_ticket_key tlso_ticket_keys[2];
+static int tlso_ticket_rotate;
+static unsigned long tlso_tickets_issued;
+static unsigned long tlso_ktls_sessions; /* also under tlso_ticket_mutex */
+
 static void tlso_thr_init(void) {
 #if OPENSSL_VERSION_NUMBER < 0x10100000L || defined(LIBRESSL_VERSION_NUMBER)
   int i;
@@ -110,6 +132,7 @@ static void tlso_thr_init(void) {
 #else
   ldap_pvt_thread_mutex_init(&tlso_mutex);
 #endif
+  ldap_pvt_thread_mutex_init(&tlso_ticket_mutex);
   /* OpenSSL 1.1.x don't used locking callback
    * and corresponding defines are no-ops.
    * Keep the subsequent lines for error detection. */
@@ -166,6 +189,107 @@ static void tlso_ctx_free(tls_ctx *ctx) {
   SSL_CTX_free(c);
 }
 
+/*
+ * Pick the ticket key for encryption or look it up by name for decryption,
+ * rotating keys which became older than the configured period.
+ * Returns 1 for the current key, 2 for the previous one (ticket should be
+ * renewed), 0 if the key is unknown and -1 on failure.
+ */
+static int tlso_ticket_key_get(unsigned char *name, tlso_ticket_key *key, int enc) {
+  tlso_ticket_key *tk = tlso_ticket_keys;
+  time_t now = ldap_time_steady();
+  int rc = 0;
+
+  ldap_pvt_thread_mutex_lock(&tlso_ticket_mutex);
+  if (!tk[0].tk_born || now - tk[0].tk_born >= tlso_ticket_rotate) {
+    if (tk[0].tk_born && now - tk[0].tk_born < 2 * tlso_ticket_rotate)
+      tk[1] = tk[0];
+    else
+      memset(&tk[1], 0, sizeof(tk[1]));
+    if (RAND_bytes(tk[0].tk_name, sizeof(tk[0].tk_name)) <= 0 || RAND_bytes(tk[0].tk_aes, sizeof(tk[0].tk_aes)) <= 0 ||
+        RAND_bytes(tk[0].tk_hmac, sizeof(tk[0].tk_hmac)) <= 0) {
+      memset(tk, 0, sizeof(tlso_ticket_keys));
+      rc = -1;
+      goto done;
+    }
+    tk[0].tk_born = now;
+  }
+
+  if (enc) {
+    memcpy(name, tk[0].tk_name, sizeof(tk[0].tk_name));
+    *key = tk[0];
+    tlso_tickets_issued++;
+    rc = 1;
+  } else if (memcmp(name, tk[0].tk_name, sizeof(tk[0].tk_name)) == 0) {
+    *key = tk[0];
+    rc = 1;
+  } else if (tk[1].tk_born && memcmp(name, tk[1].tk_name, sizeof(tk[1].tk_name)) == 0) {
+    *key = tk[1];
+    rc = 2;
+  }
+
+done:
+  ldap_pvt_thread_mutex_unlock(&tlso_ticket_mutex);
+  return rc;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+static int tlso_ticket_cb(SSL *ssl, unsigned char *name, unsigned char *iv, EVP_CIPHER_CTX *ectx, EVP_MAC_CTX *hctx,
+                          int enc) {
+  tlso_ticket_key key;
+  OSSL_PARAM params[3];
+  int rc;
+
+  if (enc && RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) <= 0)
+    return -1;
+  rc = tlso_ticket_key_get(name, &key, enc);
+  if (rc <= 0)
+    return rc;
+
+  params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.tk_hmac, sizeof(key.tk_hmac));
+  params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, "SHA256", 0);
+  params[2] = OSSL_PARAM_construct_end();
+  if (!EVP_MAC_CTX_set_params(hctx, params) ||
+      !EVP_CipherInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.tk_aes, iv, enc))
+    rc = -1;
+  OPENSSL_cleanse(&key, sizeof(key));
+  return rc;
+}
+#else
+static int tlso_ticket_cb(SSL *ssl, unsigned char *name, unsigned char *iv, EVP_CIPHER_CTX *ectx, HMAC_CTX *hctx,
+                          int enc) {
+  tlso_ticket_key key;
+  int rc;
+
+  if (enc && RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) <= 0)
+    return -1;
+  rc = tlso_ticket_key_get(name, &key, enc);
+  if (rc <= 0)
+    return rc;
+
+  if (!HMAC_Init_ex(hctx, key.tk_hmac, sizeof(key.tk_hmac), EVP_sha256(), NULL) ||
+      !EVP_CipherInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.tk_aes, iv, enc))
+    rc = -1;
+  OPENSSL_cleanse(&key, sizeof(key));
+  return rc;
+}
+#endif
+
+static int tlso_ctx_stats(tls_ctx *ctx, ldap_pvt_tls_stats *ts) {
+  tlso_ctx *c = (tlso_ctx *)ctx;
+
+  ts->ts_accepts = SSL_CTX_sess_accept_good(c);
+  ts->ts_hits = SSL_CTX_sess_hits(c);
+  ts->ts_misses = SSL_CTX_sess_misses(c);
+  ts->ts_timeouts = SSL_CTX_sess_timeouts(c);
+  ts->ts_cached = SSL_CTX_sess_number(c);
+  ldap_pvt_thread_mutex_lock(&tlso_ticket_mutex);
+  ts->ts_tickets = tlso_tickets_issued;
+  ts->ts_ktls = tlso_ktls_sessions;
+  ldap_pvt_thread_mutex_unlock(&tlso_ticket_mutex);
+  return 0;
+}
+
 /*
  * initialize a new TLS context
  */
@@ -175,6 +299,29 @@ static int tlso_ctx_init(struct ldapoptions *lo, struct ldaptls *lt, int is_serv
 
   if (is_server) {
     SSL_CTX_set_session_id_context(ctx, (const unsigned char *)"ReOpenLDAP", sizeof("ReOpenLDAP") - 1);
+    if (lt->lt_session_cache)
+      SSL_CTX_sess_set_cache_size(ctx, lt->lt_session_cache);
+    if (lt->lt_session_timeout)
+      SSL_CTX_set_timeout(ctx, lt->lt_session_timeout);
+    if (lt->lt_ticket_rotate) {
+      ldap_pvt_thread_mutex_lock(&tlso_ticket_mutex);
+      tlso_ticket_rotate = lt->lt_ticket_rotate;
+      ldap_pvt_thread_mutex_unlock(&tlso_ticket_mutex);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+      SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, tlso_ticket_cb);
+#else
+      SSL_CTX_set_tlsext_ticket_key_cb(ctx, tlso_ticket_cb);
+#endif
+    }
+#ifdef SSL_OP_ENABLE_KTLS
+    /* The kernel is asked to take over the record layer once the handshake
+     * is done; OpenSSL silently keeps it in user space when the cipher or
+     * the kernel (no "tls" ULP) doesn't support that. */
+    if (lt->lt_ktls)
+      SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+    else
+      SSL_CTX_clear_options(ctx, SSL_OP_ENABLE_KTLS);
+#endif
   }
 
 #ifdef SSL_OP_NO_TLSv1
@@ -373,9 +520,18 @@ static int tlso_session_connect(LDAP *ld, tls_session *sess) {
 
 static int tlso_session_accept(tls_session *sess) {
   tlso_session *s = (tlso_session *)sess;
+  int rc;
 
   /* Caller expects 0 = success, OpenSSL returns 1 = success */
-  return SSL_accept(s) - 1;
+  rc = SSL_accept(s) - 1;
+#ifdef SSL_OP_ENABLE_KTLS
+  if (rc == 0 && BIO_get_ktls_send(SSL_get_wbio(s))) {
+    ldap_pvt_thread_mutex_lock(&tlso_ticket_mutex);
+    tlso_ktls_sessions++;
+    ldap_pvt_thread_mutex_unlock(&tlso_ticket_mutex);
+  }
+#endif
+  return rc;
 }
 
 static int tlso_session_upflags(Sockbuf *sb, tls_session *sess, int rc) {
@@ -947,6 +1103,22 @@ static int tlso_sb_setup(Sockbuf_IO_Desc *sbiod, void *arg) {
 
   p->session = arg;
   p->sbiod = sbiod;
+#ifdef SSL_OP_ENABLE_KTLS
+  if (SSL_get_options(p->session) & SSL_OP_ENABLE_KTLS) {
+    ber_socket_t fd;
+
+    /* kTLS needs the socket itself underneath SSL, so the lower sockbuf
+     * layers (e.g. debug) are bypassed for the ciphertext. */
+    if (ber_sockbuf_ctrl(sbiod->sbiod_sb, LBER_SB_OPT_GET_FD, &fd) == 1 && fd != AC_SOCKET_INVALID) {
+      bio = BIO_new_socket(fd, BIO_NOCLOSE);
+      if (bio) {
+        SSL_set_bio(p->session, bio, bio);
+        sbiod->sbiod_pvt = p;
+        return 0;
+      }
+    }
+  }
+#endif
 #if OPENSSL_VERSION_NUMBER < 0x10100000L || defined(LIBRESSL_VERSION_NUMBER)
   bio = BIO_new(&tlso_bio_method);
 #else
@@ -1073,6 +1245,18 @@ static ber_slen_t tlso_sb_write(Sockbuf_IO_Desc *sbiod, void *buf, ber_len_t len
     return -1;
   }
 
+#ifdef SSL_OP_ENABLE_KTLS
+  /* The kernel frames and encrypts whatever is written to the socket,
+   * so plaintext goes straight down the stack unless OpenSSL itself
+   * still has a record or a key update to send. */
+  if (BIO_get_ktls_send(SSL_get_wbio(p->session)) && !SSL_want_write(p->session) &&
+      SSL_get_key_update_type(p->session) == SSL_KEY_UPDATE_NONE) {
+    ret = LBER_SBIOD_WRITE_NEXT(sbiod, buf, len);
+    sbiod->sbiod_sb->sb_trans_needs_write = 0;
+    return ret;
+  }
+#endif
+
   ret = SSL_write(p->session, (char *)buf, len);
   err = SSL_get_error(p->session, ret);
   if (err == SSL_ERROR_WANT_WRITE) {
@@ -1269,6 +1453,7 @@ tls_impl ldap_int_tls_impl = {
     tlso_ctx_ref,
     tlso_ctx_free,
     tlso_ctx_init,
+    tlso_ctx_stats,
 
     tlso_session_new,
     tlso_session_connect,
@@ -60,6 +60,7 @@ typedef struct ldap_int_thread_userctx_s {
   struct ldap_int_thread_poolq_s *ltu_pq;
   ldap_pvt_thread_t ltu_id;
   ldap_int_tpool_key_t ltu_key[MAXKEYS];
+  unsigned long ltu_waited; /* microseconds the running task was queued */
 } ldap_int_thread_userctx_t;
 
 /* Simple {thread ID -> context} hash table; key=ctx->ltu_id.
@@ -88,6 +89,7 @@ typedef struct ldap_int_thread_task_s {
   ldap_pvt_thread_start_t *ltt_start_routine;
   void *ltt_arg;
   struct ldap_int_thread_poolq_s *ltt_queue;
+  uint64_t ltt_queued; /* when submitted, see ldap_int_thread_pool_clock() */
 } ldap_int_thread_task_t;
 
 typedef LDAP_STAILQ_HEAD(tcq, ldap_int_thread_task_s) ldap_int_tpool_plist_t;
@@ -125,6 +127,12 @@ struct ldap_int_thread_poolq_s {
   int ltq_active_count;  /* Active, not paused/idle tasks */
   int ltq_open_count;    /* Number of threads */
   int ltq_starting;      /* Currently starting threads */
+  int ltq_waiting;       /* Threads waiting on ltq_cond for work */
+
+  /* Set by pool_submit() of a busy queue when waking one of our
+   * waiting threads to take over tasks queued there.
+   */
+  int ltq_steal;
 };
 
 struct ldap_int_thread_pool_s {
@@ -333,13 +341,21 @@ int ldap_pvt_thread_pool_submit(ldap_pvt_thread_pool_t *tpool, ldap_pvt_thread_s
 }
 
 /* Submit a task to be performed by the thread pool */
+/* Monotonic microseconds, cheap enough to take for every task */
+static uint64_t ldap_int_thread_pool_clock(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * (uint64_t)1000000 + ts.tv_nsec / 1000;
+}
+
 int ldap_pvt_thread_pool_submit2(ldap_pvt_thread_pool_t *tpool, ldap_pvt_thread_start_t *start_routine, void *arg,
                                  void **cookie) {
   struct ldap_int_thread_pool_s *pool;
   struct ldap_int_thread_poolq_s *pq;
   ldap_int_thread_task_t *task;
   ldap_pvt_thread_t thr;
-  int i, j;
+  int i, j, steal;
 
   if (tpool == NULL)
     return (-1);
@@ -394,6 +410,7 @@ int ldap_pvt_thread_pool_submit2(ldap_pvt_thread_pool_t *tpool, ldap_pvt_thread_
   task->ltt_start_routine = start_routine;
   task->ltt_arg = arg;
   task->ltt_queue = pq;
+  task->ltt_queued = ldap_int_thread_pool_clock();
   if (cookie)
     *cookie = task;
 
@@ -403,8 +420,12 @@ int ldap_pvt_thread_pool_submit2(ldap_pvt_thread_pool_t *tpool, ldap_pvt_thread_
   if (pool->ltp_pause)
     goto done;
 
+  /* nobody here is free to take the task right away */
+  steal = pool->ltp_numqs > 1 && pq->ltq_waiting == 0;
+
   /* should we open (create) a thread? */
   if (pq->ltq_open_count < pq->ltq_active_count + pq->ltq_pending_count && pq->ltq_open_count < pq->ltq_max_count) {
+    steal = 0;
     pq->ltq_starting++;
     pq->ltq_open_count++;
 
@@ -442,6 +463,23 @@ int ldap_pvt_thread_pool_submit2(ldap_pvt_thread_pool_t *tpool, ldap_pvt_thread_
     }
   }
   ldap_pvt_thread_cond_signal(&pq->ltq_cond);
+  ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
+
+  if (steal) {
+    /* let a waiting thread of another queue take over the task */
+    for (j = 1; j < pool->ltp_numqs; j++) {
+      struct ldap_int_thread_poolq_s *wq = pool->ltp_wqs[(i + j) % pool->ltp_numqs];
+      ldap_pvt_thread_mutex_lock(&wq->ltq_mutex);
+      if (wq->ltq_waiting > 0) {
+        wq->ltq_steal = 1;
+        ldap_pvt_thread_cond_signal(&wq->ltq_cond);
+        ldap_pvt_thread_mutex_unlock(&wq->ltq_mutex);
+        break;
+      }
+      ldap_pvt_thread_mutex_unlock(&wq->ltq_mutex);
+    }
+  }
+  return (0);
 
 done:
   ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
@@ -885,6 +923,36 @@ int ldap_pvt_thread_pool_free(ldap_pvt_thread_pool_t *tpool) {
   return (0);
 }
 
+/*
+ * Take the oldest pending task of another queue, so that tasks do not
+ * wait behind a busy queue while threads of other queues are free.
+ * The caller must be an active thread of pq, not holding its mutex:
+ * a pause then waits for it, and ltp_wqs[] stays put.  Queues whose
+ * mutex is busy are skipped rather than waited for.
+ */
+static ldap_int_thread_task_t *ldap_int_thread_pool_steal(struct ldap_int_thread_pool_s *pool,
+                                                          struct ldap_int_thread_poolq_s *pq) {
+  struct ldap_int_thread_poolq_s *victim;
+  ldap_int_thread_task_t *task = NULL;
+  int i, j, numqs = pool->ltp_numqs;
+
+  for (i = 0; i < numqs && pool->ltp_wqs[i] != pq; i++)
+    ;
+  for (j = 1; j < numqs && task == NULL; j++) {
+    victim = pool->ltp_wqs[(i + j) % numqs];
+    if (victim == pq || ldap_pvt_thread_mutex_trylock(&victim->ltq_mutex) != 0)
+      continue;
+    /* ltq_work_list is the empty list while pausing */
+    task = LDAP_STAILQ_FIRST(victim->ltq_work_list);
+    if (task != NULL) {
+      LDAP_STAILQ_REMOVE_HEAD(victim->ltq_work_list, ltt_next.q);
+      victim->ltq_pending_count--;
+    }
+    ldap_pvt_thread_mutex_unlock(&victim->ltq_mutex);
+  }
+  return task;
+}
+
 /* Thread loop.  Accept and handle submitted tasks. */
 static void *ldap_int_thread_pool_wrapper(void *xpool) {
   struct ldap_int_thread_poolq_s *pq = xpool;
@@ -933,6 +1001,19 @@ static void *ldap_int_thread_pool_wrapper(void *xpool) {
   for (;;) {
     work_list = pq->ltq_work_list; /* help the compiler a bit */
     task = LDAP_STAILQ_FIRST(work_list);
+    if (task == NULL && pool->ltp_numqs > 1 && !read_ltp_pause__tsan_woraround(pool)) {
+      /* Nothing queued here, look at the other queues before
+       * going idle. We are still active, so no pause can start
+       * under us.
+       */
+      ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
+      task = ldap_int_thread_pool_steal(pool, pq);
+      if (task != NULL)
+        goto run;
+      ldap_pvt_thread_mutex_lock(&pq->ltq_mutex);
+      work_list = pq->ltq_work_list;
+      task = LDAP_STAILQ_FIRST(work_list);
+    }
     if (task == NULL) { /* paused or no pending tasks */
       if (--(pq->ltq_active_count) < 1) {
         if (pool->ltp_pause) {
@@ -973,11 +1054,24 @@ static void *ldap_int_thread_pool_wrapper(void *xpool) {
             ldap_pvt_thread_mutex_lock(&pq->ltq_mutex);
             pool_lock = 0;
           }
-        } else
+        } else {
+          pq->ltq_waiting++;
           ldap_pvt_thread_cond_wait(&pq->ltq_cond, &pq->ltq_mutex);
+          pq->ltq_waiting--;
+        }
 
         work_list = pq->ltq_work_list;
         task = LDAP_STAILQ_FIRST(work_list);
+
+        /* Woken by pool_submit() of a busy queue: become active
+         * again and try to steal its task.  Checking ltp_pause
+         * under ltq_mutex ensures a pause in progress counts us.
+         */
+        if (task == NULL && pq->ltq_steal && !pool_lock) {
+          pq->ltq_steal = 0;
+          if (!read_ltp_pause__tsan_woraround(pool))
+            break;
+        }
       } while (task == NULL);
 
       if (pool_lock) {
@@ -986,12 +1080,16 @@ static void *ldap_int_thread_pool_wrapper(void *xpool) {
         pool_lock = 0;
       }
       pq->ltq_active_count++;
+      if (task == NULL)
+        continue;
     }
 
     LDAP_STAILQ_REMOVE_HEAD(work_list, ltt_next.q);
     pq->ltq_pending_count--;
     ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
 
+  run:
+    ctx.ltu_waited = ldap_int_thread_pool_clock() - task->ltt_queued;
     task->ltt_start_routine(&ctx, task->ltt_arg);
 
     ldap_pvt_thread_mutex_lock(&pq->ltq_mutex);
@@ -1207,6 +1305,119 @@ int ldap_pvt_thread_pool_resume(ldap_pvt_thread_pool_t *tpool) {
   return (0);
 }
 
+/*
+ * Give a thread which the pool did not start a context of its own, so
+ * that it can run pool tasks in place (see pool_enter()).  Its keys are
+ * visible to pool_purgekey() like those of the pool threads.
+ * Return the context, or NULL on failure.
+ */
+void *ldap_pvt_thread_pool_attach(ldap_pvt_thread_pool_t *tpool) {
+  struct ldap_int_thread_pool_s *pool;
+  ldap_int_thread_userctx_t *ctx, *kctx;
+  unsigned keyslot, hash;
+
+  if (tpool == NULL || (pool = *tpool) == NULL)
+    return NULL;
+
+  ctx = LDAP_CALLOC(1, sizeof(*ctx));
+  if (ctx == NULL)
+    return NULL;
+
+  /* the first queue is never retired by pool_queues() */
+  ctx->ltu_pq = pool->ltp_wqs[0];
+  ctx->ltu_id = ldap_pvt_thread_self();
+  TID_HASH(ctx->ltu_id, hash);
+
+  ldap_pvt_thread_mutex_lock(&pool->ltp_mutex);
+  /* thread_keys[] is read-only when paused */
+  while (pool->ltp_pause)
+    ldap_pvt_thread_cond_wait(&pool->ltp_cond, &pool->ltp_mutex);
+  ldap_pvt_thread_mutex_unlock(&pool->ltp_mutex);
+
+  ldap_pvt_thread_mutex_lock(&ldap_pvt_thread_pool_mutex);
+  for (keyslot = hash & (LDAP_MAXTHR - 1); (kctx = thread_keys[keyslot].ctx) && kctx != DELETED_THREAD_CTX;
+       keyslot = (keyslot + 1) & (LDAP_MAXTHR - 1))
+    ;
+  thread_keys[keyslot].ctx = ctx;
+  ldap_pvt_thread_mutex_unlock(&ldap_pvt_thread_pool_mutex);
+
+  ldap_pvt_thread_key_setdata(ldap_tpool_key, ctx);
+  return ctx;
+}
+
+/* Free the keys and the context of pool_attach() */
+void ldap_pvt_thread_pool_detach(void *vctx) {
+  ldap_int_thread_userctx_t *ctx = vctx;
+  unsigned keyslot, hash;
+
+  if (ctx == NULL)
+    return;
+
+  TID_HASH(ctx->ltu_id, hash);
+
+  ldap_pvt_thread_mutex_lock(&ldap_pvt_thread_pool_mutex);
+  ldap_pvt_thread_pool_context_reset(ctx);
+  for (keyslot = hash & (LDAP_MAXTHR - 1); thread_keys[keyslot].ctx != ctx;
+       keyslot = (keyslot + 1) & (LDAP_MAXTHR - 1))
+    ;
+  thread_keys[keyslot].ctx = DELETED_THREAD_CTX;
+  ldap_pvt_thread_mutex_unlock(&ldap_pvt_thread_pool_mutex);
+
+  ldap_pvt_thread_key_setdata(ldap_tpool_key, NULL);
+  LDAP_FREE(ctx);
+}
+
+/*
+ * Count the attached thread as an active pool task until pool_leave(),
+ * so that pool_pause() waits for it.  Refuses (returns -1) while the
+ * pool is pausing, paused or finishing; the caller should then submit
+ * the work instead.
+ */
+int ldap_pvt_thread_pool_enter(void *vctx) {
+  ldap_int_thread_userctx_t *ctx = vctx;
+  struct ldap_int_thread_poolq_s *pq = ctx->ltu_pq;
+  struct ldap_int_thread_pool_s *pool = pq->ltq_pool;
+  int rc = -1;
+
+  ldap_pvt_thread_mutex_lock(&pq->ltq_mutex);
+  if (!pool->ltp_pause && !pool->ltp_finishing) {
+    pq->ltq_active_count++;
+    rc = 0;
+  }
+  ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
+  return rc;
+}
+
+/* Cancel pool_enter(), as a pool thread does when its task is done */
+void ldap_pvt_thread_pool_leave(void *vctx) {
+  ldap_int_thread_userctx_t *ctx = vctx;
+  struct ldap_int_thread_poolq_s *pq = ctx->ltu_pq;
+  struct ldap_int_thread_pool_s *pool = pq->ltq_pool;
+
+  ldap_pvt_thread_mutex_lock(&pq->ltq_mutex);
+  if (--(pq->ltq_active_count) < 1 && pool->ltp_pause) {
+    ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
+    ldap_pvt_thread_mutex_lock(&pool->ltp_mutex);
+    if (--(pool->ltp_active_queues) < 1) {
+      /* Notify pool_pause it is the sole active thread. */
+      ldap_pvt_thread_cond_signal(&pool->ltp_pcond);
+    }
+    ldap_pvt_thread_mutex_unlock(&pool->ltp_mutex);
+    return;
+  }
+  ldap_pvt_thread_mutex_unlock(&pq->ltq_mutex);
+}
+
+/*
+ * How long the task running in ctx waited in the queue, in microseconds.
+ * Zero for contexts that do not run pool tasks.
+ */
+unsigned long ldap_pvt_thread_pool_waited(void *xctx) {
+  ldap_int_thread_userctx_t *ctx = xctx;
+
+  return ctx ? ctx->ltu_waited : 0;
+}
+
 /*
  * Get the key's data and optionally free function in the given context.
  */
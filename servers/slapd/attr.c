@@ -37,10 +37,29 @@
 #define CHUNK_SIZE 1000
 typedef struct slap_list {
   struct slap_list *next;
+  ber_len_t size; /* as charged to SLAP_MEM_ENTRY */
 } slap_list;
 static slap_list *attr_chunks;
 static Attribute *attrs_list;
 static ldap_pvt_thread_mutex_t attr_mutex;
+static slap_freelist_stats attr_stats; /* protected by attr_mutex */
+
+/*
+ * Per-thread caches in front of attrs_list: a pool thread keeps up to
+ * ATTR_CACHE_MAX free attributes of its own and moves them from/to the
+ * shared list ATTR_CACHE_BATCH at a time, so attr_mutex is taken once per
+ * batch rather than once per attribute.  Threads outside of the pool
+ * (listeners, the main thread) keep using the shared list directly.
+ */
+#define ATTR_CACHE_MAX 512
+#define ATTR_CACHE_BATCH 128
+typedef struct attr_cache {
+  Attribute *ac_list;
+  int ac_count;
+} attr_cache;
+static __thread attr_cache *attr_tcache;
+static attr_cache attr_nocache;
+static void *attr_main_ctx;
 
 int attr_prealloc(int num) {
   Attribute *a;
@@ -50,8 +69,12 @@ int attr_prealloc(int num) {
     return 0;
 
   s = ch_calloc(1, sizeof(slap_list) + num * sizeof(Attribute));
+  s->size = sizeof(slap_list) + num * sizeof(Attribute);
+  slap_mem_charge(SLAP_MEM_ENTRY, s->size);
   s->next = attr_chunks;
   attr_chunks = s;
+  attr_stats.fs_total += num;
+  attr_stats.fs_free += num;
 
   a = (Attribute *)(s + 1);
   for (; num > 1; num--) {
@@ -64,17 +87,108 @@ int attr_prealloc(int num) {
   return 0;
 }
 
-Attribute *attr_alloc(AttributeDescription *ad) {
-  Attribute *a;
+/* Move num attributes from the shared list to the thread cache */
+static void attr_cache_refill(attr_cache *ac, int num) {
+  Attribute **a, *head;
+  int n;
 
   ldap_pvt_thread_mutex_lock(&attr_mutex);
-  if (!attrs_list)
-    attr_prealloc(CHUNK_SIZE);
-  a = attrs_list;
-  attrs_list = a->a_next;
-  a->a_next = NULL;
+  if (attr_stats.fs_free < (unsigned long)num)
+    attr_prealloc(num > CHUNK_SIZE ? num : CHUNK_SIZE);
+  head = attrs_list;
+  for (a = &attrs_list, n = num; n > 0; n--)
+    a = &(*a)->a_next;
+  attrs_list = *a;
+  attr_stats.fs_free -= num;
+  attr_stats.fs_refills++;
   ldap_pvt_thread_mutex_unlock(&attr_mutex);
 
+  *a = ac->ac_list;
+  ac->ac_list = head;
+  ac->ac_count += num;
+}
+
+/* Give all but keep attributes back to the shared list */
+static void attr_cache_trim(attr_cache *ac, int keep) {
+  Attribute *head, *tail;
+  int n;
+
+  n = ac->ac_count - keep;
+  if (n <= 0)
+    return;
+  head = ac->ac_list;
+  for (tail = head; --n > 0;)
+    tail = tail->a_next;
+  ac->ac_list = tail->a_next;
+  n = ac->ac_count - keep;
+  ac->ac_count = keep;
+
+  ldap_pvt_thread_mutex_lock(&attr_mutex);
+  tail->a_next = attrs_list;
+  attrs_list = head;
+  attr_stats.fs_free += n;
+  attr_stats.fs_returns++;
+  ldap_pvt_thread_mutex_unlock(&attr_mutex);
+}
+
+/* pool key destructor, runs on the exiting thread */
+static void attr_cache_free(void *key, void *data) {
+  attr_cache *ac = data;
+
+  attr_cache_trim(ac, 0);
+  if (attr_tcache == ac)
+    attr_tcache = NULL;
+  ch_free(ac);
+}
+
+static attr_cache *attr_cache_get(void) {
+  attr_cache *ac = attr_tcache;
+  void *ctx;
+
+  if (likely(ac != NULL))
+    return ac;
+
+  ac = &attr_nocache;
+  ctx = ldap_pvt_thread_pool_context();
+  if (ctx != attr_main_ctx) {
+    attr_cache *nc = ch_calloc(1, sizeof(attr_cache));
+    if (ldap_pvt_thread_pool_setkey(ctx, (void *)attr_cache_get, nc, attr_cache_free, NULL, NULL) == 0)
+      ac = nc;
+    else
+      ch_free(nc);
+  }
+  attr_tcache = ac;
+  return ac;
+}
+
+void attr_freelist_stats(slap_freelist_stats *fs) {
+  ldap_pvt_thread_mutex_lock(&attr_mutex);
+  *fs = attr_stats;
+  ldap_pvt_thread_mutex_unlock(&attr_mutex);
+}
+
+Attribute *attr_alloc(AttributeDescription *ad) {
+  attr_cache *ac = attr_cache_get();
+  Attribute *a;
+
+  if (ac != &attr_nocache) {
+    if (!ac->ac_list)
+      attr_cache_refill(ac, ATTR_CACHE_BATCH);
+    a = ac->ac_list;
+    ac->ac_list = a->a_next;
+    ac->ac_count--;
+    a->a_next = NULL;
+  } else {
+    ldap_pvt_thread_mutex_lock(&attr_mutex);
+    if (!attrs_list)
+      attr_prealloc(CHUNK_SIZE);
+    a = attrs_list;
+    attrs_list = a->a_next;
+    attr_stats.fs_free--;
+    a->a_next = NULL;
+    ldap_pvt_thread_mutex_unlock(&attr_mutex);
+  }
+
   a->a_desc = ad;
   if (ad && (ad->ad_type->sat_flags & SLAP_AT_SORTED_VAL))
     a->a_flags |= SLAP_ATTR_SORTED_VALS;
@@ -84,10 +198,27 @@ Attribute *attr_alloc(AttributeDescription *ad) {
 
 /* Return a list of num attrs */
 Attribute *attrs_alloc(int num) {
+  attr_cache *ac = attr_cache_get();
   Attribute *head = NULL;
   Attribute **a;
+  int n;
+
+  if (ac != &attr_nocache) {
+    if (num <= 0)
+      return NULL;
+    if (ac->ac_count < num)
+      attr_cache_refill(ac, num - ac->ac_count + ATTR_CACHE_BATCH);
+    head = ac->ac_list;
+    for (a = &ac->ac_list, n = num; n > 0; n--)
+      a = &(*a)->a_next;
+    ac->ac_list = *a;
+    ac->ac_count -= num;
+    *a = NULL;
+    return head;
+  }
 
   ldap_pvt_thread_mutex_lock(&attr_mutex);
+  attr_stats.fs_free -= num > 0 ? num : 0;
   for (a = &attrs_list; *a && num > 0; a = &(*a)->a_next) {
     if (!head)
       head = *a;
@@ -140,10 +271,20 @@ void attr_clean(Attribute *a) {
 }
 
 void attr_free(Attribute *a) {
+  attr_cache *ac = attr_cache_get();
+
   attr_clean(a);
+  if (ac != &attr_nocache) {
+    a->a_next = ac->ac_list;
+    ac->ac_list = a;
+    if (++ac->ac_count > ATTR_CACHE_MAX)
+      attr_cache_trim(ac, ATTR_CACHE_BATCH);
+    return;
+  }
   ldap_pvt_thread_mutex_lock(&attr_mutex);
   a->a_next = attrs_list;
   attrs_list = a;
+  attr_stats.fs_free++;
   ldap_pvt_thread_mutex_unlock(&attr_mutex);
 }
 
@@ -164,7 +305,9 @@ void comp_tree_free(Attribute *a) {
 
 void attrs_free(Attribute *a) {
   if (a) {
+    attr_cache *ac = attr_cache_get();
     Attribute *b = (Attribute *)0xBAD, *tail, *next;
+    int n = 0;
 
     /* save tail */
     tail = a;
@@ -174,13 +317,24 @@ void attrs_free(Attribute *a) {
       a->a_next = b;
       b = a;
       a = next;
+      n++;
     } while (next);
 
+    if (ac != &attr_nocache) {
+      tail->a_next = ac->ac_list;
+      ac->ac_list = b;
+      ac->ac_count += n;
+      if (ac->ac_count > ATTR_CACHE_MAX)
+        attr_cache_trim(ac, ATTR_CACHE_BATCH);
+      return;
+    }
+
     ldap_pvt_thread_mutex_lock(&attr_mutex);
     /* replace NULL with current attr list and let attr list
      * start from last attribute returned to list */
     tail->a_next = attrs_list;
     attrs_list = b;
+    attr_stats.fs_free += n;
     ldap_pvt_thread_mutex_unlock(&attr_mutex);
   }
 }
@@ -609,6 +763,7 @@ int attr_delete(Attribute **attrs, AttributeDescription *desc) {
 
 int attr_init(void) {
   ldap_pvt_thread_mutex_init(&attr_mutex);
+  attr_main_ctx = ldap_pvt_thread_pool_context();
   return 0;
 }
 
@@ -617,8 +772,12 @@ int attr_destroy(void) {
 
   for (a = attr_chunks; a; a = attr_chunks) {
     attr_chunks = a->next;
+    slap_mem_uncharge(SLAP_MEM_ENTRY, a->size);
     free(a);
   }
+  attrs_list = NULL;
+  memset(&attr_stats, 0, sizeof(attr_stats));
+  attr_tcache = NULL;
   ldap_pvt_thread_mutex_destroy(&attr_mutex);
   return 0;
 }
@@ -76,12 +76,37 @@ AttrInfo *mdb_attr_mask(struct mdb_info *mdb, AttributeDescription *desc) {
   return i < 0 ? NULL : mdb->mi_attrs[i];
 }
 
+/* Open the table of an index kept apart from the attribute's main one */
+static int mdb_attr_side_open(BackendDB *be, MDBX_txn *txn, AttrInfo *ai, const char *suffix, int flags,
+                              MDBX_dbi *dbi, ConfigReply *cr) {
+  char *name;
+  int rc;
+
+  name = ch_malloc(ai->ai_desc->ad_type->sat_cname.bv_len + strlen(suffix) + 1);
+  strcpy(lutil_strcopy(name, ai->ai_desc->ad_type->sat_cname.bv_val), suffix);
+  rc = mdbx_dbi_open(txn, name, flags, dbi);
+  if (rc) {
+    snprintf(cr->msg, sizeof(cr->msg),
+             "database \"%s\": "
+             "mdbx_dbi_open(%s) failed: %s (%d).",
+             be->be_suffix[0].bv_val, name, mdbx_strerror(rc), rc);
+    Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_attr_dbs) ": %s\n", cr->msg);
+  }
+  ch_free(name);
+  return rc;
+}
+
+/* Which handles of an attribute mdb_attr_dbs_open() opened itself */
+#define MDB_ATTR_OPENED_DBI 0x01
+#define MDB_ATTR_OPENED_ODBI 0x02
+#define MDB_ATTR_OPENED_GDBI 0x04
+
 /* Open all un-opened index DB handles */
 int mdb_attr_dbs_open(BackendDB *be, MDBX_txn *tx0, ConfigReply *cr) {
   struct mdb_info *mdb = (struct mdb_info *)be->be_private;
   MDBX_txn *txn;
-  MDBX_dbi *dbis = NULL;
-  int i, flags;
+  unsigned char *opened = NULL;
+  int i, last, flags;
   int rc;
 
   txn = tx0;
@@ -95,7 +120,7 @@ int mdb_attr_dbs_open(BackendDB *be, MDBX_txn *tx0, ConfigReply *cr) {
       Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_attr_dbs) ": %s\n", cr->msg);
       return rc;
     }
-    dbis = ch_calloc(1, mdb->mi_nattrs * sizeof(MDBX_dbi));
+    opened = ch_calloc(1, mdb->mi_nattrs);
   } else {
     rc = 0;
   }
@@ -105,23 +130,42 @@ int mdb_attr_dbs_open(BackendDB *be, MDBX_txn *tx0, ConfigReply *cr) {
     flags |= MDBX_CREATE;
 
   for (i = 0; i < mdb->mi_nattrs; i++) {
-    if (mdb->mi_attrs[i]->ai_dbi) /* already open */
-      continue;
-    if (!(mdb->mi_attrs[i]->ai_indexmask || mdb->mi_attrs[i]->ai_newmask)) /* not an index record */
+    AttrInfo *ai = mdb->mi_attrs[i];
+
+    if (!(ai->ai_indexmask || ai->ai_newmask)) /* not an index record */
       continue;
-    rc = mdbx_dbi_open(txn, mdb->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, flags, &mdb->mi_attrs[i]->ai_dbi);
-    if (rc) {
-      snprintf(cr->msg, sizeof(cr->msg),
-               "database \"%s\": "
-               "mdbx_dbi_open(%s) failed: %s (%d).",
-               be->be_suffix[0].bv_val, mdb->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
-      Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_attr_dbs) ": %s\n", cr->msg);
-      break;
+    if (!ai->ai_dbi) {
+      rc = mdbx_dbi_open(txn, ai->ai_desc->ad_type->sat_cname.bv_val, flags, &ai->ai_dbi);
+      if (rc) {
+        snprintf(cr->msg, sizeof(cr->msg),
+                 "database \"%s\": "
+                 "mdbx_dbi_open(%s) failed: %s (%d).",
+                 be->be_suffix[0].bv_val, ai->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
+        Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_attr_dbs) ": %s\n", cr->msg);
+        break;
+      }
+      /* Remember newly opened DBI handles */
+      if (opened)
+        opened[i] |= MDB_ATTR_OPENED_DBI;
+    }
+    /* ordered and n-gram keys live in their own tables, so that key
+     * walks don't wade through the hashed keys of the other indices */
+    if (!ai->ai_odbi && ((ai->ai_indexmask | ai->ai_newmask) & SLAP_INDEX_ORDERED)) {
+      rc = mdb_attr_side_open(be, txn, ai, MDB_ORDERED_SUFFIX, flags, &ai->ai_odbi, cr);
+      if (rc)
+        break;
+      if (opened)
+        opened[i] |= MDB_ATTR_OPENED_ODBI;
+    }
+    if (!ai->ai_gdbi && ((ai->ai_indexmask | ai->ai_newmask) & SLAP_INDEX_NGRAM)) {
+      rc = mdb_attr_side_open(be, txn, ai, MDB_NGRAM_SUFFIX, flags, &ai->ai_gdbi, cr);
+      if (rc)
+        break;
+      if (opened)
+        opened[i] |= MDB_ATTR_OPENED_GDBI;
     }
-    /* Remember newly opened DBI handles */
-    if (dbis)
-      dbis[i] = mdb->mi_attrs[i]->ai_dbi;
   }
+  last = i; /* the attributes up to here were visited */
 
   /* Only commit if this is our txn */
   if (tx0 == NULL) {
@@ -137,17 +181,35 @@ int mdb_attr_dbs_open(BackendDB *be, MDBX_txn *tx0, ConfigReply *cr) {
     } else {
       mdbx_txn_abort(txn);
     }
-    /* Something failed, forget anything we just opened */
+    /* Something failed, forget anything we just opened. The handles
+     * went away with the aborted txn, those opened before stay usable.
+     * A visited index whose side table is gone can't keep that type. */
     if (rc) {
-      for (i = 0; i < mdb->mi_nattrs; i++) {
-        if (dbis[i]) {
-          mdb->mi_attrs[i]->ai_dbi = 0;
-          mdb->mi_attrs[i]->ai_indexmask |= MDB_INDEX_DELETING;
+      for (i = 0; i < mdb->mi_nattrs && i <= last; i++) {
+        AttrInfo *ai = mdb->mi_attrs[i];
+
+        if (opened[i] & MDB_ATTR_OPENED_DBI) {
+          ai->ai_dbi = 0;
+          ai->ai_indexmask |= MDB_INDEX_DELETING;
+        }
+        if (opened[i] & MDB_ATTR_OPENED_ODBI)
+          ai->ai_odbi = 0;
+        if (opened[i] & MDB_ATTR_OPENED_GDBI)
+          ai->ai_gdbi = 0;
+        if (!ai->ai_dbi)
+          continue;
+        if (!ai->ai_odbi) {
+          ai->ai_indexmask &= ~SLAP_INDEX_ORDERED;
+          ai->ai_newmask &= ~SLAP_INDEX_ORDERED;
+        }
+        if (!ai->ai_gdbi) {
+          ai->ai_indexmask &= ~SLAP_INDEX_NGRAM;
+          ai->ai_newmask &= ~SLAP_INDEX_NGRAM;
         }
       }
       mdb_attr_flush(mdb);
     }
-    ch_free(dbis);
+    ch_free(opened);
   }
 
   return rc;
@@ -159,6 +221,14 @@ void mdb_attr_dbs_close(struct mdb_info *mdb) {
     if (mdb->mi_attrs[i]->ai_dbi) {
       mdbx_dbi_close(mdb->mi_dbenv, mdb->mi_attrs[i]->ai_dbi);
       mdb->mi_attrs[i]->ai_dbi = 0;
+      if (mdb->mi_attrs[i]->ai_odbi) {
+        mdbx_dbi_close(mdb->mi_dbenv, mdb->mi_attrs[i]->ai_odbi);
+        mdb->mi_attrs[i]->ai_odbi = 0;
+      }
+      if (mdb->mi_attrs[i]->ai_gdbi) {
+        mdbx_dbi_close(mdb->mi_dbenv, mdb->mi_attrs[i]->ai_gdbi);
+        mdb->mi_attrs[i]->ai_gdbi = 0;
+      }
     }
 }
 
@@ -315,6 +385,24 @@ int mdb_attr_index_config(struct mdb_info *mdb, const char *fname, int lineno, i
       goto fail;
     }
 
+    if (IS_SLAP_INDEX(mask, SLAP_INDEX_ORDERED) && !mdb_index_ordered_rule(ad->ad_type)) {
+      if (c_reply) {
+        snprintf(c_reply->msg, sizeof(c_reply->msg), "ordered index of attribute \"%s\" disallowed", attrs[i]);
+        fprintf(stderr, "%s: line %d: %s\n", fname, lineno, c_reply->msg);
+      }
+      rc = LDAP_INAPPROPRIATE_MATCHING;
+      goto fail;
+    }
+
+    if (IS_SLAP_INDEX(mask, SLAP_INDEX_NGRAM) && !mdb_index_ngram_rule(ad->ad_type)) {
+      if (c_reply) {
+        snprintf(c_reply->msg, sizeof(c_reply->msg), "ngram index of attribute \"%s\" disallowed", attrs[i]);
+        fprintf(stderr, "%s: line %d: %s\n", fname, lineno, c_reply->msg);
+      }
+      rc = LDAP_INAPPROPRIATE_MATCHING;
+      goto fail;
+    }
+
     Debug(LDAP_DEBUG_CONFIG, "index %s 0x%04lx\n", ad->ad_cname.bv_val, mask);
 
     a = (AttrInfo *)ch_calloc(1, sizeof(AttrInfo));
@@ -360,8 +448,8 @@ int mdb_attr_index_config(struct mdb_info *mdb, const char *fname, int lineno, i
     rc = ainfo_insert(mdb, a);
     if (rc) {
       AttrInfo *b = mdb_attr_mask(mdb, ad);
-      /* If this is just a multival record, reuse it for index info */
-      if (!(b->ai_indexmask || b->ai_newmask) && b->ai_multi_lo < UINT_MAX) {
+      /* If this is just a multival or ngramlen record, reuse it for index info */
+      if (!(b->ai_indexmask || b->ai_newmask) && (b->ai_multi_lo < UINT_MAX || b->ai_ngram_len)) {
         b->ai_indexmask = a->ai_indexmask;
         b->ai_newmask = a->ai_newmask;
         ch_free(a);
@@ -572,6 +660,123 @@ void mdb_attr_multi_thresh(struct mdb_info *mdb, AttributeDescription *ad, unsig
   }
 }
 
+int mdb_attr_ngram_config(struct mdb_info *mdb, const char *fname, int lineno, int argc, char **argv,
+                          struct config_reply_s *c_reply) {
+  int rc = 0;
+  int i;
+  unsigned len;
+  char **attrs, *next;
+
+  attrs = ldap_str2charray(argv[0], ",");
+
+  if (attrs == NULL) {
+    fprintf(stderr,
+            "%s: line %d: "
+            "no attributes specified: %s\n",
+            fname, lineno, argv[0]);
+    return LDAP_PARAM_ERROR;
+  }
+
+  len = strtoul(argv[1], &next, 10);
+  if (next == argv[1] || next[0] != '\0' || len < 2 || len > MDB_NGRAM_MAX) {
+    snprintf(c_reply->msg, sizeof(c_reply->msg), "invalid gram length, must be 2..%d", MDB_NGRAM_MAX);
+    fprintf(stderr, "%s: line %d: %s\n", fname, lineno, c_reply->msg);
+    ldap_charray_free(attrs);
+    return LDAP_PARAM_ERROR;
+  }
+
+  for (i = 0; attrs[i] != NULL; i++) {
+    AttrInfo *a;
+    AttributeDescription *ad;
+    const char *text;
+
+    if (strcasecmp(attrs[i], "default") == 0) {
+      mdb->mi_ngram_len = len;
+      continue;
+    }
+
+    ad = NULL;
+    rc = slap_str2ad(attrs[i], &ad, &text);
+
+    if (rc != LDAP_SUCCESS) {
+      if (c_reply) {
+        snprintf(c_reply->msg, sizeof(c_reply->msg), "ngramlen attribute \"%s\" undefined", attrs[i]);
+
+        fprintf(stderr, "%s: line %d: %s\n", fname, lineno, c_reply->msg);
+      }
+      goto done;
+    }
+
+    a = (AttrInfo *)ch_calloc(1, sizeof(AttrInfo));
+
+    a->ai_desc = ad;
+    a->ai_multi_hi = UINT_MAX;
+    a->ai_multi_lo = UINT_MAX;
+    a->ai_ngram_len = len;
+
+    rc = ainfo_insert(mdb, a);
+    if (rc) {
+      AttrInfo *b = mdb_attr_mask(mdb, ad);
+      ch_free(a);
+      /* If this is an index or multival record, reuse it */
+      if (!b->ai_ngram_len) {
+        b->ai_ngram_len = len;
+        rc = 0;
+        continue;
+      }
+      if (c_reply) {
+        snprintf(c_reply->msg, sizeof(c_reply->msg), "duplicate ngramlen definition for attr \"%s\"", attrs[i]);
+        fprintf(stderr, "%s: line %d: %s\n", fname, lineno, c_reply->msg);
+      }
+
+      rc = LDAP_PARAM_ERROR;
+      goto done;
+    }
+  }
+
+done:
+  ldap_charray_free(attrs);
+
+  return rc;
+}
+
+static int mdb_attr_ngram_unparser(void *v1, void *v2) {
+  AttrInfo *ai = v1;
+  BerVarray *bva = v2;
+  struct berval bv;
+  char digbuf[sizeof("4294967296")];
+  char *ptr;
+
+  bv.bv_len = snprintf(digbuf, sizeof(digbuf), "%u", ai->ai_ngram_len);
+  bv.bv_len += ai->ai_desc->ad_cname.bv_len + 1;
+  ptr = ch_malloc(bv.bv_len + 1);
+  bv.bv_val = lutil_strcopy(ptr, ai->ai_desc->ad_cname.bv_val);
+  *bv.bv_val++ = ' ';
+  strcpy(bv.bv_val, digbuf);
+  bv.bv_val = ptr;
+  ber_bvarray_add(bva, &bv);
+  return 0;
+}
+
+void mdb_attr_ngram_unparse(struct mdb_info *mdb, BerVarray *bva) {
+  int i;
+
+  if (mdb->mi_ngram_len) {
+    aidef.ai_ngram_len = mdb->mi_ngram_len;
+    mdb_attr_ngram_unparser(&aidef, bva);
+  }
+  for (i = 0; i < mdb->mi_nattrs; i++)
+    if (mdb->mi_attrs[i]->ai_ngram_len)
+      mdb_attr_ngram_unparser(mdb->mi_attrs[i], bva);
+}
+
+/* The gram length of an n-gram index */
+unsigned mdb_attr_ngram_len(struct mdb_info *mdb, AttrInfo *ai) {
+  if (ai && ai->ai_ngram_len)
+    return ai->ai_ngram_len;
+  return mdb->mi_ngram_len ? mdb->mi_ngram_len : MDB_NGRAM_LEN;
+}
+
 void mdb_attr_info_free(AttrInfo *ai) {
 #ifdef LDAP_COMP_MATCH
   free(ai->ai_cr);
@@ -605,8 +810,8 @@ void mdb_attr_flush(struct mdb_info *mdb) {
 
   for (i = 0; i < mdb->mi_nattrs; i++) {
     if (mdb->mi_attrs[i]->ai_indexmask & MDB_INDEX_DELETING) {
-      /* if this is also a multival rec, just clear index */
-      if (mdb->mi_attrs[i]->ai_multi_lo < UINT_MAX) {
+      /* if this is also a multival or ngramlen rec, just clear index */
+      if (mdb->mi_attrs[i]->ai_multi_lo < UINT_MAX || mdb->mi_attrs[i]->ai_ngram_len) {
         mdb->mi_attrs[i]->ai_indexmask = 0;
         mdb->mi_attrs[i]->ai_newmask = 0;
       } else {
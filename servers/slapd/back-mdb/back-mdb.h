@@ -38,7 +38,9 @@ LDAP_BEGIN_DECL
 #define MDB_DN2ID 1
 #define MDB_ID2ENTRY 2
 #define MDB_ID2VAL 3
-#define MDB_NDB 4
+#define MDB_IDL2BM 4
+#define MDB_ID2RANGE 5
+#define MDB_NDB 6
 
 /* The default search IDL stack cache depth */
 #define DEFAULT_SEARCH_STACK_DEPTH 16
@@ -56,6 +58,23 @@ LDAP_BEGIN_DECL
 /* Most users will never see this */
 #define DEFAULT_RTXN_SIZE 10000
 
+/* Default idle timeout of paged search candidates, in seconds */
+#define MDB_PAGED_TTL 300
+
+/* Ordered index keys are values cut to this many bytes, kept in
+ * a table named after the attribute plus this suffix */
+#define MDB_ORDERED_KEYLEN 64
+#define MDB_ORDERED_SUFFIX ";ordered"
+
+/* N-gram index keys are a kind byte followed by up to ngramlen bytes
+ * of a value, kept in a table named after the attribute plus the suffix */
+#define MDB_NGRAM_SUFFIX ";ngram"
+#define MDB_NGRAM_LEN 3 /* default gram length */
+#define MDB_NGRAM_MAX 16
+#define MDB_NGRAM_ANY 'a'     /* a gram at any position, shorter at the end */
+#define MDB_NGRAM_INITIAL 'i' /* the leading gram */
+#define MDB_NGRAM_FINAL 'f'   /* the trailing gram, reversed */
+
 #if LDAP_EXPERIMENTAL > 0
 #define MDB_MONITOR_IDX 1
 #endif /* LDAP_EXPERIMENTAL > 0 */
@@ -68,6 +87,12 @@ typedef struct mdb_monitor_t {
 /* From ldap_rq.h */
 struct re_s;
 
+/* From paged.c */
+struct mdb_paged;
+
+/* From sort.c */
+struct mdb_sort;
+
 struct mdb_info {
   MDBX_env *mi_dbenv;
 
@@ -125,6 +150,34 @@ struct mdb_info {
   /* less than this many values in an attr goes
    * back into main blob */
 
+  int mi_idl_bitmap;
+  /* keep oversized index slots as bitmaps
+   * instead of ranges */
+
+  ldap_pvt_thread_mutex_t mi_paged_mutex;
+  struct mdb_paged *mi_paged;
+  ID mi_paged_max;
+  ID mi_paged_used;
+  unsigned long mi_paged_gen;
+  uint32_t mi_paged_ttl;
+  /* candidate lists saved between pages
+   * of paged-results searches */
+
+  unsigned mi_search_threads;
+  /* helper threads loading and filtering
+   * the candidates of one search */
+#define MDB_PAR_SERIAL 0 /* mdb_par_take(): load it yourself */
+#define MDB_PAR_ENTRY 1  /* here it is, it matches */
+#define MDB_PAR_SKIP 2   /* it does not match */
+
+  int mi_subtree_ranges;
+  /* keep the range of IDs of each subtree
+   * to cut the candidates of a search */
+
+  unsigned mi_ngram_len;
+  /* gram length of n-gram indices without
+   * an ngramlen of their own */
+
   MDBX_dbi mi_dbis[MDB_NDB];
   AttributeDescription *mi_ads[MDB_MAXADS];
   int mi_adxs[MDB_MAXADS];
@@ -140,6 +193,8 @@ static __inline ID mdb_read_nextid(struct mdb_info *mdb) { return mdb->_mi_nexti
 #define mi_dn2id mi_dbis[MDB_DN2ID]
 #define mi_ad2id mi_dbis[MDB_AD2ID]
 #define mi_id2val mi_dbis[MDB_ID2VAL]
+#define mi_idl2bm mi_dbis[MDB_IDL2BM]
+#define mi_id2range mi_dbis[MDB_ID2RANGE]
 
 typedef struct mdb_op_info {
   OpExtra moi_oe;
@@ -167,8 +222,11 @@ typedef struct mdb_attrinfo {
   MDBX_cursor *ai_cursor; /* for tools */
   int ai_idx;             /* position in AI array */
   MDBX_dbi ai_dbi;
+  MDBX_dbi ai_odbi; /* ordered index keys */
+  MDBX_dbi ai_gdbi; /* n-gram index keys */
   unsigned ai_multi_hi;
   unsigned ai_multi_lo;
+  unsigned ai_ngram_len; /* 0 for the default */
 } AttrInfo;
 
 /* tool threaded indexer state */
@@ -42,6 +42,9 @@ enum {
   MDBX_DREAMCATCHER,
   MDBX_OOMFLAGS,
   MDB_MULTIVAL,
+  MDB_PAGEDCACHE,
+  MDB_SUBRANGES,
+  MDB_NGRAMLEN,
 };
 
 static ConfigTable mdbcfg[] = {
@@ -69,6 +72,12 @@ static ConfigTable mdbcfg[] = {
      "EQUALITY caseIgnoreMatch "
      "SYNTAX OMsDirectoryString )",
      NULL, NULL},
+    {"idlbitmap", "on|off", 2, 2, 0, ARG_ON_OFF | ARG_OFFSET, (void *)offsetof(struct mdb_info, mi_idl_bitmap),
+     "( OLcfgDbAt:12.7 NAME 'olcDbIdlBitmap' "
+     "DESC 'Keep oversized index slots as compressed bitmaps instead of ranges' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
     {"index", "attr> <[pres,eq,approx,sub]", 2, 3, 0, ARG_MAGIC | MDB_INDEX, mdb_cf_gen,
      "( OLcfgDbAt:0.2 NAME 'olcDbIndex' "
      "DESC 'Attribute index parameters' "
@@ -105,6 +114,18 @@ static ConfigTable mdbcfg[] = {
      "EQUALITY caseIgnoreMatch "
      "SYNTAX OMsDirectoryString )",
      NULL, NULL},
+    {"ngramlen", "attr> <len", 3, 3, 0, ARG_MAGIC | MDB_NGRAMLEN, mdb_cf_gen,
+     "( OLcfgDbAt:12.11 NAME 'olcDbNgramLen' "
+     "DESC 'Length of the n-grams kept by ngram indices of attr' "
+     "EQUALITY caseIgnoreMatch "
+     "SYNTAX OMsDirectoryString )",
+     NULL, NULL},
+    {"pagedcache", "ids> <seconds", 2, 3, 0, ARG_MAGIC | MDB_PAGEDCACHE, mdb_cf_gen,
+     "( OLcfgDbAt:12.8 NAME 'olcDbPagedCache' "
+     "DESC 'Size in IDs and idle timeout of candidate lists kept for paged searches' "
+     "EQUALITY caseIgnoreMatch "
+     "SYNTAX OMsDirectoryString SINGLE-VALUE )",
+     NULL, NULL},
     {"rtxnsize", "entries", 2, 2, 0, ARG_UINT | ARG_OFFSET, (void *)offsetof(struct mdb_info, mi_rtxn_size),
      "( OLcfgDbAt:12.5 NAME 'olcDbRtxnSize' "
      "DESC 'Number of entries to process in one read transaction' "
@@ -117,6 +138,18 @@ static ConfigTable mdbcfg[] = {
      "EQUALITY integerMatch "
      "SYNTAX OMsInteger SINGLE-VALUE )",
      NULL, NULL},
+    {"searchthreads", "num", 2, 2, 0, ARG_UINT | ARG_OFFSET, (void *)offsetof(struct mdb_info, mi_search_threads),
+     "( OLcfgDbAt:12.9 NAME 'olcDbSearchThreads' "
+     "DESC 'Number of helper threads loading and filtering the candidates of one search' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
+    {"subtreeranges", "on|off", 2, 2, 0, ARG_ON_OFF | ARG_MAGIC | MDB_SUBRANGES, mdb_cf_gen,
+     "( OLcfgDbAt:12.10 NAME 'olcDbSubtreeRanges' "
+     "DESC 'Keep the range of entry IDs of each subtree to narrow down search candidates' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
     {"dreamcatcher", "lag> <percentage", 3, 3, 0, ARG_MAGIC | MDBX_DREAMCATCHER, mdb_cf_gen,
      "( OLcfgDbAt:12.42 NAME 'olcDbDreamcatcher' "
      "DESC 'Dreamcatcher to avoids withhold of reclaiming' "
@@ -140,7 +173,8 @@ static ConfigOCs mdbocs[] = {{"( OLcfgDbOc:12.1 "
                               "olcDbNoSync $ olcDbIndex $ olcDbMaxReaders $ olcDbMaxSize $ "
                               "olcDbDreamcatcher $ olcDbOomFlags $ "
                               "olcDbMode $ olcDbSearchStack $ olcDbMaxEntrySize $ olcDbRtxnSize $ "
-                              "olcDbMultival ) )",
+                              "olcDbMultival $ olcDbIdlBitmap $ olcDbPagedCache $ olcDbSearchThreads $ "
+                              "olcDbSubtreeRanges $ olcDbNgramLen ) )",
                               Cft_Database, mdbcfg},
                              {NULL, 0, NULL}};
 
@@ -402,6 +436,10 @@ static int mdb_cf_gen(ConfigArgs *c) {
       c->value_int = mdb->mi_search_stack_depth;
       break;
 
+    case MDB_SUBRANGES:
+      c->value_int = mdb->mi_subtree_ranges;
+      break;
+
     case MDB_MAXREADERS:
       c->value_int = mdb->mi_readers;
       break;
@@ -415,6 +453,28 @@ static int mdb_cf_gen(ConfigArgs *c) {
       if (!c->rvalue_vals)
         rc = 1;
       break;
+
+    case MDB_NGRAMLEN:
+      mdb_attr_ngram_unparse(mdb, &c->rvalue_vals);
+      if (!c->rvalue_vals)
+        rc = 1;
+      break;
+
+    case MDB_PAGEDCACHE:
+      if (mdb->mi_paged_max) {
+        char buf[64];
+        struct berval bv;
+        bv.bv_len = snprintf(buf, sizeof(buf), "%lu %u", (unsigned long)mdb->mi_paged_max, mdb->mi_paged_ttl);
+        if (bv.bv_len > 0 && bv.bv_len < sizeof(buf)) {
+          bv.bv_val = buf;
+          value_add_one(&c->rvalue_vals, &bv);
+        } else {
+          rc = 1;
+        }
+      } else {
+        rc = 1;
+      }
+      break;
     }
     return rc;
   } else if (c->op == LDAP_MOD_DELETE) {
@@ -450,6 +510,11 @@ static int mdb_cf_gen(ConfigArgs *c) {
       mdb->mi_renew_lag = 0;
       mdb->mi_renew_percent = 0;
       break;
+    case MDB_PAGEDCACHE:
+      mdb->mi_paged_max = 0;
+      mdb->mi_paged_ttl = 0;
+      mdb_paged_destroy(mdb);
+      break;
     case MDB_DIRECTORY:
       mdb->mi_flags |= MDB_RE_OPEN;
       ch_free(mdb->mi_dbenv_home);
@@ -462,6 +527,15 @@ static int mdb_cf_gen(ConfigArgs *c) {
       mdb->mi_dbenv_flags &= ~MDBX_UTTERLY_NOSYNC;
       break;
 
+    case MDB_SUBRANGES:
+      mdb->mi_subtree_ranges = 0;
+      if (mdb->mi_flags & MDB_IS_OPEN) {
+        /* drop them on reopen */
+        mdb->mi_flags |= MDB_RE_OPEN;
+        c->cleanup = mdb_cf_cleanup;
+      }
+      break;
+
     case MDB_ENVFLAGS:
       if (c->valx == -1) {
         int i;
@@ -607,6 +681,57 @@ static int mdb_cf_gen(ConfigArgs *c) {
         }
       }
       break;
+    case MDB_NGRAMLEN:
+      if (c->valx == -1) {
+        int i;
+
+        /* delete all */
+        for (i = 0; i < mdb->mi_nattrs; i++)
+          mdb->mi_attrs[i]->ai_ngram_len = 0;
+        mdb->mi_ngram_len = 0;
+
+      } else {
+        struct berval bv, def = BER_BVC("default");
+        char *ptr;
+
+        for (ptr = c->line; !isspace((unsigned char)*ptr); ptr++)
+          ;
+
+        bv.bv_val = c->line;
+        bv.bv_len = ptr - bv.bv_val;
+        if (bvmatch(&bv, &def)) {
+          mdb->mi_ngram_len = 0;
+
+        } else {
+          int i;
+          char **attrs;
+          char sep;
+
+          sep = bv.bv_val[bv.bv_len];
+          bv.bv_val[bv.bv_len] = '\0';
+          attrs = ldap_str2charray(bv.bv_val, ",");
+
+          for (i = 0; attrs[i]; i++) {
+            AttributeDescription *ad = NULL;
+            const char *text;
+            AttrInfo *ai;
+
+            slap_str2ad(attrs[i], &ad, &text);
+            /* if we got here... */
+            assert(ad != NULL);
+
+            ai = mdb_attr_mask(mdb, ad);
+            /* if we got here... */
+            assert(ai != NULL);
+
+            ai->ai_ngram_len = 0;
+          }
+
+          bv.bv_val[bv.bv_len] = sep;
+          ldap_charray_free(attrs);
+        }
+      }
+      break;
     }
     return rc;
   }
@@ -829,6 +954,15 @@ static int mdb_cf_gen(ConfigArgs *c) {
     }
     break;
 
+  case MDB_SUBRANGES:
+    if (c->value_int != mdb->mi_subtree_ranges && (mdb->mi_flags & MDB_IS_OPEN)) {
+      /* they are built or dropped on reopen */
+      mdb->mi_flags |= MDB_RE_OPEN;
+      c->cleanup = mdb_cf_cleanup;
+    }
+    mdb->mi_subtree_ranges = c->value_int;
+    break;
+
   case MDB_SSTACK:
     if (c->value_int < MINIMUM_SEARCH_STACK_DEPTH) {
       fprintf(stderr, "%s: depth %d too small, using %d\n", c->log, c->value_int, MINIMUM_SEARCH_STACK_DEPTH);
@@ -859,6 +993,35 @@ static int mdb_cf_gen(ConfigArgs *c) {
     if (rc != LDAP_SUCCESS)
       return 1;
     break;
+
+  case MDB_NGRAMLEN:
+    rc = mdb_attr_ngram_config(mdb, c->fname, c->lineno, c->argc - 1, &c->argv[1], &c->reply);
+
+    if (rc != LDAP_SUCCESS)
+      return 1;
+    break;
+
+  case MDB_PAGEDCACHE: {
+    unsigned long l;
+    unsigned t = MDB_PAGED_TTL;
+    if (lutil_atoulx(&l, c->argv[1], 0) != 0) {
+      fprintf(stderr,
+              "%s: "
+              "invalid size \"%s\" in \"pagedcache\".\n",
+              c->log, c->argv[1]);
+      return ARG_BAD_CONF;
+    }
+    if (c->argc > 2 && lutil_atoux(&t, c->argv[2], 0) != 0) {
+      fprintf(stderr,
+              "%s: "
+              "invalid timeout \"%s\" in \"pagedcache\".\n",
+              c->log, c->argv[2]);
+      return ARG_BAD_CONF;
+    }
+    mdb_paged_destroy(mdb);
+    mdb->mi_paged_max = l;
+    mdb->mi_paged_ttl = t;
+  } break;
   }
   return 0;
 }
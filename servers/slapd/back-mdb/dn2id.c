@@ -181,6 +181,10 @@ int mdb_dn2id_add(Operation *op, MDBX_cursor *mcp, MDBX_cursor *mcd, ID pid, ID
     } while (nid);
   }
 
+  /* Widen the subtree ranges of all superiors */
+  if (rc == 0 && upsub && pid && mdb->mi_subtree_ranges)
+    rc = mdb_dn2id_range_add(op, mcp, pid, e->e_id);
+
   Debug(LDAP_DEBUG_TRACE, "<= mdb_dn2id_add 0x%lx: %d\n", e->e_id, rc);
 
   return rc;
@@ -591,8 +595,8 @@ int mdb_idscope(Operation *op, MDBX_txn *txn, ID base, ID *ids, ID *res) {
 
   ida = mdb_idl_first(ids, &cid);
 
-  /* Don't bother moving out of ids if it's a range */
-  if (!MDB_IDL_IS_RANGE(ids)) {
+  /* Don't bother moving out of ids if it's a range or a bitmap */
+  if (MDB_IDL_IS_LIST(ids)) {
     idc = ids[0];
     ci0 = cid;
   }
@@ -635,7 +639,7 @@ int mdb_idscope(Operation *op, MDBX_txn *txn, ID base, ID *ids, ID *res) {
     }
     ida = mdb_idl_next(ids, &cid);
   }
-  if (!MDB_IDL_IS_RANGE(ids))
+  if (MDB_IDL_IS_LIST(ids))
     ids[0] = idc;
 
 leave:
@@ -898,3 +902,187 @@ void mdb_dn2id_wrestore(Operation *op, IdScopes *isc) {
     isc->rdns[n].bv_val = d->nrdn + isc->nrdns[n].bv_len + 1;
   }
 }
+
+/* Subtree ranges.
+ *
+ * With subtreeranges enabled the id2r database keeps, for each entry that
+ * has (or once had) children, the lowest and highest entryID found in its
+ * subtree. Entries without a record span just their own ID. The bounds
+ * are only ever widened: deleting or moving entries leaves them loose but
+ * still covering the whole subtree, so a search may intersect its
+ * candidates with the range of its base and drop everything outside of it
+ * without walking any parent links. A record under NOID marks the ranges
+ * as complete.
+ */
+
+static int range_get(MDBX_txn *txn, MDBX_dbi dbi, ID id, ID *lo, ID *hi) {
+  MDBX_val key, data;
+  ID range[2];
+  int rc;
+
+  key.iov_base = &id;
+  key.iov_len = sizeof(ID);
+  rc = mdbx_get(txn, dbi, &key, &data);
+  if (rc == 0 && data.iov_len == sizeof(range)) {
+    memcpy(range, data.iov_base, sizeof(range));
+    *lo = range[0];
+    *hi = range[1];
+  } else if (rc == MDBX_NOTFOUND || rc == 0) {
+    *lo = id;
+    *hi = id;
+    rc = MDBX_NOTFOUND;
+  }
+  return rc;
+}
+
+/* Widen the range of id to cover lo..hi, returns MDBX_RESULT_TRUE if it
+ * already did.
+ */
+static int range_extend(MDBX_txn *txn, MDBX_dbi dbi, ID id, ID lo, ID hi) {
+  MDBX_val key, data;
+  ID range[2];
+  int rc;
+
+  rc = range_get(txn, dbi, id, &range[0], &range[1]);
+  if (rc && rc != MDBX_NOTFOUND)
+    return rc;
+  if (range[0] <= lo && range[1] >= hi)
+    return MDBX_RESULT_TRUE;
+  if (lo < range[0])
+    range[0] = lo;
+  if (hi > range[1])
+    range[1] = hi;
+
+  key.iov_base = &id;
+  key.iov_len = sizeof(ID);
+  data.iov_base = range;
+  data.iov_len = sizeof(range);
+  return mdbx_put(txn, dbi, &key, &data, 0);
+}
+
+/* Read the parent's ID from the node's own record */
+static int range_parent(MDBX_cursor *mc, ID id, ID *pid) {
+  MDBX_val key, data;
+  int rc;
+
+  key.iov_base = &id;
+  key.iov_len = sizeof(ID);
+  rc = mdbx_cursor_get(mc, &key, &data, MDBX_SET);
+  if (rc == 0)
+    memcpy(pid, (char *)data.iov_base + data.iov_len - sizeof(ID), sizeof(ID));
+  return rc;
+}
+
+int mdb_dn2id_range(Operation *op, MDBX_txn *txn, ID id, ID *lo, ID *hi) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  int rc;
+
+  if (!mdb->mi_id2range)
+    return MDBX_NOTFOUND;
+  rc = range_get(txn, mdb->mi_id2range, id, lo, hi);
+  if (rc == MDBX_NOTFOUND)
+    rc = 0;
+  return rc;
+}
+
+/* Add the range of a newly linked node to all of its superiors. Since the
+ * range of an entry always covers the ranges of its children, we can stop
+ * at the first superior which already covers it.
+ */
+int mdb_dn2id_range_add(Operation *op, MDBX_cursor *mc, ID pid, ID id) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  MDBX_txn *txn = mdbx_cursor_txn(mc);
+  ID lo, hi;
+  int rc;
+
+  rc = range_get(txn, mdb->mi_id2range, id, &lo, &hi);
+  if (rc && rc != MDBX_NOTFOUND)
+    return rc;
+
+  while (pid) {
+    rc = range_extend(txn, mdb->mi_id2range, pid, lo, hi);
+    if (rc == MDBX_RESULT_TRUE)
+      return 0;
+    if (rc)
+      return rc;
+    rc = range_parent(mc, pid, &pid);
+    if (rc)
+      return rc;
+  }
+  return 0;
+}
+
+/* Build the ranges from scratch if they're missing, or drop them if
+ * they're no longer wanted.
+ */
+int mdb_dn2id_ranges_open(BackendDB *be, MDBX_txn *txn) {
+  struct mdb_info *mdb = (struct mdb_info *)be->be_private;
+  MDBX_cursor *mc = NULL, *mp = NULL;
+  MDBX_val key, data;
+  ID id, pid, nid = NOID;
+  ID lo, hi, mark[2] = {NOID, NOID};
+  unsigned long n = 0;
+  int rc;
+
+  rc = range_get(txn, mdb->mi_id2range, NOID, &lo, &hi);
+  if (rc && rc != MDBX_NOTFOUND)
+    return rc;
+  if (!mdb->mi_subtree_ranges) {
+    if (rc)
+      return 0;
+    Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_dn2id_ranges_open) ": database \"%s\": dropping subtree ranges\n",
+          be->be_suffix[0].bv_val);
+    return mdbx_drop(txn, mdb->mi_id2range, 0);
+  }
+  if (!rc)
+    return 0;
+
+  Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_dn2id_ranges_open) ": database \"%s\": building subtree ranges\n",
+        be->be_suffix[0].bv_val);
+
+  rc = mdbx_drop(txn, mdb->mi_id2range, 0);
+  if (rc)
+    return rc;
+  rc = mdbx_cursor_open(txn, mdb->mi_dn2id, &mc);
+  if (rc)
+    return rc;
+  rc = mdbx_cursor_open(txn, mdb->mi_dn2id, &mp);
+  if (rc)
+    goto done;
+
+  for (rc = mdbx_cursor_get(mc, &key, &data, MDBX_FIRST); rc == 0;
+       rc = mdbx_cursor_get(mc, &key, &data, MDBX_NEXT_NODUP)) {
+    memcpy(&id, key.iov_base, sizeof(ID));
+    if (!id)
+      continue;
+    memcpy(&pid, (char *)data.iov_base + data.iov_len - sizeof(ID), sizeof(ID));
+    while (pid) {
+      rc = range_extend(txn, mdb->mi_id2range, pid, id, id);
+      if (rc == MDBX_RESULT_TRUE)
+        break;
+      if (rc)
+        goto done;
+      rc = range_parent(mp, pid, &pid);
+      if (rc)
+        goto done;
+    }
+    n++;
+  }
+  if (rc != MDBX_NOTFOUND)
+    goto done;
+
+  key.iov_base = &nid;
+  key.iov_len = sizeof(ID);
+  data.iov_base = mark;
+  data.iov_len = sizeof(mark);
+  rc = mdbx_put(txn, mdb->mi_id2range, &key, &data, 0);
+
+  Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_dn2id_ranges_open) ": database \"%s\": subtree ranges of %lu entries built\n",
+        be->be_suffix[0].bv_val, n);
+
+done:
+  if (mp)
+    mdbx_cursor_close(mp);
+  mdbx_cursor_close(mc);
+  return rc;
+}
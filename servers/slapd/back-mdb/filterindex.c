@@ -20,6 +20,7 @@
 
 #include "back-mdb.h"
 #include "idl.h"
+#include "lutil_hash.h"
 #ifdef LDAP_COMP_MATCH
 #include <component.h>
 #endif
@@ -28,11 +29,23 @@ static int presence_candidates(Operation *op, MDBX_txn *rtxn, AttributeDescripti
 
 static int equality_candidates(Operation *op, MDBX_txn *rtxn, AttributeAssertion *ava, ID *ids, ID *tmp);
 static int inequality_candidates(Operation *op, MDBX_txn *rtxn, AttributeAssertion *ava, ID *ids, ID *tmp, int gtorlt);
+static int ordered_index(Operation *op, AttributeDescription *desc);
+static int ordered_candidates(Operation *op, MDBX_txn *rtxn, AttributeDescription *desc, struct berval *lo,
+                              struct berval *hi, ID *ids, ID *tmp);
 static int approx_candidates(Operation *op, MDBX_txn *rtxn, AttributeAssertion *ava, ID *ids, ID *tmp);
 static int substring_candidates(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub, ID *ids, ID *tmp);
+static AttrInfo *ngram_index(Operation *op, AttributeDescription *desc);
+static int ngram_candidates(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub, ID *ids, ID *tmp, ID *stack,
+                            int *exact);
+static int ngram_verify(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub, ID *ids);
+static ID ngram_cost(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub);
 
 static int list_candidates(Operation *op, MDBX_txn *rtxn, Filter *flist, int ftype, ID *ids, ID *tmp, ID *stack);
 
+static ID filter_cost(Operation *op, MDBX_txn *rtxn, Filter *f);
+
+static struct berval *ordered_key(Operation *op, AttributeDescription *desc, struct berval *val, MDBX_val *key);
+
 static int ext_candidates(Operation *op, MDBX_txn *rtxn, MatchingRuleAssertion *mra, ID *ids, ID *tmp, ID *stack);
 
 #ifdef LDAP_COMP_MATCH
@@ -98,14 +111,19 @@ int mdb_filter_candidates(Operation *op, MDBX_txn *rtxn, Filter *f, ID *ids, ID
 
   case LDAP_FILTER_SUBSTRINGS:
     Debug(LDAP_DEBUG_FILTER, "\tSUBSTRINGS\n");
-    rc = substring_candidates(op, rtxn, f->f_sub, ids, tmp);
+    if (ngram_index(op, f->f_sub_desc))
+      rc = ngram_candidates(op, rtxn, f->f_sub, ids, tmp, stack, NULL);
+    else
+      rc = substring_candidates(op, rtxn, f->f_sub, ids, tmp);
     break;
 
   case LDAP_FILTER_GE:
     /* if no GE index, use pres */
     Debug(LDAP_DEBUG_FILTER, "\tGE\n");
-    if (f->f_ava->aa_desc->ad_type->sat_ordering &&
-        (f->f_ava->aa_desc->ad_type->sat_ordering->smr_usage & SLAP_MR_ORDERED_INDEX))
+    if (ordered_index(op, f->f_ava->aa_desc))
+      rc = ordered_candidates(op, rtxn, f->f_ava->aa_desc, &f->f_ava->aa_value, NULL, ids, tmp);
+    else if (f->f_ava->aa_desc->ad_type->sat_ordering &&
+             (f->f_ava->aa_desc->ad_type->sat_ordering->smr_usage & SLAP_MR_ORDERED_INDEX))
       rc = inequality_candidates(op, rtxn, f->f_ava, ids, tmp, LDAP_FILTER_GE);
     else
       rc = presence_candidates(op, rtxn, f->f_ava->aa_desc, ids);
@@ -114,8 +132,10 @@ int mdb_filter_candidates(Operation *op, MDBX_txn *rtxn, Filter *f, ID *ids, ID
   case LDAP_FILTER_LE:
     /* if no LE index, use pres */
     Debug(LDAP_DEBUG_FILTER, "\tLE\n");
-    if (f->f_ava->aa_desc->ad_type->sat_ordering &&
-        (f->f_ava->aa_desc->ad_type->sat_ordering->smr_usage & SLAP_MR_ORDERED_INDEX))
+    if (ordered_index(op, f->f_ava->aa_desc))
+      rc = ordered_candidates(op, rtxn, f->f_ava->aa_desc, NULL, &f->f_ava->aa_value, ids, tmp);
+    else if (f->f_ava->aa_desc->ad_type->sat_ordering &&
+             (f->f_ava->aa_desc->ad_type->sat_ordering->smr_usage & SLAP_MR_ORDERED_INDEX))
       rc = inequality_candidates(op, rtxn, f->f_ava, ids, tmp, LDAP_FILTER_LE);
     else
       rc = presence_candidates(op, rtxn, f->f_ava->aa_desc, ids);
@@ -176,6 +196,122 @@ out:
   return rc;
 }
 
+/* Can the index of desc answer the ftype term exactly? That is when
+ * its slots list the entries matching the term and no others: the
+ * index belongs to desc itself rather than to a supertype, includes
+ * all tags and subtypes, and equality keys are 64-bit hashes of the
+ * normalized values (see ITS#8678 in modify.c). Substrings need an
+ * ngram index, whose candidates are verified where the grams don't
+ * settle the match.
+ */
+static int exact_index(Operation *op, AttributeDescription *desc, int ftype) {
+  AttrInfo *ai;
+  MatchingRule *mr;
+
+  if (ftype == LDAP_FILTER_EQUALITY && desc == slap_schema.si_ad_entryDN)
+    return 1; /* looked up in dn2id */
+
+  if (slap_ad_is_tagged(desc))
+    return 0;
+  ai = mdb_attr_mask(op->o_bd->be_private, desc);
+  if (!ai || ai->ai_newmask || (ai->ai_indexmask & (MDB_INDEX_DELETING | SLAP_INDEX_NOTAGS | SLAP_INDEX_NOSUBTYPES)))
+    return 0;
+
+  if (ftype == LDAP_FILTER_PRESENT)
+    return IS_SLAP_INDEX(ai->ai_indexmask, SLAP_INDEX_PRESENT);
+
+  if (ftype == LDAP_FILTER_SUBSTRINGS)
+    return IS_SLAP_INDEX(ai->ai_indexmask, SLAP_INDEX_NGRAM) && ai->ai_gdbi && mdb_index_ngram_rule(desc->ad_type);
+
+#ifdef LUTIL_HASH64_BYTES
+  /* objectClass keys are the names of the classes and of all their
+   * superclasses, the caller checks the asserted name */
+  mr = desc->ad_type->sat_equality;
+  return IS_SLAP_INDEX(ai->ai_indexmask, SLAP_INDEX_EQUALITY) && mr &&
+         (mr->smr_indexer == octetStringIndexer || desc == slap_schema.si_ad_objectClass) && slap_hash64(-1);
+#else
+  (void)mr;
+  return 0;
+#endif
+}
+
+/* Evaluate the filter from the indices alone, for searches which
+ * need nothing from the entries but their DNs. Unlike
+ * mdb_filter_candidates() the result is not a superset: it is
+ * exactly the set of entries matching the filter. Returns
+ * MDBX_RESULT_TRUE when some term of the filter can't be resolved
+ * that way, the caller should fall back to mdb_filter_candidates().
+ */
+int mdb_filter_exact(Operation *op, MDBX_txn *rtxn, Filter *f, ID *ids, ID *tmp, ID *stack) {
+  int rc = MDBX_RESULT_TRUE;
+  Filter *g;
+
+  switch (f->f_choice) {
+  case SLAPD_FILTER_COMPUTED:
+    if (f->f_result == LDAP_COMPARE_FALSE || f->f_result == SLAPD_COMPARE_UNDEFINED) {
+      MDB_IDL_ZERO(ids);
+      rc = 0;
+    }
+    break;
+
+  case LDAP_FILTER_PRESENT:
+    if (exact_index(op, f->f_desc, LDAP_FILTER_PRESENT))
+      rc = presence_candidates(op, rtxn, f->f_desc, ids);
+    break;
+
+  case LDAP_FILTER_EQUALITY:
+    if (f->f_av_desc == slap_schema.si_ad_objectClass) {
+      ObjectClass *oc = oc_bvfind(&f->f_av_value);
+      if (!oc || !bvmatch(&oc->soc_cname, &f->f_av_value))
+        break;
+    }
+    if (exact_index(op, f->f_av_desc, LDAP_FILTER_EQUALITY))
+      rc = equality_candidates(op, rtxn, f->f_ava, ids, tmp);
+    break;
+
+  case LDAP_FILTER_SUBSTRINGS:
+    if (exact_index(op, f->f_sub_desc, LDAP_FILTER_SUBSTRINGS)) {
+      int exact;
+      rc = ngram_candidates(op, rtxn, f->f_sub, ids, tmp, stack, &exact);
+      /* ngram_verify() walks a plain list, ranges and bitmaps can't
+       * be verified in place and are left to the caller */
+      if (rc == 0 && !exact)
+        rc = MDB_IDL_IS_LIST(ids) ? ngram_verify(op, rtxn, f->f_sub, ids) : MDBX_RESULT_TRUE;
+    }
+    break;
+
+  case LDAP_FILTER_AND:
+  case LDAP_FILTER_OR:
+    rc = 0;
+    for (g = f->f_list; g != NULL; g = g->f_next) {
+      rc = mdb_filter_exact(op, rtxn, g, stack, tmp, stack + MDB_IDL_UM_SIZE);
+      if (rc)
+        break;
+      if (g == f->f_list) {
+        MDB_IDL_CPY(ids, stack);
+      } else if (f->f_choice == LDAP_FILTER_AND) {
+        mdb_idl_intersection(ids, stack);
+      } else {
+        mdb_idl_union(ids, stack);
+      }
+      /* an empty intersection stays empty whatever the other terms are */
+      if (f->f_choice == LDAP_FILTER_AND && MDB_IDL_IS_ZERO(ids))
+        break;
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  /* a range is only an upper bound of the matches */
+  if (rc == 0 && MDB_IDL_IS_RANGE(ids))
+    rc = MDBX_RESULT_TRUE;
+
+  Debug(LDAP_DEBUG_FILTER, "<= mdb_filter_exact: rc=%d id=%ld\n", rc, rc ? 0L : (long)ids[0]);
+  return rc;
+}
+
 #ifdef LDAP_COMP_MATCH
 static int comp_list_candidates(Operation *op, MDBX_txn *rtxn, MatchingRuleAssertion *mra, ComponentFilter *flist,
                                 int ftype, ID *ids, ID *tmp, ID *save) {
@@ -429,18 +565,219 @@ static int ext_candidates(Operation *op, MDBX_txn *rtxn, MatchingRuleAssertion *
   return 0;
 }
 
+/* Estimated number of candidates of a key-based index lookup,
+ * the smallest slot of all the keys since they are intersected.
+ */
+static ID keys_cost(Operation *op, MDBX_txn *rtxn, AttributeDescription *desc, int ftype, MatchingRule *mr,
+                    void *assertion) {
+  MDBX_dbi dbi;
+  slap_mask_t mask;
+  struct berval prefix = {0, NULL};
+  struct berval *keys = NULL;
+  ID cost = NOID, n;
+  int i, rc;
+
+  if (!mr || !mr->smr_filter)
+    return NOID;
+
+  rc = mdb_index_param(op->o_bd, desc, ftype, &dbi, &mask, &prefix);
+  if (rc != LDAP_SUCCESS)
+    return NOID;
+
+  if (ftype == LDAP_FILTER_PRESENT) {
+    if (prefix.bv_val == NULL)
+      return NOID;
+    rc = mdb_key_count(rtxn, dbi, &prefix, &n);
+    return rc == MDBX_NOTFOUND ? 0 : rc ? NOID : n;
+  }
+
+  rc = (mr->smr_filter)(ftype, mask, desc->ad_type->sat_syntax, mr, &prefix, assertion, &keys, op->o_tmpmemctx);
+  if (rc != LDAP_SUCCESS || keys == NULL)
+    return NOID;
+
+  for (i = 0; keys[i].bv_val != NULL; i++) {
+    rc = mdb_key_count(rtxn, dbi, &keys[i], &n);
+    if (rc == MDBX_NOTFOUND) {
+      cost = 0;
+      break;
+    }
+    if (rc == 0 && n < cost)
+      cost = n;
+  }
+  ber_bvarray_free_x(keys, op->o_tmpmemctx);
+  return cost;
+}
+
+/* Estimated number of IDs within lo..hi of an ordered index */
+static ID ordered_cost(Operation *op, MDBX_txn *rtxn, AttributeDescription *desc, struct berval *lo,
+                       struct berval *hi) {
+  MDBX_dbi dbi;
+  slap_mask_t mask;
+  struct berval prefix = {0, NULL};
+  struct berval *lokeys = NULL, *hikeys = NULL;
+  MDBX_val lokey, hikey;
+  ptrdiff_t n;
+  ID cost = NOID;
+
+  if (mdb_index_param(op->o_bd, desc, LDAP_FILTER_GE, &dbi, &mask, &prefix) != LDAP_SUCCESS)
+    return NOID;
+  if ((!lo || (lokeys = ordered_key(op, desc, lo, &lokey))) && (!hi || (hikeys = ordered_key(op, desc, hi, &hikey))) &&
+      mdbx_estimate_range(rtxn, dbi, lokeys ? &lokey : NULL, NULL, hikeys ? &hikey : NULL, NULL, &n) == 0)
+    cost = n > 0 ? (ID)n : 0;
+  if (lokeys)
+    ber_bvarray_free_x(lokeys, op->o_tmpmemctx);
+  if (hikeys)
+    ber_bvarray_free_x(hikeys, op->o_tmpmemctx);
+  return cost;
+}
+
+/* Estimate the number of candidates a filter yields, without reading
+ * any IDL. NOID means unknown or not indexed.
+ */
+static ID filter_cost(Operation *op, MDBX_txn *rtxn, Filter *f) {
+  AttributeType *at;
+  ID cost, c;
+
+  if (f->f_choice & SLAPD_FILTER_UNDEFINED)
+    return 0;
+
+  switch (f->f_choice) {
+  case SLAPD_FILTER_COMPUTED:
+    return (f->f_result == LDAP_COMPARE_FALSE || f->f_result == SLAPD_COMPARE_UNDEFINED) ? 0 : NOID;
+
+  case LDAP_FILTER_PRESENT:
+    if (f->f_desc == slap_schema.si_ad_objectClass)
+      return NOID;
+    return keys_cost(op, rtxn, f->f_desc, LDAP_FILTER_PRESENT, f->f_desc->ad_type->sat_equality, NULL);
+
+  case LDAP_FILTER_EQUALITY:
+    if (f->f_ava->aa_desc == slap_schema.si_ad_entryDN)
+      return 1;
+#ifdef LDAP_COMP_MATCH
+    if (is_aliased_attribute && is_aliased_attribute(f->f_ava->aa_desc))
+      return NOID;
+#endif
+    at = f->f_ava->aa_desc->ad_type;
+    return keys_cost(op, rtxn, f->f_ava->aa_desc, LDAP_FILTER_EQUALITY, at->sat_equality, &f->f_ava->aa_value);
+
+  case LDAP_FILTER_APPROX:
+    at = f->f_ava->aa_desc->ad_type;
+    return keys_cost(op, rtxn, f->f_ava->aa_desc, LDAP_FILTER_APPROX, at->sat_approx ? at->sat_approx : at->sat_equality,
+                     &f->f_ava->aa_value);
+
+  case LDAP_FILTER_SUBSTRINGS:
+    if (ngram_index(op, f->f_sub_desc))
+      return ngram_cost(op, rtxn, f->f_sub);
+    return keys_cost(op, rtxn, f->f_sub->sa_desc, LDAP_FILTER_SUBSTRINGS, f->f_sub->sa_desc->ad_type->sat_substr,
+                     f->f_sub);
+
+  case LDAP_FILTER_AND:
+    cost = NOID;
+    for (f = f->f_and; f != NULL; f = f->f_next) {
+      if (f->f_choice == SLAPD_FILTER_COMPUTED && f->f_result == LDAP_SUCCESS)
+        continue;
+      c = filter_cost(op, rtxn, f);
+      if (c < cost)
+        cost = c;
+      if (!cost)
+        break;
+    }
+    return cost;
+
+  case LDAP_FILTER_OR:
+    cost = 0;
+    for (f = f->f_or; f != NULL; f = f->f_next) {
+      c = filter_cost(op, rtxn, f);
+      cost = (c >= NOID - cost) ? NOID : cost + c;
+      if (cost == NOID)
+        break;
+    }
+    return cost;
+
+  case LDAP_FILTER_GE:
+  case LDAP_FILTER_LE:
+    return ordered_cost(op, rtxn, f->f_ava->aa_desc, f->f_choice == LDAP_FILTER_GE ? &f->f_ava->aa_value : NULL,
+                        f->f_choice == LDAP_FILTER_LE ? &f->f_ava->aa_value : NULL);
+
+  default:
+    /* NOT and extensible matches */
+    return NOID;
+  }
+}
+
+/* Stop intersecting AND terms once the candidates are this many times
+ * fewer than the IDs the next term would read: testing the entries
+ * against the filter is then cheaper than narrowing the list further.
+ */
+#define MDB_AND_STOP_RATIO 16
+
+struct filter_term {
+  Filter *f;
+  ID cost;
+};
+
+/* Index of a later term which bounds the attribute of term i from the
+ * other side, so that both are answered by one ordered index walk.
+ * 0 if there is none.
+ */
+static int range_pair(Operation *op, struct filter_term *terms, int i, int n) {
+  Filter *f = terms[i].f, *g;
+  int j;
+
+  if ((f->f_choice != LDAP_FILTER_GE && f->f_choice != LDAP_FILTER_LE) || !ordered_index(op, f->f_ava->aa_desc))
+    return 0;
+  for (j = i + 1; j < n; j++) {
+    g = terms[j].f;
+    if ((g->f_choice == LDAP_FILTER_GE || g->f_choice == LDAP_FILTER_LE) && g->f_choice != f->f_choice &&
+        g->f_ava->aa_desc == f->f_ava->aa_desc)
+      return j;
+  }
+  return 0;
+}
+
 static int list_candidates(Operation *op, MDBX_txn *rtxn, Filter *flist, int ftype, ID *ids, ID *tmp, ID *save) {
   int rc = 0;
   Filter *f;
+  struct filter_term *terms, term;
+  int i, j, n, first = 1;
 
   Debug(LDAP_DEBUG_FILTER, "=> mdb_list_candidates 0x%x\n", ftype);
-  for (f = flist; f != NULL; f = f->f_next) {
+
+  for (n = 0, f = flist; f != NULL; f = f->f_next)
+    n++;
+  terms = op->o_tmpalloc(n * sizeof(*terms), op->o_tmpmemctx);
+  for (n = 0, f = flist; f != NULL; f = f->f_next) {
     /* ignore precomputed scopes */
     if (f->f_choice == SLAPD_FILTER_COMPUTED && f->f_result == LDAP_SUCCESS) {
       continue;
     }
+    term.f = f;
+    term.cost = 0;
+    j = n++;
+    if (ftype == LDAP_FILTER_AND && flist->f_next) {
+      /* evaluate the most selective terms first,
+       * keeping the client's order among equals */
+      term.cost = filter_cost(op, rtxn, f);
+      for (; j > 0 && terms[j - 1].cost > term.cost; j--)
+        terms[j] = terms[j - 1];
+    }
+    terms[j] = term;
+  }
+
+  for (i = 0; i < n; i++) {
+    f = terms[i].f;
     MDB_IDL_ZERO(save);
-    rc = mdb_filter_candidates(op, rtxn, f, save, tmp, save + MDB_IDL_UM_SIZE);
+    if (ftype == LDAP_FILTER_AND && (j = range_pair(op, terms, i, n)) > 0) {
+      Filter *ge = f->f_choice == LDAP_FILTER_GE ? f : terms[j].f;
+      Filter *le = f->f_choice == LDAP_FILTER_LE ? f : terms[j].f;
+
+      Debug(LDAP_DEBUG_FILTER, "\tRANGE\n");
+      rc = ordered_candidates(op, rtxn, f->f_ava->aa_desc, &ge->f_ava->aa_value, &le->f_ava->aa_value, save, tmp);
+      for (n--; j < n; j++)
+        terms[j] = terms[j + 1];
+    } else {
+      rc = mdb_filter_candidates(op, rtxn, f, save, tmp, save + MDB_IDL_UM_SIZE);
+    }
 
     if (rc != 0) {
       if (ftype == LDAP_FILTER_AND) {
@@ -451,22 +788,30 @@ static int list_candidates(Operation *op, MDBX_txn *rtxn, Filter *flist, int fty
     }
 
     if (ftype == LDAP_FILTER_AND) {
-      if (f == flist) {
+      if (first) {
         MDB_IDL_CPY(ids, save);
       } else {
         mdb_idl_intersection(ids, save);
       }
       if (MDB_IDL_IS_ZERO(ids))
         break;
+      if (i + 1 < n && MDB_IDL_IS_LIST(ids) && ids[0] <= terms[i + 1].cost / MDB_AND_STOP_RATIO) {
+        Debug(LDAP_DEBUG_FILTER, "<= mdb_list_candidates: %ld candidates, skip %d more term(s)\n", (long)ids[0],
+              n - i - 1);
+        break;
+      }
     } else {
-      if (f == flist) {
+      if (first) {
         MDB_IDL_CPY(ids, save);
       } else {
         mdb_idl_union(ids, save);
       }
     }
+    first = 0;
   }
 
+  op->o_tmpfree(terms, op->o_tmpmemctx);
+
   if (rc == LDAP_SUCCESS) {
     Debug(LDAP_DEBUG_FILTER, "<= mdb_list_candidates: id=%ld first=%ld last=%ld\n", (long)ids[0],
           (long)MDB_IDL_FIRST(ids), (long)MDB_IDL_LAST(ids));
@@ -829,6 +1174,297 @@ static int substring_candidates(Operation *op, MDBX_txn *rtxn, SubstringsAsserti
   return (rc);
 }
 
+/* The ngram index to resolve substrings of desc with, if any */
+static AttrInfo *ngram_index(Operation *op, AttributeDescription *desc) {
+  struct berval name;
+  AttrInfo *ai;
+
+  if (!mdb_index_ngram_rule(desc->ad_type))
+    return NULL;
+  ai = mdb_index_mask(op->o_bd, desc, &name);
+  if (!ai || !IS_SLAP_INDEX(ai->ai_indexmask, SLAP_INDEX_NGRAM) || !ai->ai_gdbi)
+    return NULL;
+  return ai;
+}
+
+/* The next non-empty piece of a substrings assertion and the kind of
+ * its n-gram keys, *state starts at zero. NULL after the last one.
+ */
+static struct berval *ngram_next(SubstringsAssertion *sub, int *state, int *kind) {
+  struct berval *piece;
+  int k;
+
+  while (*state >= 0) {
+    k = (*state)++;
+    if (k == 0) {
+      *kind = MDB_NGRAM_INITIAL;
+      piece = &sub->sa_initial;
+    } else if (sub->sa_any && !BER_BVISNULL(&sub->sa_any[k - 1])) {
+      *kind = MDB_NGRAM_ANY;
+      piece = &sub->sa_any[k - 1];
+    } else {
+      *kind = MDB_NGRAM_FINAL;
+      piece = &sub->sa_final;
+      *state = -1;
+    }
+    if (!BER_BVISNULL(piece) && piece->bv_len)
+      return piece;
+  }
+  return NULL;
+}
+
+/* Bounds of the n-gram keys a piece of up to ngramlen bytes prefixes */
+struct ngram_prefix {
+  unsigned char lo[1 + MDB_NGRAM_MAX];
+  unsigned char hi[1 + MDB_NGRAM_MAX + sizeof(ID)];
+  MDBX_val lokey, hikey;
+};
+
+static void ngram_prefix(struct ngram_prefix *np, int kind, struct berval *piece) {
+  ber_len_t k, len = piece->bv_len;
+
+  np->lo[0] = np->hi[0] = kind;
+  for (k = 0; k < len; k++)
+    np->lo[k + 1] = np->hi[k + 1] = kind == MDB_NGRAM_FINAL ? piece->bv_val[len - 1 - k] : piece->bv_val[k];
+  memset(np->hi + len + 1, 0xff, sizeof(np->hi) - len - 1);
+  np->lokey.iov_base = np->lo;
+  np->lokey.iov_len = len + 1;
+  np->hikey.iov_base = np->hi;
+  np->hikey.iov_len = sizeof(np->hi);
+}
+
+/* Read the IDL of one n-gram key */
+static int ngram_read(Operation *op, MDBX_txn *rtxn, MDBX_dbi dbi, int kind, const char *src, ber_len_t n,
+                      int reverse, ID *ids) {
+  struct berval key;
+  int rc;
+
+  mdb_index_ngram_key(&key, kind, src, n, reverse, op->o_tmpmemctx);
+  rc = mdb_key_read(op->o_bd, rtxn, dbi, &key, ids, NULL, 0);
+  slap_sl_free(key.bv_val, op->o_tmpmemctx);
+  if (rc == MDBX_NOTFOUND) {
+    MDB_IDL_ZERO(ids);
+    rc = 0;
+  }
+  return rc;
+}
+
+/* The entries having a value with the piece at the kind of position.
+ * A piece of up to n bytes is the prefix of the keys to collect, which
+ * gives exactly those entries. A longer one is looked up by its grams,
+ * which can also match entries having all of them apart.
+ */
+static int ngram_piece(Operation *op, MDBX_txn *rtxn, MDBX_dbi dbi, unsigned n, int kind, struct berval *piece,
+                       ID *ids, ID *tmp, ID limit) {
+  const char *p = piece->bv_val;
+  ber_len_t k, len = piece->bv_len;
+  int rc = 0;
+
+  if (len <= n) {
+    struct ngram_prefix np;
+
+    ngram_prefix(&np, kind, piece);
+    return mdb_idl_fetch_range(op->o_bd, rtxn, dbi, &np.lokey, &np.hikey, ids, tmp, limit);
+  }
+
+  if (kind == MDB_NGRAM_ANY)
+    MDB_IDL_ALL(ids);
+  else
+    rc = ngram_read(op, rtxn, dbi, kind, kind == MDB_NGRAM_FINAL ? p + len - n : p, n, kind == MDB_NGRAM_FINAL, ids);
+  /* the grams at the ends were read already */
+  for (k = kind == MDB_NGRAM_INITIAL; rc == 0 && !MDB_IDL_IS_ZERO(ids) && k + n + (kind == MDB_NGRAM_FINAL) <= len;
+       k++) {
+    rc = ngram_read(op, rtxn, dbi, MDB_NGRAM_ANY, p + k, n, 0, tmp);
+    if (rc == 0)
+      mdb_idl_intersection(ids, tmp);
+  }
+  return rc;
+}
+
+/* Candidates of a substrings assertion from an ngram index, the
+ * intersection of those of its pieces. They are the exact matches
+ * when there is a single piece of up to ngramlen bytes, *exact
+ * tells whether that is the case.
+ */
+static int ngram_candidates(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub, ID *ids, ID *tmp, ID *stack,
+                            int *exact) {
+  AttrInfo *ai = ngram_index(op, sub->sa_desc);
+  struct berval *piece;
+  ID limit = NOID;
+  unsigned n;
+  int kind, state = 0, npieces = 0, rc = 0;
+
+  Debug(LDAP_DEBUG_TRACE, "=> mdb_ngram_candidates (%s)\n", sub->sa_desc->ad_cname.bv_val);
+
+  MDB_IDL_ALL(ids);
+  if (exact)
+    *exact = 0;
+  if (!ai)
+    return 0;
+  n = mdb_attr_ngram_len(op->o_bd->be_private, ai);
+  if (op->ors_limit && op->ors_limit->lms_s_unchecked != -1)
+    limit = (unsigned)op->ors_limit->lms_s_unchecked;
+
+  while (rc == 0 && !MDB_IDL_IS_ZERO(ids) && (piece = ngram_next(sub, &state, &kind)) != NULL) {
+    if (exact)
+      *exact = !npieces && piece->bv_len <= n;
+    if (!npieces++) {
+      rc = ngram_piece(op, rtxn, ai->ai_gdbi, n, kind, piece, ids, tmp, limit);
+    } else {
+      rc = ngram_piece(op, rtxn, ai->ai_gdbi, n, kind, piece, stack, tmp, limit);
+      if (rc == 0)
+        mdb_idl_intersection(ids, stack);
+    }
+  }
+
+  if (rc != 0) {
+    Debug(LDAP_DEBUG_TRACE, "<= mdb_ngram_candidates: (%s) key read failed (%d)\n", sub->sa_desc->ad_cname.bv_val,
+          rc);
+    MDB_IDL_ALL(ids);
+    return rc;
+  }
+
+  Debug(LDAP_DEBUG_TRACE, "<= mdb_ngram_candidates: id=%ld, first=%ld, last=%ld\n", (long)ids[0],
+        (long)MDB_IDL_FIRST(ids), (long)MDB_IDL_LAST(ids));
+  return 0;
+}
+
+/* Drop the candidates not matching the substrings assertion, testing
+ * the stored entries without decoding them. MDBX_RESULT_TRUE when some
+ * candidate can't be told that way.
+ */
+static int ngram_verify(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub, ID *ids) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  MDBX_cursor *mc;
+  ID i, j;
+  int rc;
+
+  rc = mdbx_cursor_open(rtxn, mdb->mi_id2entry, &mc);
+  if (rc)
+    return rc;
+  for (i = 1, j = 0; i <= ids[0]; i++) {
+    rc = mdb_entry_substrings(op, mc, ids[i], sub);
+    if (rc == LDAP_COMPARE_TRUE) {
+      ids[++j] = ids[i];
+    } else if (rc != LDAP_COMPARE_FALSE) {
+      rc = MDBX_RESULT_TRUE;
+      break;
+    }
+  }
+  mdbx_cursor_close(mc);
+  if (i <= ids[0])
+    return rc;
+
+  Debug(LDAP_DEBUG_TRACE, "<= mdb_ngram_verify: %ld of %ld\n", (long)j, (long)ids[0]);
+  ids[0] = j;
+  return 0;
+}
+
+/* Estimated number of candidates from an ngram index, the smallest
+ * count of the grams the pieces start with or of those they prefix.
+ */
+static ID ngram_cost(Operation *op, MDBX_txn *rtxn, SubstringsAssertion *sub) {
+  AttrInfo *ai = ngram_index(op, sub->sa_desc);
+  struct berval *piece, key;
+  ID cost = NOID, c;
+  unsigned n;
+  int kind, state = 0;
+
+  n = mdb_attr_ngram_len(op->o_bd->be_private, ai);
+  while (cost && (piece = ngram_next(sub, &state, &kind)) != NULL) {
+    c = NOID;
+    if (piece->bv_len > n) {
+      if (kind == MDB_NGRAM_FINAL)
+        mdb_index_ngram_key(&key, kind, piece->bv_val + piece->bv_len - n, n, 1, op->o_tmpmemctx);
+      else
+        mdb_index_ngram_key(&key, kind, piece->bv_val, n, 0, op->o_tmpmemctx);
+      if (mdb_key_count(rtxn, ai->ai_gdbi, &key, &c) == MDBX_NOTFOUND)
+        c = 0;
+      slap_sl_free(key.bv_val, op->o_tmpmemctx);
+    } else {
+      struct ngram_prefix np;
+      ptrdiff_t d;
+
+      ngram_prefix(&np, kind, piece);
+      if (mdbx_estimate_range(rtxn, ai->ai_gdbi, &np.lokey, NULL, &np.hikey, NULL, &d) == 0)
+        c = d > 0 ? (ID)d : 0;
+    }
+    if (c < cost)
+      cost = c;
+  }
+  return cost;
+}
+
+/* Whether the attribute has an ordered index */
+static int ordered_index(Operation *op, AttributeDescription *desc) {
+  MDBX_dbi dbi;
+  slap_mask_t mask;
+  struct berval prefix = {0, NULL};
+
+  return mdb_index_param(op->o_bd, desc, LDAP_FILTER_GE, &dbi, &mask, &prefix) == LDAP_SUCCESS;
+}
+
+/* The ordered index key of an assertion value, NULL if there is none */
+static struct berval *ordered_key(Operation *op, AttributeDescription *desc, struct berval *val, MDBX_val *key) {
+  struct berval vals[2], *keys = NULL;
+
+  vals[0] = *val;
+  BER_BVZERO(&vals[1]);
+  if (mdb_index_ordered_keys(desc->ad_type, vals, &keys, op->o_tmpmemctx) != LDAP_SUCCESS || !keys)
+    return NULL;
+  key->iov_base = keys[0].bv_val;
+  key->iov_len = keys[0].bv_len;
+  return keys;
+}
+
+/* Candidates of lo <= value <= hi by a range walk of an ordered index,
+ * a NULL bound leaves that end open. Without an ordered index fall back
+ * to the presence index like inequalities always did.
+ */
+static int ordered_candidates(Operation *op, MDBX_txn *rtxn, AttributeDescription *desc, struct berval *lo,
+                              struct berval *hi, ID *ids, ID *tmp) {
+  MDBX_dbi dbi;
+  int rc;
+  slap_mask_t mask;
+  struct berval prefix = {0, NULL};
+  struct berval *lokeys = NULL, *hikeys = NULL;
+  MDBX_val lokey, hikey;
+  ID limit = NOID;
+
+  Debug(LDAP_DEBUG_TRACE, "=> mdb_ordered_candidates (%s)\n", desc->ad_cname.bv_val);
+
+  rc = mdb_index_param(op->o_bd, desc, LDAP_FILTER_GE, &dbi, &mask, &prefix);
+  if (rc != LDAP_SUCCESS) {
+    Debug(LDAP_DEBUG_TRACE, "<= mdb_ordered_candidates: (%s) not indexed\n", desc->ad_cname.bv_val);
+    return presence_candidates(op, rtxn, desc, ids);
+  }
+
+  if ((lo && !(lokeys = ordered_key(op, desc, lo, &lokey))) || (hi && !(hikeys = ordered_key(op, desc, hi, &hikey)))) {
+    Debug(LDAP_DEBUG_TRACE, "<= mdb_ordered_candidates: (%s) no keys\n", desc->ad_cname.bv_val);
+    if (lokeys)
+      ber_bvarray_free_x(lokeys, op->o_tmpmemctx);
+    return presence_candidates(op, rtxn, desc, ids);
+  }
+
+  if (op->ors_limit && op->ors_limit->lms_s_unchecked != -1)
+    limit = (unsigned)op->ors_limit->lms_s_unchecked;
+
+  rc = mdb_idl_fetch_range(op->o_bd, rtxn, dbi, lokeys ? &lokey : NULL, hikeys ? &hikey : NULL, ids, tmp, limit);
+  if (lokeys)
+    ber_bvarray_free_x(lokeys, op->o_tmpmemctx);
+  if (hikeys)
+    ber_bvarray_free_x(hikeys, op->o_tmpmemctx);
+
+  if (rc != 0) {
+    Debug(LDAP_DEBUG_TRACE, "<= mdb_ordered_candidates: (%s) range read failed (%d)\n", desc->ad_cname.bv_val, rc);
+    return rc;
+  }
+
+  Debug(LDAP_DEBUG_TRACE, "<= mdb_ordered_candidates: id=%ld, first=%ld, last=%ld\n", (long)ids[0],
+        (long)MDB_IDL_FIRST(ids), (long)MDB_IDL_LAST(ids));
+  return 0;
+}
+
 static int inequality_candidates(Operation *op, MDBX_txn *rtxn, AttributeAssertion *ava, ID *ids, ID *tmp, int gtorlt) {
   MDBX_dbi dbi;
   int rc;
@@ -416,6 +416,11 @@ int mdb_id2entry_delete(BackendDB *be, MDBX_txn *tid, Entry *e) {
   rc = mdbx_del(tid, dbi, &key, NULL);
   if (rc)
     return rc;
+  if (mdb->mi_subtree_ranges) {
+    rc = mdbx_del(tid, mdb->mi_id2range, &key, NULL);
+    if (rc && rc != MDBX_NOTFOUND)
+      return rc;
+  }
   rc = mdbx_cursor_open(tid, mdb->mi_dbis[MDB_ID2VAL], &mvc);
   if (rc)
     return rc;
@@ -940,6 +945,86 @@ static int mdb_entry_encode(Operation *op, Entry *e, MDBX_val *data, Ecount *eh)
   return 0;
 }
 
+/* Test a substrings assertion against the entry as stored by
+ * entry_encode above, without decoding it. Only the values of the
+ * asserted attribute and its subtypes are looked at. Returns
+ * SLAPD_COMPARE_UNDEFINED when that can't tell, i.e. some of those
+ * values are stored separately or the entry could not be read.
+ */
+int mdb_entry_substrings(Operation *op, MDBX_cursor *mc, ID id, SubstringsAssertion *sub) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  MDBX_val data;
+  unsigned int *lp, *lens, i, j, n, nattrs;
+  unsigned char *ptr;
+  int rc;
+
+  rc = mdb_id2edata(op, mc, id, &data);
+  if (rc)
+    return rc == MDBX_NOTFOUND ? LDAP_COMPARE_FALSE : SLAPD_COMPARE_UNDEFINED;
+
+  lp = (unsigned int *)data.iov_base;
+  nattrs = *lp++;
+  if (!*lp++)
+    return LDAP_COMPARE_FALSE;
+  lp++; /* e_ocflags */
+  i = *lp++;
+  ptr = (unsigned char *)(lp + i);
+
+  rc = LDAP_COMPARE_FALSE;
+  for (; nattrs > 0; nattrs--) {
+    AttributeDescription *ad;
+    MatchingRule *mr;
+    int have_nval, multi, match;
+
+    i = *lp++;
+    multi = i & MDB_AT_MULTI;
+    i &= ~(MDB_AT_SORTED | MDB_AT_MULTI);
+    n = *lp++;
+    have_nval = n & MDB_AT_NVALS;
+    n &= ~MDB_AT_NVALS;
+    if (i > (unsigned)slap_tsan__read_int(&mdb->mi_numads))
+      return SLAPD_COMPARE_UNDEFINED;
+    ad = mdb->mi_ads[i];
+    mr = ad->ad_type->sat_substr;
+    match = is_ad_subtype(ad, sub->sa_desc);
+    if (multi) {
+      if (match)
+        rc = SLAPD_COMPARE_UNDEFINED;
+      continue;
+    }
+
+    lens = lp;
+    lp += have_nval ? 2 * n : n;
+    if (match && !mr)
+      rc = SLAPD_COMPARE_UNDEFINED;
+    if (!match || !mr) {
+      for (j = 0; j < (have_nval ? 2 * n : n); j++)
+        ptr += lens[j] + 1;
+      continue;
+    }
+    if (have_nval) {
+      for (j = 0; j < n; j++)
+        ptr += lens[j] + 1;
+      lens += n;
+    }
+    for (j = 0; j < n; j++) {
+      struct berval bv;
+      const char *text;
+      int m;
+
+      bv.bv_len = lens[j];
+      bv.bv_val = (char *)ptr;
+      ptr += bv.bv_len + 1;
+      if (value_match(&m, ad, mr, SLAP_MR_SUBSTR, &bv, sub, &text) != LDAP_SUCCESS)
+        rc = SLAPD_COMPARE_UNDEFINED;
+      else if (m == 0)
+        return LDAP_COMPARE_TRUE;
+    }
+  }
+
+  return rc;
+}
+
 /* Retrieve an Entry that was stored using entry_encode above.
  *
  * Note: everything is stored in a single contiguous block, so
@@ -28,6 +28,9 @@
 static void idl_check(ID *ids) {
   if (MDB_IDL_IS_RANGE(ids)) {
     assert(MDB_IDL_RANGE_FIRST(ids) <= MDB_IDL_RANGE_LAST(ids));
+  } else if (MDB_IDL_IS_BITMAP(ids)) {
+    assert(MDB_IDL_FIRST(ids) <= MDB_IDL_LAST(ids));
+    assert(MDB_IDL_BM_WORDS(ids) <= MDB_IDL_BITMAP_MAX);
   } else {
     ID i;
     for (i = 1; i < ids[0]; i++) {
@@ -247,11 +250,967 @@ static char *mdb_show_key(char *buf, void *val, size_t len) {
   }
 }
 
+/* Compressed bitmap IDLs, see idl.h for the in-memory layout.
+ *
+ * On disk an index slot which outgrows MDB_IDL_DB_MAX IDs may be kept
+ * as a bitmap instead of a range (see the "idlbitmap" option). The slot
+ * then holds the marker dups {0, lo, hi, NOID} and its containers live
+ * in the ix2b database, keyed by the attribute's ad2i number, the index
+ * key and the big-endian container key. Each container record is a
+ * 32-bit info word followed by the container data, exactly as in memory.
+ */
+
+#define BM_WORDS 1024     /* uint64_t words in a 64K bitset */
+#define BM_ARRAY_MAX 4096 /* larger arrays are never smaller than a bitset */
+#define BM_KEYLEN_MAX 256 /* longest index key we keep bitmaps for */
+#define BM_DBKEY_MAX (sizeof(int) + 2 + BM_KEYLEN_MAX + 4)
+
+#define BM_SIZE2WORDS(bytes) (((bytes) + sizeof(ID) - 1) / sizeof(ID))
+
+#define BM_AND 0
+#define BM_OR 1
+#define BM_ANDNOT 2
+
+static __inline unsigned bm_popcount(uint64_t w) {
+#if defined(__GNUC__)
+  return __builtin_popcountll(w);
+#else
+  unsigned n;
+  for (n = 0; w; n++)
+    w &= w - 1;
+  return n;
+#endif
+}
+
+static __inline unsigned bm_ctz(uint64_t w) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(w);
+#else
+  unsigned n = 0;
+  while (!(w & 1)) {
+    w >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+static __inline unsigned bm_clz(uint64_t w) {
+#if defined(__GNUC__)
+  return __builtin_clzll(w);
+#else
+  unsigned n = 0;
+  while (!(w & (UINT64_C(1) << 63))) {
+    w <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+/* Per-thread scratch space for building bitmaps */
+typedef struct bm_scratch {
+  ID ids[MDB_IDL_BITMAP_MAX];
+  uint64_t bits[BM_WORDS];
+  uint64_t tmp[BM_WORDS + 1];
+} bm_scratch;
+
+static void bm_scratch_free(void *key, void *data) { ch_free(data); }
+
+static bm_scratch *bm_scratch_get(void) {
+  void *ctx = ldap_pvt_thread_pool_context();
+  void *ret = NULL;
+
+  if (ldap_pvt_thread_pool_getkey(ctx, (void *)bm_scratch_get, &ret, NULL) || !ret) {
+    ret = ch_malloc(sizeof(bm_scratch));
+    if (ldap_pvt_thread_pool_setkey(ctx, (void *)bm_scratch_get, ret, bm_scratch_free, NULL, NULL)) {
+      Debug(LDAP_DEBUG_ANY, "bm_scratch_get: setkey failed\n");
+    }
+  }
+  return ret;
+}
+
+typedef struct bm_cont {
+  ID key;
+  unsigned type, count;
+  const void *data;
+} bm_cont;
+
+static size_t bmc_size(unsigned type, unsigned count) {
+  switch (type) {
+  case MDB_BMC_ARRAY:
+    return count * sizeof(uint16_t);
+  case MDB_BMC_BITMAP:
+    return BM_WORDS * sizeof(uint64_t);
+  default:
+    return count * 2 * sizeof(uint16_t);
+  }
+}
+
+static void bm_cont_get(ID *ids, ID i, bm_cont *c) {
+  ID *dir = MDB_IDL_BM_DIR(ids, i);
+  c->key = dir[0];
+  c->type = MDB_BMC_TYPE(dir[1]);
+  c->count = MDB_BMC_COUNT(dir[1]);
+  c->data = ids + dir[2];
+}
+
+static unsigned bmc_card(const bm_cont *c) {
+  const uint16_t *u = c->data;
+  unsigned i, n;
+
+  if (c->type != MDB_BMC_RUN)
+    return c->count;
+  for (i = n = 0; i < c->count; i++)
+    n += u[2 * i + 1] + 1;
+  return n;
+}
+
+/* set bits lo..hi inclusive */
+static void bm_set_range(uint64_t *bits, unsigned lo, unsigned hi) {
+  unsigned wlo = lo >> 6, whi = hi >> 6;
+  uint64_t mlo = ~UINT64_C(0) << (lo & 63);
+  uint64_t mhi = ~UINT64_C(0) >> (63 - (hi & 63));
+
+  if (wlo == whi) {
+    bits[wlo] |= mlo & mhi;
+    return;
+  }
+  bits[wlo++] |= mlo;
+  while (wlo < whi)
+    bits[wlo++] = ~UINT64_C(0);
+  bits[whi] |= mhi;
+}
+
+/* OR the members of a container into a 64K bitset */
+static void bmc_or_bits(const bm_cont *c, uint64_t *bits) {
+  const uint16_t *u = c->data;
+  unsigned i;
+
+  switch (c->type) {
+  case MDB_BMC_ARRAY:
+    for (i = 0; i < c->count; i++)
+      bits[u[i] >> 6] |= UINT64_C(1) << (u[i] & 63);
+    break;
+  case MDB_BMC_BITMAP: {
+    const uint64_t *w = c->data;
+    for (i = 0; i < BM_WORDS; i++)
+      bits[i] |= w[i];
+  } break;
+  case MDB_BMC_RUN:
+    for (i = 0; i < c->count; i++)
+      bm_set_range(bits, u[2 * i], u[2 * i] + u[2 * i + 1]);
+    break;
+  }
+}
+
+/* first member of a container >= low, or -1 */
+static int bmc_next(const bm_cont *c, unsigned low) {
+  const uint16_t *u = c->data;
+  unsigned base = 0, n = c->count, half;
+
+  switch (c->type) {
+  case MDB_BMC_ARRAY:
+    while (n) {
+      half = n >> 1;
+      if (u[base + half] < low) {
+        base += half + 1;
+        n -= half + 1;
+      } else
+        n = half;
+    }
+    return base < c->count ? u[base] : -1;
+
+  case MDB_BMC_BITMAP: {
+    const uint64_t *w = c->data;
+    unsigned i = low >> 6;
+    uint64_t x = w[i] & (~UINT64_C(0) << (low & 63));
+    for (;;) {
+      if (x)
+        return (i << 6) + bm_ctz(x);
+      if (++i >= BM_WORDS)
+        return -1;
+      x = w[i];
+    }
+  }
+
+  default:
+    /* find the first run which ends at or after low */
+    while (n) {
+      half = n >> 1;
+      if ((unsigned)u[2 * (base + half)] + u[2 * (base + half) + 1] < low) {
+        base += half + 1;
+        n -= half + 1;
+      } else
+        n = half;
+    }
+    if (base >= c->count)
+      return -1;
+    return u[2 * base] > low ? u[2 * base] : (int)low;
+  }
+}
+
+/* last member of a non-empty container */
+static unsigned bmc_last(const bm_cont *c) {
+  const uint16_t *u = c->data;
+
+  switch (c->type) {
+  case MDB_BMC_ARRAY:
+    return u[c->count - 1];
+  case MDB_BMC_BITMAP: {
+    const uint64_t *w = c->data;
+    unsigned i = BM_WORDS;
+    while (--i && !w[i])
+      ;
+    return (i << 6) + 63 - bm_clz(w[i]);
+  }
+  default:
+    return u[2 * (c->count - 1)] + u[2 * (c->count - 1) + 1];
+  }
+}
+
+/* append the members of a container to a plain IDL */
+static void bmc_expand(const bm_cont *c, ID *ids) {
+  const uint16_t *u = c->data;
+  ID base = c->key << MDB_BMC_SHIFT, n = ids[0];
+  unsigned i, j;
+
+  switch (c->type) {
+  case MDB_BMC_ARRAY:
+    for (i = 0; i < c->count; i++)
+      ids[++n] = base | u[i];
+    break;
+  case MDB_BMC_BITMAP: {
+    const uint64_t *w = c->data;
+    for (i = 0; i < BM_WORDS; i++) {
+      uint64_t x = w[i];
+      while (x) {
+        ids[++n] = base | (i << 6) | bm_ctz(x);
+        x &= x - 1;
+      }
+    }
+  } break;
+  case MDB_BMC_RUN:
+    for (i = 0; i < c->count; i++)
+      for (j = 0; j <= u[2 * i + 1]; j++)
+        ids[++n] = base | (u[2 * i] + j);
+    break;
+  }
+  ids[0] = n;
+}
+
+/* next set/clear bit at or after pos, BM_WORDS*64 if none */
+static unsigned bits_next(const uint64_t *bits, unsigned pos, int set) {
+  unsigned i = pos >> 6;
+  uint64_t x;
+
+  if (pos >= BM_WORDS * 64)
+    return BM_WORDS * 64;
+  x = (set ? bits[i] : ~bits[i]) & (~UINT64_C(0) << (pos & 63));
+  for (;;) {
+    if (x)
+      return (i << 6) + bm_ctz(x);
+    if (++i >= BM_WORDS)
+      return BM_WORDS * 64;
+    x = set ? bits[i] : ~bits[i];
+  }
+}
+
+/* Pick the smallest encoding for a 64K bitset.
+ * Returns the cardinality, 0 if the bitset is empty.
+ */
+static unsigned bm_choose(const uint64_t *bits, unsigned *type, unsigned *count) {
+  unsigned i, card = 0, runs = 0;
+  uint64_t carry = 0;
+  size_t sa, sr;
+
+  for (i = 0; i < BM_WORDS; i++) {
+    uint64_t w = bits[i];
+    card += bm_popcount(w);
+    runs += bm_popcount(w & ~((w << 1) | carry));
+    carry = w >> 63;
+  }
+  if (!card)
+    return 0;
+
+  sa = card <= BM_ARRAY_MAX ? bmc_size(MDB_BMC_ARRAY, card) : (size_t)-1;
+  sr = bmc_size(MDB_BMC_RUN, runs);
+  if (sr < sa && sr < bmc_size(MDB_BMC_BITMAP, 0)) {
+    *type = MDB_BMC_RUN;
+    *count = runs;
+  } else if (sa <= bmc_size(MDB_BMC_BITMAP, 0)) {
+    *type = MDB_BMC_ARRAY;
+    *count = card;
+  } else {
+    *type = MDB_BMC_BITMAP;
+    *count = card;
+  }
+  return card;
+}
+
+static void bm_encode(const uint64_t *bits, unsigned type, void *out) {
+  uint16_t *u = out;
+  unsigned i, lo, hi;
+
+  switch (type) {
+  case MDB_BMC_ARRAY:
+    for (i = 0; i < BM_WORDS; i++) {
+      uint64_t x = bits[i];
+      while (x) {
+        *u++ = (i << 6) | bm_ctz(x);
+        x &= x - 1;
+      }
+    }
+    break;
+  case MDB_BMC_BITMAP:
+    memcpy(out, bits, BM_WORDS * sizeof(uint64_t));
+    break;
+  case MDB_BMC_RUN:
+    for (lo = bits_next(bits, 0, 1); lo < BM_WORDS * 64; lo = bits_next(bits, hi + 1, 1)) {
+      hi = bits_next(bits, lo, 0) - 1;
+      *u++ = lo;
+      *u++ = hi - lo;
+    }
+    break;
+  }
+}
+
+/* Builds a bitmap in a buffer of MDB_IDL_BITMAP_MAX words. The container
+ * data grows from the header up, the directory is kept at the tail of
+ * the buffer until bm_finish() moves it into place.
+ */
+typedef struct bm_build {
+  ID *ids;
+  ID data;
+  ID nc;
+  ID card;
+  int overflow;
+} bm_build;
+
+static void bm_begin(bm_build *b, ID *ids) {
+  b->ids = ids;
+  b->data = MDB_IDL_BM_HDR;
+  b->nc = 0;
+  b->card = 0;
+  b->overflow = 0;
+}
+
+static void *bm_alloc(bm_build *b, ID key, unsigned type, unsigned count) {
+  ID words = BM_SIZE2WORDS(bmc_size(type, count)), *dir;
+  void *ret;
+
+  if (b->overflow)
+    return NULL;
+  if (b->data + words + (b->nc + 1) * MDB_IDL_BM_DIRSIZE > MDB_IDL_BITMAP_MAX) {
+    b->overflow = 1;
+    return NULL;
+  }
+  b->nc++;
+  dir = b->ids + MDB_IDL_BITMAP_MAX - b->nc * MDB_IDL_BM_DIRSIZE;
+  dir[0] = key;
+  dir[1] = MDB_BMC_INFO(type, count);
+  dir[2] = b->data;
+  ret = b->ids + b->data;
+  /* keep the padding tail defined */
+  b->ids[b->data + words - 1] = 0;
+  b->data += words;
+  return ret;
+}
+
+static void bm_put_bits(bm_build *b, ID key, const uint64_t *bits) {
+  unsigned type, count, card;
+  void *p;
+
+  card = bm_choose(bits, &type, &count);
+  if (card && (p = bm_alloc(b, key, type, count)) != NULL) {
+    bm_encode(bits, type, p);
+    b->card += card;
+  }
+}
+
+static void bm_put_cont(bm_build *b, const bm_cont *c) {
+  void *p = bm_alloc(b, c->key, c->type, c->count);
+  if (p) {
+    memcpy(p, c->data, bmc_size(c->type, c->count));
+    b->card += bmc_card(c);
+  }
+}
+
+/* Move the directory into place, returns -1 if the bitmap didn't fit */
+static int bm_finish(bm_build *b) {
+  ID *ids = b->ids, shift = b->nc * MDB_IDL_BM_DIRSIZE, i;
+  bm_cont c;
+
+  if (b->overflow)
+    return -1;
+  if (!b->nc) {
+    ids[0] = 0;
+    return 0;
+  }
+  memmove(ids + MDB_IDL_BM_HDR + shift, ids + MDB_IDL_BM_HDR, (b->data - MDB_IDL_BM_HDR) * sizeof(ID));
+  for (i = 0; i < b->nc; i++) {
+    ID *src = ids + MDB_IDL_BITMAP_MAX - (i + 1) * MDB_IDL_BM_DIRSIZE;
+    ID *dst = MDB_IDL_BM_DIR(ids, i);
+    dst[0] = src[0];
+    dst[1] = src[1];
+    dst[2] = src[2] + shift;
+  }
+  ids[0] = MDB_IDL_BITMAP_TAG;
+  MDB_IDL_BM_N(ids) = b->card;
+  MDB_IDL_BM_NC(ids) = b->nc;
+  MDB_IDL_BM_WORDS(ids) = b->data + shift;
+  bm_cont_get(ids, 0, &c);
+  ids[1] = (c.key << MDB_BMC_SHIFT) | bmc_next(&c, 0);
+  bm_cont_get(ids, b->nc - 1, &c);
+  ids[2] = (c.key << MDB_BMC_SHIFT) | bmc_last(&c);
+  return 0;
+}
+
+/* Copy a finished bitmap out of the scratch buffer. Small ones are
+ * turned back into plain IDLs.
+ */
+static void bm_export(ID *src, ID *dst) {
+  if (MDB_IDL_IS_BITMAP(src) && MDB_IDL_BM_N(src) < MDB_IDL_DB_MAX) {
+    ID i, nc = MDB_IDL_BM_NC(src);
+    bm_cont c;
+    dst[0] = 0;
+    for (i = 0; i < nc; i++) {
+      bm_cont_get(src, i, &c);
+      bmc_expand(&c, dst);
+    }
+  } else {
+    MDB_IDL_CPY(dst, src);
+  }
+}
+
+/* index of the first container with key >= ckey */
+static ID bm_find(ID *ids, ID ckey) {
+  ID base = 0, n = MDB_IDL_BM_NC(ids), half;
+
+  while (n) {
+    half = n >> 1;
+    if (MDB_IDL_BM_DIR(ids, base + half)[0] < ckey) {
+      base += half + 1;
+      n -= half + 1;
+    } else
+      n = half;
+  }
+  return base;
+}
+
+/* first member of a bitmap >= id, or NOID */
+static ID bm_next_from(ID *ids, ID id) {
+  ID i, nc = MDB_IDL_BM_NC(ids);
+  bm_cont c;
+  int low;
+
+  for (i = bm_find(ids, MDB_BMC_KEY(id)); i < nc; i++) {
+    bm_cont_get(ids, i, &c);
+    low = bmc_next(&c, c.key == MDB_BMC_KEY(id) ? MDB_BMC_LOW(id) : 0);
+    if (low >= 0)
+      return (c.key << MDB_BMC_SHIFT) | low;
+  }
+  return NOID;
+}
+
+int mdb_idl_contains(ID *ids, ID id) {
+  unsigned x;
+
+  if (MDB_IDL_IS_RANGE(ids))
+    return id >= MDB_IDL_RANGE_FIRST(ids) && id <= MDB_IDL_RANGE_LAST(ids);
+
+  if (MDB_IDL_IS_BITMAP(ids))
+    return id >= ids[1] && id <= ids[2] && bm_next_from(ids, id) == id;
+
+  x = mdb_idl_search(ids, id);
+  return x <= ids[0] && ids[x] == id;
+}
+
+/* Walks a plain IDL or a bitmap one container at a time */
+typedef struct bm_iter {
+  ID *ids;
+  ID pos;
+} bm_iter;
+
+static void bmi_init(bm_iter *it, ID *ids) {
+  it->ids = ids;
+  it->pos = MDB_IDL_IS_BITMAP(ids) ? 0 : 1;
+}
+
+static ID bmi_key(bm_iter *it) {
+  if (MDB_IDL_IS_BITMAP(it->ids))
+    return it->pos < MDB_IDL_BM_NC(it->ids) ? MDB_IDL_BM_DIR(it->ids, it->pos)[0] : NOID;
+  return it->pos <= it->ids[0] ? MDB_BMC_KEY(it->ids[it->pos]) : NOID;
+}
+
+/* OR the current container into a bitset (if any) and advance */
+static void bmi_take(bm_iter *it, uint64_t *bits) {
+  if (MDB_IDL_IS_BITMAP(it->ids)) {
+    if (bits) {
+      bm_cont c;
+      bm_cont_get(it->ids, it->pos, &c);
+      bmc_or_bits(&c, bits);
+    }
+    it->pos++;
+  } else {
+    ID *ids = it->ids, key = MDB_BMC_KEY(ids[it->pos]);
+    do {
+      if (bits)
+        bits[MDB_BMC_LOW(ids[it->pos]) >> 6] |= UINT64_C(1) << (ids[it->pos] & 63);
+      it->pos++;
+    } while (it->pos <= ids[0] && MDB_BMC_KEY(ids[it->pos]) == key);
+  }
+}
+
+/* a = a op b, for plain IDLs and bitmaps. Returns -1 and leaves a
+ * untouched if the result doesn't fit.
+ */
+static int bm_merge(ID *a, ID *b, int op) {
+  bm_scratch *s = bm_scratch_get();
+  bm_build bb;
+  bm_iter ia, ib;
+  ID ka, kb;
+  unsigned i;
+
+  bm_begin(&bb, s->ids);
+  bmi_init(&ia, a);
+  bmi_init(&ib, b);
+  for (;;) {
+    ka = bmi_key(&ia);
+    kb = bmi_key(&ib);
+    if (ka == NOID && (op != BM_OR || kb == NOID))
+      break;
+    if (kb == NOID && op == BM_AND)
+      break;
+    memset(s->bits, 0, sizeof(s->bits));
+    if (ka < kb) {
+      bmi_take(&ia, op == BM_AND ? NULL : s->bits);
+      if (op == BM_AND)
+        continue;
+    } else if (kb < ka) {
+      bmi_take(&ib, op == BM_OR ? s->bits : NULL);
+      if (op != BM_OR)
+        continue;
+    } else {
+      bmi_take(&ia, s->bits);
+      if (op == BM_OR) {
+        bmi_take(&ib, s->bits);
+      } else {
+        memset(s->tmp, 0, BM_WORDS * sizeof(uint64_t));
+        bmi_take(&ib, s->tmp);
+        if (op == BM_AND)
+          for (i = 0; i < BM_WORDS; i++)
+            s->bits[i] &= s->tmp[i];
+        else
+          for (i = 0; i < BM_WORDS; i++)
+            s->bits[i] &= ~s->tmp[i];
+      }
+    }
+    bm_put_bits(&bb, op == BM_OR ? (ka < kb ? ka : kb) : ka, s->bits);
+    if (bb.overflow)
+      return -1;
+  }
+  if (bm_finish(&bb))
+    return -1;
+  bm_export(s->ids, a);
+  return 0;
+}
+
+/* dst = src clipped to [lo, hi] */
+static int bm_clip(ID *src, ID lo, ID hi, ID *dst) {
+  bm_scratch *s = bm_scratch_get();
+  bm_build bb;
+  bm_cont c;
+  ID i, nc = MDB_IDL_BM_NC(src);
+
+  bm_begin(&bb, s->ids);
+  for (i = bm_find(src, MDB_BMC_KEY(lo)); i < nc; i++) {
+    bm_cont_get(src, i, &c);
+    if (c.key > MDB_BMC_KEY(hi))
+      break;
+    if (c.key > MDB_BMC_KEY(lo) && c.key < MDB_BMC_KEY(hi)) {
+      bm_put_cont(&bb, &c);
+    } else {
+      unsigned l = c.key == MDB_BMC_KEY(lo) ? MDB_BMC_LOW(lo) : 0;
+      unsigned h = c.key == MDB_BMC_KEY(hi) ? MDB_BMC_LOW(hi) : 0xffff;
+      memset(s->bits, 0, sizeof(s->bits));
+      bmc_or_bits(&c, s->bits);
+      memset(s->tmp, 0, BM_WORDS * sizeof(uint64_t));
+      bm_set_range(s->tmp, l, h);
+      for (l = 0; l < BM_WORDS; l++)
+        s->bits[l] &= s->tmp[l];
+      bm_put_bits(&bb, c.key, s->bits);
+    }
+  }
+  if (bm_finish(&bb))
+    return -1;
+  bm_export(s->ids, dst);
+  return 0;
+}
+
+/* drop the members of a plain IDL which are (not) in b */
+static void bm_filter(ID *a, ID *b, int keep) {
+  ID i, n = 0;
+
+  for (i = 1; i <= a[0]; i++)
+    if (mdb_idl_contains(b, a[i]) == keep)
+      a[++n] = a[i];
+  a[0] = n;
+}
+
+/* ix2b key prefix: ad2i number, index key length and the index key */
+static size_t bm_dbkey(unsigned char *buf, int adid, MDBX_val *key) {
+  memcpy(buf, &adid, sizeof(int));
+  buf[sizeof(int)] = key->iov_len >> 8;
+  buf[sizeof(int) + 1] = key->iov_len & 0xff;
+  memcpy(buf + sizeof(int) + 2, key->iov_base, key->iov_len);
+  return sizeof(int) + 2 + key->iov_len;
+}
+
+static void bm_dbkey_cont(unsigned char *buf, size_t plen, ID ckey, MDBX_val *key) {
+  buf[plen] = ckey >> 24;
+  buf[plen + 1] = ckey >> 16;
+  buf[plen + 2] = ckey >> 8;
+  buf[plen + 3] = ckey;
+  key->iov_base = buf;
+  key->iov_len = plen + 4;
+}
+
+static ID bm_dbkey_getcont(MDBX_val *key) {
+  unsigned char *p = (unsigned char *)key->iov_base + key->iov_len - 4;
+  return (ID)p[0] << 24 | (ID)p[1] << 16 | (ID)p[2] << 8 | p[3];
+}
+
+/* The index databases are shared by all descriptions of a type,
+ * the bitmaps are keyed by the type's own description.
+ */
+static AttributeDescription *bm_dbi2ad(struct mdb_info *mdb, MDBX_dbi dbi) {
+  int i;
+
+  for (i = 0; i < mdb->mi_nattrs; i++)
+    if (mdb->mi_attrs[i]->ai_dbi == dbi)
+      return mdb->mi_attrs[i]->ai_desc->ad_type->sat_ad;
+  return NULL;
+}
+
+/* Check a container record, returns its info word or 0 */
+static ID bm_dbval_check(MDBX_val *data) {
+  uint32_t info;
+  unsigned type;
+
+  if (data->iov_len < sizeof(info))
+    return 0;
+  memcpy(&info, data->iov_base, sizeof(info));
+  type = MDB_BMC_TYPE(info);
+  if (type < MDB_BMC_ARRAY || type > MDB_BMC_RUN || !MDB_BMC_COUNT(info) ||
+      data->iov_len - sizeof(info) != bmc_size(type, MDB_BMC_COUNT(info)) ||
+      bmc_size(type, MDB_BMC_COUNT(info)) > BM_WORDS * sizeof(uint64_t))
+    return 0;
+  return info;
+}
+
+static int bm_db_put(MDBX_txn *txn, MDBX_dbi bdbi, unsigned char *kbuf, size_t plen, ID ckey, bm_scratch *s) {
+  MDBX_val key, data;
+  unsigned type, count;
+  uint32_t info;
+
+  bm_dbkey_cont(kbuf, plen, ckey, &key);
+  if (!bm_choose(s->bits, &type, &count))
+    return mdbx_del(txn, bdbi, &key, NULL);
+
+  info = MDB_BMC_INFO(type, count);
+  memcpy(s->tmp, &info, sizeof(info));
+  bm_encode(s->bits, type, (char *)s->tmp + sizeof(info));
+  data.iov_base = s->tmp;
+  data.iov_len = sizeof(info) + bmc_size(type, count);
+  return mdbx_put(txn, bdbi, &key, &data, 0);
+}
+
+/* Set or clear one ID in an on-disk bitmap. Returns MDBX_NOTFOUND
+ * if the last container of the bitmap went away.
+ */
+static int bm_db_update(MDBX_txn *txn, MDBX_dbi bdbi, unsigned char *kbuf, size_t plen, ID id, int set) {
+  bm_scratch *s = bm_scratch_get();
+  MDBX_val key, data;
+  MDBX_cursor *mc;
+  unsigned low = MDB_BMC_LOW(id);
+  uint64_t bit = UINT64_C(1) << (low & 63);
+  ID info;
+  bm_cont c;
+  int rc;
+
+  memset(s->bits, 0, sizeof(s->bits));
+  bm_dbkey_cont(kbuf, plen, MDB_BMC_KEY(id), &key);
+  rc = mdbx_get(txn, bdbi, &key, &data);
+  if (rc == 0) {
+    if (!(info = bm_dbval_check(&data)))
+      return MDBX_CORRUPTED;
+    memcpy(s->tmp, (char *)data.iov_base + sizeof(uint32_t), data.iov_len - sizeof(uint32_t));
+    c.type = MDB_BMC_TYPE(info);
+    c.count = MDB_BMC_COUNT(info);
+    c.data = s->tmp;
+    bmc_or_bits(&c, s->bits);
+  } else if (rc != MDBX_NOTFOUND) {
+    return rc;
+  }
+
+  if (!(s->bits[low >> 6] & bit) == !set)
+    return 0;
+  s->bits[low >> 6] ^= bit;
+  rc = bm_db_put(txn, bdbi, kbuf, plen, MDB_BMC_KEY(id), s);
+  if (rc || set)
+    return rc;
+
+  /* anything left for this index key? */
+  rc = mdbx_cursor_open(txn, bdbi, &mc);
+  if (rc)
+    return rc;
+  bm_dbkey_cont(kbuf, plen, 0, &key);
+  rc = mdbx_cursor_get(mc, &key, &data, MDBX_SET_RANGE);
+  if (rc == 0 && (key.iov_len != plen + 4 || memcmp(key.iov_base, kbuf, plen)))
+    rc = MDBX_NOTFOUND;
+  mdbx_cursor_close(mc);
+  return rc;
+}
+
+/* Locate the bitmap of an index key, returns MDBX_RESULT_TRUE if the
+ * key can't have one.
+ */
+static int bm_db_prefix(struct mdb_info *mdb, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, unsigned char *kbuf,
+                        size_t *plen, int create) {
+  AttributeDescription *ad;
+  int rc;
+
+  if (!mdb->mi_dbis[MDB_IDL2BM] || key->iov_len > BM_KEYLEN_MAX || !(ad = bm_dbi2ad(mdb, dbi)))
+    return MDBX_RESULT_TRUE;
+  if (create) {
+    rc = mdb_ad_get(mdb, txn, ad);
+    if (rc)
+      return rc;
+  }
+  if (!mdb->mi_adxs[ad->ad_index])
+    return MDBX_RESULT_TRUE;
+  *plen = bm_dbkey(kbuf, mdb->mi_adxs[ad->ad_index], key);
+  return 0;
+}
+
+/* Read the bitmap of an index key, ids holds the marker {lo, hi, NOID} */
+static int bm_db_fetch(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, ID *ids) {
+  struct mdb_info *mdb = be->be_private;
+  unsigned char kbuf[BM_DBKEY_MAX];
+  ID lo = ids[2], hi = ids[3], info;
+  MDBX_val bkey, data;
+  MDBX_cursor *mc;
+  bm_scratch *s;
+  bm_build bb;
+  bm_cont c;
+  size_t plen;
+  void *p;
+  int rc;
+
+  if (bm_db_prefix(mdb, txn, dbi, key, kbuf, &plen, 0) ||
+      mdbx_cursor_open(txn, mdb->mi_dbis[MDB_IDL2BM], &mc))
+    goto range;
+
+  s = bm_scratch_get();
+  bm_begin(&bb, s->ids);
+  bm_dbkey_cont(kbuf, plen, 0, &bkey);
+  for (rc = mdbx_cursor_get(mc, &bkey, &data, MDBX_SET_RANGE); rc == 0;
+       rc = mdbx_cursor_get(mc, &bkey, &data, MDBX_NEXT)) {
+    if (bkey.iov_len != plen + 4 || memcmp(bkey.iov_base, kbuf, plen))
+      break;
+    if (!(info = bm_dbval_check(&data))) {
+      Debug(LDAP_DEBUG_ANY, "=> mdb_idl_fetch_key: bad bitmap container\n");
+      bb.overflow = 1;
+      break;
+    }
+    c.key = bm_dbkey_getcont(&bkey);
+    c.type = MDB_BMC_TYPE(info);
+    c.count = MDB_BMC_COUNT(info);
+    if (!(p = bm_alloc(&bb, c.key, c.type, c.count)))
+      break;
+    memcpy(p, (char *)data.iov_base + sizeof(uint32_t), data.iov_len - sizeof(uint32_t));
+    c.data = p;
+    bb.card += bmc_card(&c);
+  }
+  mdbx_cursor_close(mc);
+  if (bm_finish(&bb) == 0 && bb.nc) {
+    bm_export(s->ids, ids);
+    Debug(LDAP_DEBUG_TRACE, "<= mdb_idl_fetch_key: bitmap of %ld ids\n", (long)MDB_IDL_N(ids));
+    return 0;
+  }
+
+range:
+  /* too big, or no containers at all: fall back to the bounds */
+  Debug(LDAP_DEBUG_TRACE, "<= mdb_idl_fetch_key: bitmap read as range %ld-%ld\n", (long)lo, (long)hi);
+  MDB_IDL_RANGE(ids, lo, hi);
+  return 0;
+}
+
+/* Turn a full index slot into a bitmap and add id to it.
+ * Returns MDBX_RESULT_TRUE if the slot must become a range instead.
+ */
+static int bm_db_convert(BackendDB *be, MDBX_cursor *cursor, MDBX_val *key, ID id) {
+  struct mdb_info *mdb = be->be_private;
+  MDBX_txn *txn = mdbx_cursor_txn(cursor);
+  MDBX_dbi bdbi = mdb->mi_dbis[MDB_IDL2BM];
+  unsigned char kbuf[BM_DBKEY_MAX];
+  MDBX_val ikey, k2, data;
+  bm_scratch *s;
+  ID i, n, cur, marker[4];
+  size_t plen;
+  int rc;
+
+  rc = bm_db_prefix(mdb, txn, mdbx_cursor_dbi(cursor), key, kbuf, &plen, 1);
+  if (rc)
+    return rc;
+
+  /* key may point into a page which goes away once we write,
+   * use the copy in the prefix instead.
+   */
+  ikey.iov_base = kbuf + sizeof(int) + 2;
+  ikey.iov_len = key->iov_len;
+
+  /* copy the IDs out first, for the same reason */
+  s = bm_scratch_get();
+  n = 0;
+  k2 = ikey;
+  rc = mdbx_cursor_get(cursor, &k2, &data, MDBX_GET_MULTIPLE);
+  while (rc == 0) {
+    if (n + data.iov_len / sizeof(ID) > MDB_IDL_BITMAP_MAX)
+      return MDBX_RESULT_TRUE;
+    memcpy(s->ids + n, data.iov_base, data.iov_len);
+    n += data.iov_len / sizeof(ID);
+    k2 = ikey;
+    rc = mdbx_cursor_get(cursor, &k2, &data, MDBX_NEXT_MULTIPLE);
+  }
+  if (rc != MDBX_NOTFOUND)
+    return rc;
+  if (!n)
+    return MDBX_RESULT_TRUE;
+
+  marker[0] = 0;
+  marker[1] = IDL_MIN(s->ids[0], id);
+  marker[2] = IDL_MAX(s->ids[n - 1], id);
+  marker[3] = NOID;
+
+  memset(s->bits, 0, sizeof(s->bits));
+  cur = MDB_BMC_KEY(s->ids[0]);
+  for (i = 0; i < n; i++) {
+    if (MDB_BMC_KEY(s->ids[i]) != cur) {
+      rc = bm_db_put(txn, bdbi, kbuf, plen, cur, s);
+      if (rc)
+        return rc;
+      memset(s->bits, 0, sizeof(s->bits));
+      cur = MDB_BMC_KEY(s->ids[i]);
+    }
+    s->bits[MDB_BMC_LOW(s->ids[i]) >> 6] |= UINT64_C(1) << (s->ids[i] & 63);
+  }
+  rc = bm_db_put(txn, bdbi, kbuf, plen, cur, s);
+  if (rc)
+    return rc;
+
+  /* replace the slot by the marker */
+  k2 = ikey;
+  rc = mdbx_cursor_get(cursor, &k2, &data, MDBX_SET);
+  if (rc == 0)
+    rc = mdbx_cursor_del(cursor, MDBX_ALLDUPS);
+  for (i = 0; rc == 0 && i < 4; i++) {
+    k2 = ikey;
+    data.iov_base = &marker[i];
+    data.iov_len = sizeof(ID);
+    rc = mdbx_cursor_put(cursor, &k2, &data, 0);
+  }
+  if (rc)
+    return rc;
+
+  return bm_db_update(txn, bdbi, kbuf, plen, id, 1);
+}
+
+static int bm_db_modify(BackendDB *be, MDBX_cursor *cursor, MDBX_val *key, ID id, int set) {
+  struct mdb_info *mdb = be->be_private;
+  MDBX_txn *txn = mdbx_cursor_txn(cursor);
+  unsigned char kbuf[BM_DBKEY_MAX];
+  size_t plen;
+  int rc;
+
+  rc = bm_db_prefix(mdb, txn, mdbx_cursor_dbi(cursor), key, kbuf, &plen, set);
+  if (rc)
+    return rc == MDBX_RESULT_TRUE ? MDBX_CORRUPTED : rc;
+  return bm_db_update(txn, mdb->mi_dbis[MDB_IDL2BM], kbuf, plen, id, set);
+}
+
+/* Remove all the bitmaps of an attribute, for truncating reindex */
+int mdb_idl_bitmap_drop(struct mdb_info *mdb, MDBX_txn *txn, AttributeDescription *ad) {
+  MDBX_val key, data;
+  MDBX_cursor *mc;
+  int adid, rc;
+
+  ad = ad->ad_type->sat_ad;
+  if (!mdb->mi_dbis[MDB_IDL2BM] || !(adid = mdb->mi_adxs[ad->ad_index]))
+    return 0;
+
+  rc = mdbx_cursor_open(txn, mdb->mi_dbis[MDB_IDL2BM], &mc);
+  if (rc)
+    return rc;
+  for (;;) {
+    key.iov_base = &adid;
+    key.iov_len = sizeof(adid);
+    rc = mdbx_cursor_get(mc, &key, &data, MDBX_SET_RANGE);
+    if (rc)
+      break;
+    if (key.iov_len < sizeof(adid) || memcmp(key.iov_base, &adid, sizeof(adid)))
+      break;
+    rc = mdbx_cursor_del(mc, 0);
+    if (rc)
+      break;
+  }
+  mdbx_cursor_close(mc);
+  return rc == MDBX_NOTFOUND ? 0 : rc;
+}
+
+/* Read the IDL of the key the cursor is at, key is that key */
+static int idl_read_dups(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_cursor *cursor, MDBX_val *key, ID *ids) {
+  MDBX_val data, k2;
+  ID *i = ids + 1;
+  int rc;
+
+  rc = mdbx_cursor_get(cursor, &k2, &data, MDBX_GET_MULTIPLE);
+  while (rc == 0) {
+    memcpy(i, data.iov_base, data.iov_len);
+    i += data.iov_len / sizeof(ID);
+    rc = mdbx_cursor_get(cursor, &k2, &data, MDBX_NEXT_MULTIPLE);
+  }
+  if (rc == MDBX_NOTFOUND)
+    rc = 0;
+  ids[0] = i - &ids[1];
+  /* On disk, a range is denoted by 0 in the first element,
+   * a bitmap is a range with NOID appended.
+   */
+  if (ids[1] == 0 && ids[0] == MDB_IDL_RANGE_SIZE + 1 && ids[4] == NOID) {
+    bm_db_fetch(be, txn, dbi, key, ids);
+  } else if (ids[1] == 0) {
+    if (ids[0] != MDB_IDL_RANGE_SIZE) {
+      Debug(LDAP_DEBUG_ANY,
+            "=> mdb_idl_fetch_key: "
+            "range size mismatch: expected %d, got %ld\n",
+            MDB_IDL_RANGE_SIZE, ids[0]);
+      return -1;
+    }
+    MDB_IDL_RANGE(ids, ids[2], ids[3]);
+  }
+  return rc;
+}
+
+/* Read the IDL of the key a walk of the index is at */
+int mdb_idl_read_cursor(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_cursor *cursor, MDBX_val *key, ID *ids) {
+  return idl_read_dups(be, txn, dbi, cursor, key, ids);
+}
+
 int mdb_idl_fetch_key(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, ID *ids, MDBX_cursor **saved_cursor,
                       int get_flag) {
   MDBX_val data, key2, *kptr;
   MDBX_cursor *cursor;
-  ID *i;
   size_t len;
   int rc;
   MDBX_cursor_op opflag;
@@ -312,29 +1271,12 @@ int mdb_idl_fetch_key(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key,
     rc = MDBX_NOTFOUND;
   }
   if (rc == 0) {
-    i = ids + 1;
-    rc = mdbx_cursor_get(cursor, key, &data, MDBX_GET_MULTIPLE);
-    while (rc == 0) {
-      memcpy(i, data.iov_base, data.iov_len);
-      i += data.iov_len / sizeof(ID);
-      rc = mdbx_cursor_get(cursor, key, &data, MDBX_NEXT_MULTIPLE);
-    }
-    if (rc == MDBX_NOTFOUND)
-      rc = 0;
-    ids[0] = i - &ids[1];
-    /* On disk, a range is denoted by 0 in the first element */
-    if (ids[1] == 0) {
-      if (ids[0] != MDB_IDL_RANGE_SIZE) {
-        Debug(LDAP_DEBUG_ANY,
-              "=> mdb_idl_fetch_key: "
-              "range size mismatch: expected %d, got %ld\n",
-              MDB_IDL_RANGE_SIZE, ids[0]);
-        if (saved_cursor && *saved_cursor == cursor)
-          *saved_cursor = NULL;
-        mdbx_cursor_close(cursor);
-        return -1;
-      }
-      MDB_IDL_RANGE(ids, ids[2], ids[3]);
+    rc = idl_read_dups(be, txn, dbi, cursor, kptr, ids);
+    if (rc == -1) {
+      if (saved_cursor && *saved_cursor == cursor)
+        *saved_cursor = NULL;
+      mdbx_cursor_close(cursor);
+      return -1;
     }
     data.iov_len = MDB_IDL_SIZEOF(ids);
   }
@@ -378,9 +1320,138 @@ int mdb_idl_fetch_key(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key,
   return rc;
 }
 
+/* Sort the IDs appended by mdb_idl_fetch_range() and drop duplicates */
+static void idl_range_fold(ID *ids) {
+  ID stack[64]; /* quicksort stack, log2 of the list size deep */
+  ID i, j;
+
+  mdb_idl_sort(ids, stack);
+  for (i = j = 1; i <= ids[0]; i++) {
+    if (j == 1 || ids[i] != ids[j - 1])
+      ids[j++] = ids[i];
+  }
+  ids[0] = j - 1;
+}
+
+/* Union the IDLs of all keys from lo up to hi inclusive, a NULL bound
+ * leaves that end open. Used for the range walks of ordered indices.
+ * Gives up with all IDs once more than limit IDs were collected.
+ *
+ * Lists are appended unsorted and sorted once at the end, merging them
+ * key by key would cost O(n^2) over a wide range of distinct keys. A
+ * range or bitmap slot, or a list outgrowing the buffer, falls back to
+ * mdb_idl_union().
+ */
+int mdb_idl_fetch_range(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *lo, MDBX_val *hi, ID *ids, ID *tmp,
+                        ID limit) {
+  MDBX_cursor *cursor;
+  MDBX_val key, data;
+  int rc, unsorted = 0;
+
+  MDB_IDL_ZERO(ids);
+  rc = mdbx_cursor_open(txn, dbi, &cursor);
+  if (rc != 0) {
+    Debug(LDAP_DEBUG_ANY,
+          "=> mdb_idl_fetch_range: "
+          "cursor failed: %s (%d)\n",
+          mdbx_strerror(rc), rc);
+    return rc;
+  }
+
+  if (lo) {
+    key = *lo;
+    rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET_RANGE);
+  } else {
+    rc = mdbx_cursor_get(cursor, &key, &data, MDBX_FIRST);
+  }
+  while (rc == 0) {
+    if (hi && mdbx_cmp(txn, dbi, &key, hi) > 0)
+      break;
+    rc = idl_read_dups(be, txn, dbi, cursor, &key, tmp);
+    if (rc)
+      break;
+    if (MDB_IDL_IS_LIST(ids) && MDB_IDL_IS_LIST(tmp) && ids[0] + tmp[0] > MDB_IDL_UM_MAX && unsorted) {
+      idl_range_fold(ids);
+      unsorted = 0;
+    }
+    if (MDB_IDL_IS_LIST(ids) && MDB_IDL_IS_LIST(tmp) && ids[0] + tmp[0] <= MDB_IDL_UM_MAX) {
+      memcpy(ids + ids[0] + 1, tmp + 1, tmp[0] * sizeof(ID));
+      ids[0] += tmp[0];
+      unsorted = 1;
+      if (ids[0] > limit) {
+        idl_range_fold(ids);
+        unsorted = 0;
+      }
+    } else {
+      if (unsorted) {
+        idl_range_fold(ids);
+        unsorted = 0;
+      }
+      mdb_idl_union(ids, tmp);
+    }
+    if (MDB_IDL_N(ids) > limit) {
+      MDB_IDL_ALL(ids);
+      unsorted = 0;
+      break;
+    }
+    rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT_NODUP);
+  }
+  mdbx_cursor_close(cursor);
+  if (unsorted)
+    idl_range_fold(ids);
+
+  if (rc == MDBX_NOTFOUND)
+    rc = 0;
+  else if (rc)
+    Debug(LDAP_DEBUG_ANY,
+          "=> mdb_idl_fetch_range: "
+          "get failed: %s (%d)\n",
+          mdbx_strerror(rc), rc);
+  return rc;
+}
+
+/* Estimate the number of IDs under a key without reading the IDL.
+ * For a list this is exact (the number of duplicates), for a range
+ * or bitmap it is the width of the range.
+ */
+int mdb_idl_count_key(MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, ID *count) {
+  MDBX_cursor *cursor;
+  MDBX_val data;
+  ID lo, hi;
+  size_t n;
+  int rc;
+
+  *count = 0;
+  rc = mdbx_cursor_open(txn, dbi, &cursor);
+  if (rc != 0)
+    return rc;
+
+  rc = mdbx_cursor_get(cursor, key, &data, MDBX_SET_KEY);
+  if (rc == 0) {
+    memcpy(&lo, data.iov_base, sizeof(ID));
+    if (lo == 0) {
+      rc = mdbx_cursor_get(cursor, key, &data, MDBX_NEXT_DUP);
+      if (rc == 0) {
+        memcpy(&lo, data.iov_base, sizeof(ID));
+        rc = mdbx_cursor_get(cursor, key, &data, MDBX_NEXT_DUP);
+      }
+      if (rc == 0) {
+        memcpy(&hi, data.iov_base, sizeof(ID));
+        *count = hi - lo + 1;
+      }
+    } else {
+      rc = mdbx_cursor_count(cursor, &n);
+      if (rc == 0)
+        *count = n;
+    }
+  }
+  mdbx_cursor_close(cursor);
+  return rc;
+}
+
 int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys, ID id) {
   struct mdb_info *mdb = be->be_private;
-  MDBX_val key, data;
+  MDBX_val key, key0, data;
   ID lo, hi, *i;
   char *err;
   int rc = 0, k;
@@ -415,6 +1486,7 @@ int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
       key.iov_len = keys[k].bv_len;
       key.iov_base = keys[k].bv_val;
     }
+    key0 = key;
     rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET);
     err = "c_get";
     if (rc == 0) {
@@ -429,6 +1501,24 @@ int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
           goto fail;
         }
         if (count >= MDB_IDL_DB_MAX) {
+          if (mdb->mi_idl_bitmap) {
+            /* No room, convert to a bitmap if we can */
+            rc = bm_db_convert(be, cursor, &key, id);
+            if (rc != MDBX_RESULT_TRUE) {
+              if (rc != 0) {
+                err = "bitmap convert";
+                goto fail;
+              }
+              continue;
+            }
+            key = key0;
+            rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET);
+            if (rc != 0) {
+              err = "c_get";
+              goto fail;
+            }
+            i = data.iov_base;
+          }
           /* No room, convert to a range */
           lo = *i;
           rc = mdbx_cursor_get(cursor, &key, &data, MDBX_LAST_DUP);
@@ -450,6 +1540,8 @@ int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
             err = "c_del dups";
             goto fail;
           }
+          /* the key returned by c_get pointed into the page just freed */
+          key = key0;
           /* Store the range */
           data.iov_len = sizeof(ID);
           data.iov_base = &id;
@@ -478,11 +1570,25 @@ int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
           goto put1;
         }
       } else {
-        /* It's a range, see if we need to rewrite
+        /* It's a range or a bitmap, see if we need to rewrite
          * the boundaries
          */
+        size_t count;
         lo = i[1];
         hi = i[2];
+        rc = mdbx_cursor_count(cursor, &count);
+        if (rc != 0) {
+          err = "c_count";
+          goto fail;
+        }
+        if (count > MDB_IDL_RANGE_SIZE) {
+          rc = bm_db_modify(be, cursor, &key, id, 1);
+          if (rc != 0) {
+            err = "bitmap put";
+            goto fail;
+          }
+          key = key0;
+        }
         if (id < lo || id > hi) {
           /* position on lo */
           rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT_DUP);
@@ -536,7 +1642,7 @@ int mdb_idl_insert_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
 
 int mdb_idl_delete_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys, ID id) {
   int rc = 0, k;
-  MDBX_val key, data;
+  MDBX_val key, key0, data;
   ID lo, hi, tmp, *i;
   char *err;
 #ifndef MISALIGNED_OK
@@ -568,6 +1674,7 @@ int mdb_idl_delete_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
       key.iov_len = keys[k].bv_len;
       key.iov_base = keys[k].bv_val;
     }
+    key0 = key;
     rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET);
     err = "c_get";
     if (rc == 0) {
@@ -590,8 +1697,30 @@ int mdb_idl_delete_keys(BackendDB *be, MDBX_cursor *cursor, struct berval *keys,
         /* It's a range, see if we need to rewrite
          * the boundaries
          */
+        size_t count;
         lo = i[1];
         hi = i[2];
+        rc = mdbx_cursor_count(cursor, &count);
+        if (rc != 0) {
+          err = "c_count";
+          goto fail;
+        }
+        if (count > MDB_IDL_RANGE_SIZE) {
+          /* It's a bitmap, the boundaries are only a hint */
+          rc = bm_db_modify(be, cursor, &key, id, 0);
+          if (rc == MDBX_NOTFOUND) {
+            /* ...and it's empty now */
+            key = key0;
+            rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET);
+            if (rc == 0)
+              rc = mdbx_cursor_del(cursor, MDBX_ALLDUPS);
+          }
+          if (rc != 0) {
+            err = "bitmap del";
+            goto fail;
+          }
+          continue;
+        }
         if (id == lo || id == hi) {
           ID lo2 = lo, hi2 = hi;
           if (id == lo) {
@@ -668,6 +1797,27 @@ int mdb_idl_intersection(ID *a, ID *b) {
     return 0;
   }
 
+  if (MDB_IDL_IS_BITMAP(a) || MDB_IDL_IS_BITMAP(b)) {
+    if (MDB_IDL_IS_LIST(a)) {
+      bm_filter(a, b, 1);
+    } else if (MDB_IDL_IS_LIST(b)) {
+      bm_filter(b, a, 1);
+      MDB_IDL_CPY(a, b);
+    } else if (MDB_IDL_IS_RANGE(a) || MDB_IDL_IS_RANGE(b)) {
+      /* the bitmap clipped to the range */
+      if (bm_clip(MDB_IDL_IS_RANGE(a) ? b : a, idmin, idmax, a))
+        MDB_IDL_RANGE(a, idmin, idmax);
+    } else if (bm_merge(a, b, BM_AND)) {
+      MDB_IDL_RANGE(a, idmin, idmax);
+    }
+    return 0;
+  }
+
+  if (!MDB_IDL_IS_RANGE(a) && !MDB_IDL_IS_RANGE(b)) {
+    mdb_idl_and_lists(a, b, idmin, idmax);
+    return 0;
+  }
+
   if (MDB_IDL_IS_RANGE(a)) {
     if (MDB_IDL_IS_RANGE(b)) {
       /* If both are ranges, just shrink the boundaries */
@@ -743,6 +1893,15 @@ int mdb_idl_union(ID *a, ID *b) {
     return 0;
   }
 
+  if (MDB_IDL_IS_BITMAP(a) || MDB_IDL_IS_BITMAP(b)) {
+    if (bm_merge(a, b, BM_OR))
+      goto over;
+    return 0;
+  }
+
+  if (mdb_idl_or_lists(a, b) == 0)
+    return 0;
+
   ida = mdb_idl_first(a, &cursora);
   idb = mdb_idl_first(b, &cursorb);
 
@@ -752,6 +1911,9 @@ int mdb_idl_union(ID *a, ID *b) {
   while (ida != NOID || idb != NOID) {
     if (ida < idb) {
       if (++cursorc > MDB_IDL_UM_MAX) {
+        /* Both lists are still intact, try a bitmap first */
+        if (bm_merge(a, b, BM_OR) == 0)
+          return 0;
         goto over;
       }
       b[cursorc] = ida;
@@ -785,59 +1947,57 @@ int mdb_idl_union(ID *a, ID *b) {
   return 0;
 }
 
-#if 0
 /*
  * mdb_idl_notin - return a intersection ~b (or a minus b)
  */
-int
-mdb_idl_notin(
-	ID	*a,
-	ID	*b,
-	ID *ids )
-{
-	ID ida, idb;
-	ID cursora = 0, cursorb = 0;
-
-	if( MDB_IDL_IS_ZERO( a ) ||
-		MDB_IDL_IS_ZERO( b ) ||
-		MDB_IDL_IS_RANGE( b ) )
-	{
-		MDB_IDL_CPY( ids, a );
-		return 0;
-	}
+int mdb_idl_notin(ID *a, ID *b, ID *ids) {
+  ID ida, idb;
+  ID cursora = 0, cursorb = 0;
 
-	if( MDB_IDL_IS_RANGE( a ) ) {
-		MDB_IDL_CPY( ids, a );
-		return 0;
-	}
+  if (MDB_IDL_IS_ZERO(a) || MDB_IDL_IS_ZERO(b) || MDB_IDL_IS_RANGE(b)) {
+    MDB_IDL_CPY(ids, a);
+    return 0;
+  }
+
+  if (MDB_IDL_IS_RANGE(a)) {
+    MDB_IDL_CPY(ids, a);
+    return 0;
+  }
+
+  if (MDB_IDL_IS_BITMAP(a) || MDB_IDL_IS_BITMAP(b)) {
+    MDB_IDL_CPY(ids, a);
+    if (MDB_IDL_IS_LIST(ids))
+      bm_filter(ids, b, 0);
+    else
+      bm_merge(ids, b, BM_ANDNOT);
+    return 0;
+  }
 
-	ida = mdb_idl_first( a, &cursora ),
-	idb = mdb_idl_first( b, &cursorb );
+  ida = mdb_idl_first(a, &cursora), idb = mdb_idl_first(b, &cursorb);
 
-	ids[0] = 0;
+  ids[0] = 0;
 
-	while( ida != NOID ) {
-		if ( idb == NOID ) {
-			/* we could shortcut this */
-			ids[++ids[0]] = ida;
-			ida = mdb_idl_next( a, &cursora );
+  while (ida != NOID) {
+    if (idb == NOID) {
+      /* we could shortcut this */
+      ids[++ids[0]] = ida;
+      ida = mdb_idl_next(a, &cursora);
 
-		} else if ( ida < idb ) {
-			ids[++ids[0]] = ida;
-			ida = mdb_idl_next( a, &cursora );
+    } else if (ida < idb) {
+      ids[++ids[0]] = ida;
+      ida = mdb_idl_next(a, &cursora);
 
-		} else if ( ida > idb ) {
-			idb = mdb_idl_next( b, &cursorb );
+    } else if (ida > idb) {
+      idb = mdb_idl_next(b, &cursorb);
 
-		} else {
-			ida = mdb_idl_next( a, &cursora );
-			idb = mdb_idl_next( b, &cursorb );
-		}
-	}
+    } else {
+      ida = mdb_idl_next(a, &cursora);
+      idb = mdb_idl_next(b, &cursorb);
+    }
+  }
 
-	return 0;
+  return 0;
 }
-#endif
 
 ID mdb_idl_first(ID *ids, ID *cursor) {
   ID pos;
@@ -854,6 +2014,12 @@ ID mdb_idl_first(ID *ids, ID *cursor) {
     return *cursor;
   }
 
+  /* Bitmaps use the ID itself as the cursor, like ranges */
+  if (MDB_IDL_IS_BITMAP(ids)) {
+    *cursor = bm_next_from(ids, *cursor < ids[1] ? ids[1] : *cursor);
+    return *cursor;
+  }
+
   if (*cursor == 0)
     pos = 1;
   else
@@ -875,6 +2041,14 @@ ID mdb_idl_next(ID *ids, ID *cursor) {
     return *cursor;
   }
 
+  if (MDB_IDL_IS_BITMAP(ids)) {
+    if (*cursor >= ids[2]) {
+      return NOID;
+    }
+    *cursor = bm_next_from(ids, *cursor + 1);
+    return *cursor;
+  }
+
   if (++(*cursor) <= ids[0]) {
     return ids[*cursor];
   }
@@ -31,7 +31,57 @@
 #define MDB_IDL_IS_RANGE(ids) ((ids)[0] == NOID)
 #define MDB_IDL_RANGE_SIZE (3)
 #define MDB_IDL_RANGE_SIZEOF (MDB_IDL_RANGE_SIZE * sizeof(ID))
-#define MDB_IDL_SIZEOF(ids) ((MDB_IDL_IS_RANGE(ids) ? MDB_IDL_RANGE_SIZE : ((ids)[0] + 1)) * sizeof(ID))
+#define MDB_IDL_SIZEOF(ids)                                                                                            \
+  ((MDB_IDL_IS_RANGE(ids) ? MDB_IDL_RANGE_SIZE : MDB_IDL_IS_BITMAP(ids) ? MDB_IDL_BM_WORDS(ids) : ((ids)[0] + 1)) *   \
+   sizeof(ID))
+
+/* Compressed bitmap IDL.
+ *   A list which doesn't fit into a plain IDL is kept as a set of
+ *   containers, one per 64K block of IDs, instead of collapsing into
+ *   a range. Each container is stored as a sorted array of 16-bit
+ *   offsets, a plain 64K bitset or a list of runs, whichever is smaller.
+ *   The whole thing lives inside an ordinary IDL buffer:
+ *     ids[0]   MDB_IDL_BITMAP_TAG
+ *     ids[1]   first ID (so MDB_IDL_FIRST works as usual)
+ *     ids[2]   last ID
+ *     ids[3]   number of IDs
+ *     ids[4]   number of containers
+ *     ids[5]   number of words in use, header included
+ *   followed by the container directory and the container data.
+ *   A bitmap which doesn't fit into MDB_IDL_BITMAP_MAX words
+ *   still degrades to a range.
+ */
+#define MDB_IDL_BITMAP_TAG (NOID - 1)
+#define MDB_IDL_IS_BITMAP(ids) ((ids)[0] == MDB_IDL_BITMAP_TAG)
+#define MDB_IDL_IS_LIST(ids) ((ids)[0] < MDB_IDL_BITMAP_TAG)
+#define MDB_IDL_BITMAP_MAX MDB_IDL_DB_SIZE
+
+#define MDB_IDL_BM_HDR 6
+#define MDB_IDL_BM_N(ids) ((ids)[3])
+#define MDB_IDL_BM_NC(ids) ((ids)[4])
+#define MDB_IDL_BM_WORDS(ids) ((ids)[5])
+
+/* Directory entry: container key (ID >> 16), info, data offset in words */
+#define MDB_IDL_BM_DIRSIZE 3
+#define MDB_IDL_BM_DIR(ids, i) ((ids) + MDB_IDL_BM_HDR + (i) * MDB_IDL_BM_DIRSIZE)
+
+#define MDB_BMC_SHIFT 16
+#define MDB_BMC_KEY(id) ((id) >> MDB_BMC_SHIFT)
+#define MDB_BMC_LOW(id) ((unsigned)((id) & 0xffff))
+
+#define MDB_BMC_ARRAY 1  /* sorted uint16_t offsets, count is the cardinality */
+#define MDB_BMC_BITMAP 2 /* 64K bitset, count is the cardinality */
+#define MDB_BMC_RUN 3    /* uint16_t start/length-1 pairs, count is number of runs */
+
+#define MDB_BMC_INFO(type, count) (((ID)(type) << 24) | (ID)(count))
+#define MDB_BMC_TYPE(info) ((unsigned)((info) >> 24))
+#define MDB_BMC_COUNT(info) ((unsigned)((info)&0xffffff))
+
+/* merge kernels of idlmerge.c */
+#define MDB_IDL_KERNEL_AUTO (-1)
+#define MDB_IDL_KERNEL_SCALAR 0
+#define MDB_IDL_KERNEL_SSE42 1
+#define MDB_IDL_KERNEL_AVX2 2
 
 #define MDB_IDL_RANGE_FIRST(ids) ((ids)[1])
 #define MDB_IDL_RANGE_LAST(ids) ((ids)[2])
@@ -60,9 +110,10 @@
 
 #define MDB_IDL_FIRST(ids) ((ids)[1])
 #define MDB_IDL_LLAST(ids) ((ids)[(ids)[0]])
-#define MDB_IDL_LAST(ids) (MDB_IDL_IS_RANGE(ids) ? (ids)[2] : (ids)[(ids)[0]])
+#define MDB_IDL_LAST(ids) (MDB_IDL_IS_LIST(ids) ? (ids)[(ids)[0]] : (ids)[2])
 
-#define MDB_IDL_N(ids) (MDB_IDL_IS_RANGE(ids) ? ((ids)[2] - (ids)[1]) + 1 : (ids)[0])
+#define MDB_IDL_N(ids)                                                                                                 \
+  (MDB_IDL_IS_RANGE(ids) ? ((ids)[2] - (ids)[1]) + 1 : MDB_IDL_IS_BITMAP(ids) ? MDB_IDL_BM_N(ids) : (ids)[0])
 
 /** An ID2 is an ID/value pair.
  */
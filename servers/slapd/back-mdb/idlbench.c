@@ -0,0 +1,225 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/* Micro-benchmark for the IDL merge kernels of idlmerge.c.
+ *
+ * Builds pairs of sorted IDLs with skewed sizes, runs every kernel
+ * the CPU supports and the former one-element-at-a-time merges over
+ * them, checks the results are identical and prints the timings.
+ *
+ * usage: idlbench [rounds [seed]]
+ * Exits non-zero if any kernel gives a different result.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/stdlib.h>
+#include <ac/string.h>
+#include <time.h>
+
+#include "back-mdb.h"
+#include "idl.h"
+
+static const struct {
+  ID na, nb;
+  ID span; /* IDs are drawn from [1, span] */
+} shapes[] = {
+    {5, 9, 16},               {40, 2000, 4000},         {16, 100000, 1000000},    {64, 100000, 1000000},
+    {1000, 100000, 1000000},  {30000, 100000, 1000000}, {100000, 100000, 300000}, {100000, 100000, 10000000},
+};
+
+static unsigned long long prng_state = 42;
+
+static unsigned long long prng(void) {
+  /* splitmix64, deterministic across runs */
+  unsigned long long z = (prng_state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static int cmp_id(const void *a, const void *b) {
+  ID x = *(const ID *)a, y = *(const ID *)b;
+  return x < y ? -1 : x > y;
+}
+
+static void gen(ID *ids, ID n, ID span) {
+  ID i, k;
+
+  for (i = 1; i <= n; i++)
+    ids[i] = 1 + prng() % span;
+  qsort(ids + 1, n, sizeof(ID), cmp_id);
+  for (i = k = 1; i <= n; i++)
+    if (k == 1 || ids[i] != ids[k - 1])
+      ids[k++] = ids[i];
+  ids[0] = k - 1;
+}
+
+/* the merges mdb_idl_intersection/mdb_idl_union did before idlmerge.c */
+static void ref_and(ID *a, ID *b) {
+  ID i = 1, j = 1, k = 0;
+
+  while (i <= a[0] && j <= b[0]) {
+    if (a[i] == b[j]) {
+      a[++k] = a[i];
+      i++;
+      j++;
+    } else if (a[i] < b[j]) {
+      i++;
+    } else {
+      j++;
+    }
+  }
+  a[0] = k;
+}
+
+static void ref_or(ID *a, ID *b) {
+  ID ida, idb, cursora = 1, cursorb = 1, cursorc = b[0];
+
+  ida = a[0] ? a[1] : NOID;
+  idb = b[0] ? b[1] : NOID;
+  while (ida != NOID || idb != NOID) {
+    if (ida < idb) {
+      b[++cursorc] = ida;
+      ida = ++cursora <= a[0] ? a[cursora] : NOID;
+    } else {
+      if (ida == idb)
+        ida = ++cursora <= a[0] ? a[cursora] : NOID;
+      idb = ++cursorb <= b[0] ? b[cursorb] : NOID;
+    }
+  }
+  a[0] = cursorc;
+  cursora = 1;
+  cursorb = 1;
+  cursorc = b[0] + 1;
+  while (cursorb <= b[0] || cursorc <= a[0]) {
+    idb = cursorc > a[0] ? NOID : b[cursorc];
+    if (cursorb <= b[0] && b[cursorb] < idb)
+      a[cursora++] = b[cursorb++];
+    else {
+      a[cursora++] = idb;
+      cursorc++;
+    }
+  }
+}
+
+static void and_lists(ID *a, ID *b) {
+  ID lo, hi;
+
+  if (!a[0] || !b[0]) {
+    a[0] = 0;
+    return;
+  }
+  lo = a[1] > b[1] ? a[1] : b[1];
+  hi = a[a[0]] < b[b[0]] ? a[a[0]] : b[b[0]];
+  if (lo > hi)
+    a[0] = 0;
+  else
+    mdb_idl_and_lists(a, b, lo, hi);
+}
+
+static void or_lists(ID *a, ID *b) {
+  if (mdb_idl_or_lists(a, b))
+    ref_or(a, b);
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static ID bufs[5][MDB_IDL_UM_SIZE];
+static ID *A = bufs[0], *B = bufs[1], *a = bufs[2], *b = bufs[3], *want = bufs[4];
+
+/* run op over copies of A and B, return nanoseconds per round */
+static double bench(void (*op)(ID *, ID *), int rounds) {
+  double t = 0;
+  int r;
+
+  for (r = 0; r < rounds; r++) {
+    double t0;
+    memcpy(a, A, MDB_IDL_SIZEOF(A));
+    memcpy(b, B, MDB_IDL_SIZEOF(B));
+    t0 = now();
+    op(a, b);
+    t += now() - t0;
+  }
+  return t * 1e9 / rounds;
+}
+
+static int check(const char *what) {
+  if (memcmp(a, want, MDB_IDL_SIZEOF(want)) == 0)
+    return 0;
+  fprintf(stderr, "idlbench: %s kernel \"%s\" result differs\n", what, mdb_idl_kernel_name());
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  static const int kernels[] = {MDB_IDL_KERNEL_SCALAR, MDB_IDL_KERNEL_SSE42, MDB_IDL_KERNEL_AVX2};
+  int rounds = argc > 1 ? atoi(argv[1]) : 20;
+  int failed = 0;
+  unsigned s, k;
+
+  if (rounds < 1)
+    rounds = 1;
+  if (argc > 2)
+    prng_state = strtoull(argv[2], NULL, 0);
+  printf("%8s %8s %8s  %-8s %12s %12s %8s\n", "na", "nb", "result", "kernel", "ref ns", "kernel ns", "speedup");
+  for (s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+    double ref;
+
+    gen(A, shapes[s].na, shapes[s].span);
+    gen(B, shapes[s].nb, shapes[s].span);
+
+    /* intersection, both argument orders */
+    for (k = 0; k < 2; k++) {
+      unsigned i;
+      if (k) {
+        ID *t = A;
+        A = B;
+        B = t;
+      }
+      ref = bench(ref_and, rounds);
+      memcpy(want, a, MDB_IDL_SIZEOF(a));
+      for (i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        double t;
+        if (mdb_idl_kernel_set(kernels[i]))
+          continue;
+        t = bench(and_lists, rounds);
+        failed |= check("and");
+        printf("%8lu %8lu %8lu  and/%-4s %12.0f %12.0f %7.2fx\n", A[0], B[0], want[0], mdb_idl_kernel_name(), ref, t,
+               ref / t);
+      }
+    }
+
+    /* union, both argument orders */
+    for (k = 0; k < 2; k++) {
+      double t;
+      ID *tmp = A;
+      A = B;
+      B = tmp;
+      if (A[0] + B[0] > MDB_IDL_UM_MAX)
+        continue;
+      ref = bench(ref_or, rounds);
+      memcpy(want, a, MDB_IDL_SIZEOF(a));
+      t = bench(or_lists, rounds);
+      failed |= check("or");
+      printf("%8lu %8lu %8lu  %-8s %12.0f %12.0f %7.2fx\n", A[0], B[0], want[0], "or", ref, t, ref / t);
+    }
+  }
+  return failed;
+}
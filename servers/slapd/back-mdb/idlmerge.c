@@ -0,0 +1,348 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/* Merge kernels for plain (sorted, unique) IDLs.
+ *
+ * Intersection has a galloping path for skewed sizes and SSE4.2/AVX2
+ * block-compare kernels otherwise, picked once at startup by the CPU
+ * features. Union only has the galloping path: without 64-bit unsigned
+ * min/max (AVX-512) a vector merge network doesn't pay for itself.
+ *
+ * Everything here works in place, the result always goes into the
+ * first list. This file must not depend on anything but the ID type,
+ * it is also linked into the idlbench micro-benchmark.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "back-mdb.h"
+#include "idl.h"
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(MDB_IDL_NO_SIMD)
+#define MDB_IDL_SIMD 1
+#include <immintrin.h>
+#endif
+
+/* gallop when one list is at least this many times longer */
+#define IDL_GALLOP_RATIO 32
+
+typedef ID(idl_and_func)(ID *dst, const ID *a, ID na, const ID *b, ID nb);
+
+static ID idl_and_scalar(ID *dst, const ID *a, ID na, const ID *b, ID nb) {
+  ID i = 0, j = 0, k = 0;
+
+  while (i < na && j < nb) {
+    if (a[i] < b[j]) {
+      i++;
+    } else if (a[i] > b[j]) {
+      j++;
+    } else {
+      dst[k++] = a[i];
+      i++;
+      j++;
+    }
+  }
+  return k;
+}
+
+/* first position in b[lo..n) holding an ID >= x, or n */
+static ID idl_gallop(const ID *b, ID lo, ID n, ID x) {
+  ID bound = 1, hi;
+
+  if (lo >= n || b[lo] >= x)
+    return lo;
+  while (lo + bound < n && b[lo + bound] < x)
+    bound <<= 1;
+  hi = lo + bound < n ? lo + bound : n;
+  lo += (bound >> 1) + 1;
+  while (lo < hi) {
+    ID mid = lo + ((hi - lo) >> 1);
+    if (b[mid] < x)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+/* Look up each ID of the short list in the long one. Safe in place
+ * even if the long list is the destination: an ID is only stored
+ * after the search has moved past its slot.
+ */
+static ID idl_and_gallop(ID *dst, const ID *s, ID ns, const ID *l, ID nl) {
+  ID i, j = 0, k = 0;
+
+  for (i = 0; i < ns && j < nl; i++) {
+    j = idl_gallop(l, j, nl, s[i]);
+    if (j < nl && l[j] == s[i]) {
+      dst[k++] = s[i];
+      j++;
+    }
+  }
+  return k;
+}
+
+#ifdef MDB_IDL_SIMD
+/* The vector kernels compare a block of a against a block of b in all
+ * rotations and keep the block of a in a register until it is used up,
+ * so results may be stored over the very block being compared.
+ */
+
+__attribute__((target("sse4.2"))) static ID idl_and_sse42(ID *dst, const ID *a, ID na, const ID *b, ID nb) {
+  ID i = 0, j = 0, k = 0;
+  int spill = 0;
+
+  if (na >= 2 && nb >= 2) {
+    __m128i va = _mm_loadu_si128((const __m128i *)a);
+    __m128i vb = _mm_loadu_si128((const __m128i *)b);
+    for (;;) {
+      ID amax = _mm_extract_epi64(va, 1);
+      ID bmax = _mm_extract_epi64(vb, 1);
+      __m128i m = _mm_or_si128(_mm_cmpeq_epi64(va, vb), _mm_cmpeq_epi64(va, _mm_shuffle_epi32(vb, 0x4E)));
+      int mask = _mm_movemask_pd(_mm_castsi128_pd(m));
+
+      if (mask & 1)
+        dst[k++] = _mm_cvtsi128_si64(va);
+      if (mask & 2)
+        dst[k++] = amax;
+      if (amax <= bmax)
+        i += 2;
+      if (bmax <= amax)
+        j += 2;
+      if (i + 2 > na || j + 2 > nb) {
+        spill = bmax < amax;
+        break;
+      }
+      if (amax <= bmax)
+        va = _mm_loadu_si128((const __m128i *)(a + i));
+      if (bmax <= amax)
+        vb = _mm_loadu_si128((const __m128i *)(b + j));
+    }
+    if (spill) {
+      /* the current block of a may be overwritten, finish it from the register */
+      ID tail[2];
+      _mm_storeu_si128((__m128i *)tail, va);
+      k += idl_and_scalar(dst + k, tail, 2, b + j, nb - j);
+      i += 2;
+    }
+  }
+  return k + idl_and_scalar(dst + k, a + i, na - i, b + j, nb - j);
+}
+
+/* vpermd indices packing the selected 64-bit lanes to the front */
+static __m256i idl_avx2_pack[16];
+/* vpmaskmovq masks for the first n lanes */
+static __m256i idl_avx2_store[5];
+
+static void idl_avx2_init(void) {
+  int mask, lane, n;
+
+  for (mask = 0; mask < 16; mask++) {
+    int32_t idx[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (lane = n = 0; lane < 4; lane++) {
+      if (mask & (1 << lane)) {
+        idx[2 * n] = 2 * lane;
+        idx[2 * n + 1] = 2 * lane + 1;
+        n++;
+      }
+    }
+    memcpy(&idl_avx2_pack[mask], idx, sizeof(idx));
+  }
+  for (n = 0; n <= 4; n++) {
+    int64_t m[4];
+    for (lane = 0; lane < 4; lane++)
+      m[lane] = lane < n ? -1 : 0;
+    memcpy(&idl_avx2_store[n], m, sizeof(m));
+  }
+}
+
+__attribute__((target("avx2"))) static ID idl_and_avx2(ID *dst, const ID *a, ID na, const ID *b, ID nb) {
+  ID i = 0, j = 0, k = 0;
+  int spill = 0;
+
+  if (na >= 4 && nb >= 4) {
+    __m256i va = _mm256_loadu_si256((const __m256i *)a);
+    __m256i vb = _mm256_loadu_si256((const __m256i *)b);
+    for (;;) {
+      ID amax = _mm256_extract_epi64(va, 3);
+      ID bmax = _mm256_extract_epi64(vb, 3);
+      __m256i m = _mm256_cmpeq_epi64(va, vb);
+      int mask;
+
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x39)));
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x4E)));
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x93)));
+      mask = _mm256_movemask_pd(_mm256_castsi256_pd(m));
+      if (mask) {
+        int n = __builtin_popcount(mask);
+        /* masked store, never touches the next block of a */
+        _mm256_maskstore_epi64((long long *)(dst + k), idl_avx2_store[n],
+                               _mm256_permutevar8x32_epi32(va, idl_avx2_pack[mask]));
+        k += n;
+      }
+      if (amax <= bmax)
+        i += 4;
+      if (bmax <= amax)
+        j += 4;
+      if (i + 4 > na || j + 4 > nb) {
+        spill = bmax < amax;
+        break;
+      }
+      if (amax <= bmax)
+        va = _mm256_loadu_si256((const __m256i *)(a + i));
+      if (bmax <= amax)
+        vb = _mm256_loadu_si256((const __m256i *)(b + j));
+    }
+    if (spill) {
+      ID tail[4];
+      _mm256_storeu_si256((__m256i *)tail, va);
+      k += idl_and_scalar(dst + k, tail, 4, b + j, nb - j);
+      i += 4;
+    }
+  }
+  return k + idl_and_scalar(dst + k, a + i, na - i, b + j, nb - j);
+}
+#endif /* MDB_IDL_SIMD */
+
+static const struct {
+  const char *name;
+  idl_and_func *func;
+} idl_kernels[] = {
+    [MDB_IDL_KERNEL_SCALAR] = {"scalar", idl_and_scalar},
+#ifdef MDB_IDL_SIMD
+    [MDB_IDL_KERNEL_SSE42] = {"sse4.2", idl_and_sse42},
+    [MDB_IDL_KERNEL_AVX2] = {"avx2", idl_and_avx2},
+#endif
+};
+
+static int idl_kernel = MDB_IDL_KERNEL_SCALAR;
+
+static int idl_kernel_supported(int kind) {
+  if (kind < 0 || kind >= (int)(sizeof(idl_kernels) / sizeof(idl_kernels[0])) || !idl_kernels[kind].func)
+    return 0;
+#ifdef MDB_IDL_SIMD
+  __builtin_cpu_init();
+  if (kind == MDB_IDL_KERNEL_SSE42)
+    return __builtin_cpu_supports("sse4.2");
+  if (kind == MDB_IDL_KERNEL_AVX2)
+    return __builtin_cpu_supports("avx2");
+#endif
+  return 1;
+}
+
+int mdb_idl_kernel_set(int kind) {
+  if (kind == MDB_IDL_KERNEL_AUTO) {
+    for (kind = MDB_IDL_KERNEL_AVX2; kind > MDB_IDL_KERNEL_SCALAR; kind--)
+      if (idl_kernel_supported(kind))
+        break;
+  } else if (!idl_kernel_supported(kind)) {
+    return -1;
+  }
+#ifdef MDB_IDL_SIMD
+  if (kind == MDB_IDL_KERNEL_AVX2)
+    idl_avx2_init();
+#endif
+  idl_kernel = kind;
+  return 0;
+}
+
+const char *mdb_idl_kernel_name(void) { return idl_kernels[idl_kernel].name; }
+
+/* first position in ids[1..n] holding an ID >= x, or n+1 */
+static ID idl_lower(const ID *ids, ID x) { return idl_gallop(ids + 1, 0, ids[0], x) + 1; }
+
+/*
+ * mdb_idl_and_lists - a = a intersection b, both plain IDLs,
+ * only IDs within [lo, hi] are considered.
+ */
+void mdb_idl_and_lists(ID *a, ID *b, ID lo, ID hi) {
+  ID sa = idl_lower(a, lo), ea = idl_lower(a, hi);
+  ID sb = idl_lower(b, lo), eb = idl_lower(b, hi);
+  ID na, nb;
+
+  /* make the ends inclusive of hi */
+  if (ea <= a[0] && a[ea] == hi)
+    ea++;
+  if (eb <= b[0] && b[eb] == hi)
+    eb++;
+  na = ea - sa;
+  nb = eb - sb;
+
+  if (!na || !nb)
+    a[0] = 0;
+  else if (na >= nb * IDL_GALLOP_RATIO)
+    a[0] = idl_and_gallop(a + 1, b + sb, nb, a + sa, na);
+  else if (nb >= na * IDL_GALLOP_RATIO)
+    a[0] = idl_and_gallop(a + 1, a + sa, na, b + sb, nb);
+  else
+    a[0] = idl_kernels[idl_kernel].func(a + 1, a + sa, na, b + sb, nb);
+}
+
+/* Merge a short list into a plain IDL from the back, moving the runs
+ * of the IDL between its IDs with memmove. Every ID of the IDL moves
+ * at most once.
+ */
+static void idl_or_gallop(ID *a, const ID *s, ID ns) {
+  ID total = a[0] + ns, hi = a[0], out = total;
+  ID i, p, n;
+
+  for (i = ns; i-- > 0;) {
+    ID x = s[i];
+    /* first position in a[1..hi] holding an ID > x */
+    p = idl_gallop(a + 1, 0, hi, x) + 1;
+    if (p <= hi && a[p] == x)
+      p++;
+    n = hi - p + 1;
+    if (n && out != hi) {
+      memmove(a + out - n + 1, a + p, n * sizeof(ID));
+    }
+    out -= n;
+    hi = p - 1;
+    if (hi && a[hi] == x)
+      continue; /* duplicate, keep the one already there */
+    a[out--] = x;
+  }
+  if (out != hi)
+    memmove(a + hi + 1, a + out + 1, (total - out) * sizeof(ID));
+  a[0] = hi + total - out;
+}
+
+/*
+ * mdb_idl_or_lists - a = a union b for plain IDLs of skewed sizes.
+ * Returns -1 if the sizes aren't skewed enough or the result may not
+ * fit, and leaves both lists intact then. Like mdb_idl_union, uses b
+ * as scratch space.
+ */
+int mdb_idl_or_lists(ID *a, ID *b) {
+  ID na = a[0], nb = b[0];
+
+  if (na + nb > MDB_IDL_UM_MAX)
+    return -1;
+
+  if (na >= nb * IDL_GALLOP_RATIO) {
+    idl_or_gallop(a, b + 1, nb);
+  } else if (nb >= na * IDL_GALLOP_RATIO) {
+    /* park a behind b, take b over and merge the parked copy in */
+    memcpy(b + nb + 1, a + 1, na * sizeof(ID));
+    memcpy(a, b, (nb + 1) * sizeof(ID));
+    idl_or_gallop(a, b + nb + 1, na);
+  } else {
+    return -1;
+  }
+  return 0;
+}
@@ -66,6 +66,138 @@ AttrInfo *mdb_index_mask(Backend *be, AttributeDescription *desc, struct berval
   return 0;
 }
 
+/* Ordered index keys are the normalized values, which compare in the
+ * order of the attribute's ordering rule when that rule is bytewise.
+ */
+#define MDB_ORDERED_OCTETS 1 /* memcmp() of the values */
+#define MDB_ORDERED_TIME 2   /* the same, ignoring the trailing 'Z' */
+
+int mdb_index_ordered_rule(AttributeType *at) {
+  MatchingRule *mr = at->sat_ordering;
+
+  if (!mr)
+    return 0;
+  if (mr->smr_match == octetStringOrderingMatch)
+    return MDB_ORDERED_OCTETS;
+  if (strcmp(mr->smr_oid, "2.5.13.28") == 0) /* generalizedTimeOrderingMatch */
+    return MDB_ORDERED_TIME;
+  return 0;
+}
+
+/* Build the ordered index keys of normalized values. Keys are cut to
+ * MDB_ORDERED_KEYLEN and zero-padded to whole IDs, neither breaks the
+ * order but either may map distinct values to one key. So a range of
+ * keys yields a superset of the matching entries, and deleting a key
+ * must consider the other values of the entry (see modify.c).
+ */
+int mdb_index_ordered_keys(AttributeType *at, BerVarray vals, BerVarray *keysp, void *ctx) {
+  int how = mdb_index_ordered_rule(at);
+  BerVarray keys;
+  ber_len_t len, klen;
+  int i;
+
+  for (i = 0; !BER_BVISNULL(&vals[i]); i++)
+    ;
+  if (!how || !i) {
+    *keysp = NULL;
+    return how ? LDAP_SUCCESS : LDAP_INAPPROPRIATE_MATCHING;
+  }
+
+  keys = slap_sl_malloc((i + 1) * sizeof(struct berval), ctx);
+  for (i = 0; !BER_BVISNULL(&vals[i]); i++) {
+    len = vals[i].bv_len;
+    if (how == MDB_ORDERED_TIME && len && vals[i].bv_val[len - 1] == 'Z')
+      len--;
+    if (len > MDB_ORDERED_KEYLEN)
+      len = MDB_ORDERED_KEYLEN;
+    klen = len ? (len + sizeof(ID) - 1) & ~(ber_len_t)(sizeof(ID) - 1) : sizeof(ID);
+    keys[i].bv_val = slap_sl_malloc(klen + 1, ctx);
+    memcpy(keys[i].bv_val, vals[i].bv_val, len);
+    memset(keys[i].bv_val + len, 0, klen + 1 - len);
+    keys[i].bv_len = klen;
+  }
+  BER_BVZERO(&keys[i]);
+  *keysp = keys;
+  return LDAP_SUCCESS;
+}
+
+/* N-gram keys are taken from the normalized values as they are, so
+ * only rules which index the values bytewise may use them.
+ */
+int mdb_index_ngram_rule(AttributeType *at) {
+  static MatchingRule *octets;
+  MatchingRule *mr = at->sat_substr;
+
+  if (!octets)
+    octets = mr_find("octetStringSubstringsMatch");
+  return mr && octets && mr->smr_indexer == octets->smr_indexer;
+}
+
+static int ngram_key_cmp(const void *v1, const void *v2) {
+  const struct berval *a = v1, *b = v2;
+  int rc = memcmp(a->bv_val, b->bv_val, a->bv_len < b->bv_len ? a->bv_len : b->bv_len);
+  return rc ? rc : (a->bv_len > b->bv_len) - (a->bv_len < b->bv_len);
+}
+
+/* One n-gram key: the kind byte and n bytes of src, reversed for the
+ * trailing gram, padded with zeros to whole IDs like ordered keys.
+ */
+void mdb_index_ngram_key(struct berval *key, int kind, const char *src, ber_len_t n, int reverse, void *ctx) {
+  ber_len_t j, klen = (n + 1 + sizeof(ID) - 1) & ~(ber_len_t)(sizeof(ID) - 1);
+
+  key->bv_val = slap_sl_malloc(klen + 1, ctx);
+  key->bv_val[0] = kind;
+  for (j = 0; j < n; j++)
+    key->bv_val[j + 1] = reverse ? src[n - 1 - j] : src[j];
+  memset(key->bv_val + n + 1, 0, klen - n);
+  key->bv_len = klen;
+}
+
+/* Build the n-gram index keys of normalized values: the leading gram,
+ * the trailing gram reversed, and the gram at every position, those
+ * near the end of a value being shorter. So any piece of a substring
+ * assertion up to len bytes long is found by a walk over the keys it
+ * prefixes, and longer pieces by the grams they consist of. The keys
+ * are sorted and unique, since values of an entry share many grams.
+ */
+int mdb_index_ngram_keys(unsigned len, BerVarray vals, BerVarray *keysp, void *ctx) {
+  BerVarray keys;
+  ber_len_t i, j, k, n, nkeys = 0;
+
+  for (i = 0; !BER_BVISNULL(&vals[i]); i++)
+    if (vals[i].bv_len)
+      nkeys += vals[i].bv_len + 2;
+  if (!nkeys) {
+    *keysp = NULL;
+    return LDAP_SUCCESS;
+  }
+
+  keys = slap_sl_malloc((nkeys + 1) * sizeof(struct berval), ctx);
+  for (i = 0, k = 0; !BER_BVISNULL(&vals[i]); i++) {
+    const char *v = vals[i].bv_val;
+    ber_len_t vlen = vals[i].bv_len;
+
+    if (!vlen)
+      continue;
+    n = vlen < len ? vlen : len;
+    mdb_index_ngram_key(&keys[k++], MDB_NGRAM_INITIAL, v, n, 0, ctx);
+    mdb_index_ngram_key(&keys[k++], MDB_NGRAM_FINAL, v + vlen - n, n, 1, ctx);
+    for (j = 0; j < vlen; j++)
+      mdb_index_ngram_key(&keys[k++], MDB_NGRAM_ANY, v + j, vlen - j < len ? vlen - j : len, 0, ctx);
+  }
+
+  qsort(keys, k, sizeof(struct berval), ngram_key_cmp);
+  for (i = 0, j = 1; j < k; j++) {
+    if (ngram_key_cmp(&keys[i], &keys[j]) == 0)
+      slap_sl_free(keys[j].bv_val, ctx);
+    else
+      keys[++i] = keys[j];
+  }
+  BER_BVZERO(&keys[i + 1]);
+  *keysp = keys;
+  return LDAP_SUCCESS;
+}
+
 /* This function is only called when evaluating search filters.
  */
 int mdb_index_param(Backend *be, AttributeDescription *desc, int ftype, MDBX_dbi *dbip, slap_mask_t *maskp,
@@ -135,6 +267,16 @@ int mdb_index_param(Backend *be, AttributeDescription *desc, int ftype, MDBX_dbi
     }
     break;
 
+  case LDAP_FILTER_GE:
+  case LDAP_FILTER_LE:
+    type = SLAP_INDEX_ORDERED;
+    if (IS_SLAP_INDEX(mask, type) && ai->ai_odbi) {
+      *dbip = ai->ai_odbi;
+      *maskp = mask;
+      return LDAP_SUCCESS;
+    }
+    break;
+
   default:
     return LDAP_OTHER;
   }
@@ -238,6 +380,48 @@ static int indexer(Operation *op, MDBX_txn *txn, struct mdb_attrinfo *ai, Attrib
     rc = LDAP_SUCCESS;
   }
 
+  if (IS_SLAP_INDEX(mask, SLAP_INDEX_ORDERED)) {
+    rc = mdb_index_ordered_keys(ad->ad_type, vals, &keys, op->o_tmpmemctx);
+
+    if (rc == LDAP_SUCCESS && keys != NULL) {
+      MDBX_cursor *oc;
+
+      rc = mdbx_cursor_open(txn, ai->ai_odbi, &oc);
+      if (rc == 0) {
+        rc = (opid == SLAP_INDEX_ADD_OP ? mdb_idl_insert_keys : mdb_idl_delete_keys)(op->o_bd, oc, keys, id);
+        mdbx_cursor_close(oc);
+      }
+      ber_bvarray_free_x(keys, op->o_tmpmemctx);
+      if (rc) {
+        err = "ordered";
+        goto done;
+      }
+    }
+
+    rc = LDAP_SUCCESS;
+  }
+
+  if (IS_SLAP_INDEX(mask, SLAP_INDEX_NGRAM)) {
+    rc = mdb_index_ngram_keys(mdb_attr_ngram_len(op->o_bd->be_private, ai), vals, &keys, op->o_tmpmemctx);
+
+    if (rc == LDAP_SUCCESS && keys != NULL) {
+      MDBX_cursor *gc;
+
+      rc = mdbx_cursor_open(txn, ai->ai_gdbi, &gc);
+      if (rc == 0) {
+        rc = (opid == SLAP_INDEX_ADD_OP ? mdb_idl_insert_keys : mdb_idl_delete_keys)(op->o_bd, gc, keys, id);
+        mdbx_cursor_close(gc);
+      }
+      ber_bvarray_free_x(keys, op->o_tmpmemctx);
+      if (rc) {
+        err = "ngram";
+        goto done;
+      }
+    }
+
+    rc = LDAP_SUCCESS;
+  }
+
 done:
   if (!(slapMode & SLAP_TOOL_QUICK)) {
     if (mc == ai->ai_cursor)
@@ -22,12 +22,13 @@
 #include <ac/errno.h>
 #include <sys/stat.h>
 #include "back-mdb.h"
+#include "idl.h"
 #include <lutil.h>
 #include <ldap_rq.h>
 #include "slapconfig.h"
 
 static const struct berval mdmi_databases[] = {BER_BVC("ad2i"), BER_BVC("dn2i"), BER_BVC("id2e"), BER_BVC("id2v"),
-                                               BER_BVNULL};
+                                               BER_BVC("ix2b"), BER_BVC("id2r"), BER_BVNULL};
 
 static int mdb_id_compare(const MDBX_val *a, const MDBX_val *b) {
   return mdbx_cmp2int(*(ID *)a->iov_base, *(ID *)b->iov_base);
@@ -163,6 +164,7 @@ static int mdb_db_init(BackendDB *be, ConfigReply *cr) {
   slap_backtrace_set_dir(mdb->mi_dbenv_home);
 
   ldap_pvt_thread_mutex_init(&mdb->mi_ads_mutex);
+  ldap_pvt_thread_mutex_init(&mdb->mi_paged_mutex);
 
   rc = mdb_monitor_db_init(be);
 
@@ -310,6 +312,8 @@ static int mdb_db_open(BackendDB *be, ConfigReply *cr) {
         flags |= MDBX_DUPSORT;
       if (i == MDB_ID2VAL)
         flags ^= MDBX_INTEGERKEY | MDBX_DUPSORT;
+      if (i == MDB_IDL2BM)
+        flags ^= MDBX_INTEGERKEY;
       if (!(slapMode & SLAP_TOOL_READONLY))
         flags |= MDBX_CREATE;
     }
@@ -326,6 +330,13 @@ static int mdb_db_open(BackendDB *be, ConfigReply *cr) {
 
     rc = mdbx_dbi_open_ex(txn, mdmi_databases[i].bv_val, flags, &mdb->mi_dbis[i], keycmp, datacmp);
 
+    if (rc == MDBX_NOTFOUND && (i == MDB_IDL2BM || i == MDB_ID2RANGE) && (slapMode & SLAP_TOOL_READONLY)) {
+      /* older databases have no bitmaps nor subtree ranges at all */
+      mdb->mi_dbis[i] = 0;
+      rc = 0;
+      continue;
+    }
+
     if (rc != 0) {
       snprintf(cr->msg, sizeof(cr->msg),
                "database \"%s\": "
@@ -382,6 +393,15 @@ static int mdb_db_open(BackendDB *be, ConfigReply *cr) {
       mdbx_txn_abort(txn);
       goto fail;
     }
+
+    rc = mdb_dn2id_ranges_open(be, txn);
+    if (rc) {
+      snprintf(cr->msg, sizeof(cr->msg), "database \"%s\": subtree ranges failed: %s (%d).", be->be_suffix[0].bv_val,
+               mdbx_strerror(rc), rc);
+      Debug(LDAP_DEBUG_ANY, LDAP_XSTRING(mdb_db_open) ": %s\n", cr->msg);
+      mdbx_txn_abort(txn);
+      goto fail;
+    }
   }
 
   rc = mdbx_txn_commit(txn);
@@ -427,7 +447,8 @@ static int mdb_db_close(BackendDB *be, ConfigReply *cr) {
 
       mdb_attr_dbs_close(mdb);
       for (i = 0; i < MDB_NDB; i++)
-        mdbx_dbi_close(mdb->mi_dbenv, mdb->mi_dbis[i]);
+        if (mdb->mi_dbis[i])
+          mdbx_dbi_close(mdb->mi_dbenv, mdb->mi_dbis[i]);
 
       /* force a sync, but not if we were ReadOnly,
        * and not in Quick mode.
@@ -452,6 +473,8 @@ static int mdb_db_close(BackendDB *be, ConfigReply *cr) {
     mdb->mi_search_stack = NULL;
   }
 
+  mdb_paged_destroy(mdb);
+
   return 0;
 }
 
@@ -477,6 +500,8 @@ static int mdb_db_destroy(BackendDB *be, ConfigReply *cr) {
 
   mdb_attr_index_destroy(mdb);
 
+  ldap_pvt_thread_mutex_destroy(&mdb->mi_paged_mutex);
+
   ch_free(mdb);
   be->be_private = NULL;
 
@@ -519,6 +544,9 @@ int mdb_back_initialize(BackendInfo *bi) {
   Debug(LDAP_DEBUG_TRACE, LDAP_XSTRING(mdb_back_initialize) ": %u.%u.%u.%u\n", mdbx_version.major, mdbx_version.minor,
         mdbx_version.patch, mdbx_version.tweak);
 
+  mdb_idl_kernel_set(MDB_IDL_KERNEL_AUTO);
+  Debug(LDAP_DEBUG_TRACE, LDAP_XSTRING(mdb_back_initialize) ": %s IDL merge kernels\n", mdb_idl_kernel_name());
+
   bi->bi_open = 0;
   bi->bi_close = 0;
   bi->bi_config = 0;
@@ -569,7 +597,7 @@ int mdb_back_initialize(BackendInfo *bi) {
   bi->bi_tool_entry_delete = mdb_tool_entry_delete;
 
   bi->bi_connection_init = 0;
-  bi->bi_connection_destroy = 0;
+  bi->bi_connection_destroy = mdb_connection_destroy;
 
   rc = mdb_back_init_cf(bi);
 
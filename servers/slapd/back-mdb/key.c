@@ -58,3 +58,24 @@ int mdb_key_read(Backend *be, MDBX_txn *txn, MDBX_dbi dbi, struct berval *k, ID
 
   return rc;
 }
+
+/* estimate the number of IDs under a key */
+int mdb_key_count(MDBX_txn *txn, MDBX_dbi dbi, struct berval *k, ID *count) {
+  MDBX_val key;
+#ifndef MISALIGNED_OK
+  int kbuf[2];
+
+  if (k->bv_len & ALIGNER) {
+    key.iov_len = sizeof(kbuf);
+    key.iov_base = kbuf;
+    kbuf[1] = 0;
+    memcpy(kbuf, k->bv_val, k->bv_len);
+  } else
+#endif
+  {
+    key.iov_len = k->bv_len;
+    key.iov_base = k->bv_val;
+  }
+
+  return mdb_idl_count_key(txn, dbi, &key, count);
+}
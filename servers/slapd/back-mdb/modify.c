@@ -44,6 +44,8 @@ static void mdb_modify_idxflags(Operation *op, AttributeDescription *desc, int g
        * If using 32bit hashes, or substring index, must account for
        * possible index collisions. If no substring index, and using
        * 64bit hashes, assume we don't need to check for collisions.
+       * Ordered keys are cut values, so these may collide too, and
+       * n-gram keys are shared by all values having the gram.
        *
        * In 2.5 use refcounts and avoid all of this mess.
        */
@@ -54,7 +56,7 @@ static void mdb_modify_idxflags(Operation *op, AttributeDescription *desc, int g
 #else
       const int hash32width = 1;
 #endif
-      if (hash32width || (ai->ai_indexmask & SLAP_INDEX_SUBSTR)) {
+      if (hash32width || (ai->ai_indexmask & (SLAP_INDEX_SUBSTR | SLAP_INDEX_ORDERED | SLAP_INDEX_NGRAM))) {
         /* Find all other attrs that index to same slot */
         for (ap = newattrs; ap; ap = ap->a_next) {
           ai = mdb_index_mask(op->o_bd, ap->a_desc, &ix2);
@@ -0,0 +1,180 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/* Candidate lists of paged-results searches, kept between pages so
+ * that later pages resume from the saved list instead of redoing the
+ * index lookups. There is at most one list per connection, just like
+ * the connection's paged results state. The total size is bounded by
+ * "pagedcache", least recently used lists are dropped first.
+ *
+ * A list is a snapshot taken at the first page: the later pages of the
+ * search walk it, so they don't see entries added in between. Each list
+ * gets a generation number when it is saved; a page served from a list
+ * hands the number back to mdb_paged_put(), which then only moves the
+ * cookie instead of comparing the whole list.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "back-mdb.h"
+#include "idl.h"
+
+struct mdb_paged {
+  struct mdb_paged *mp_next;
+  unsigned long mp_connid;
+  ID mp_base;
+  int mp_scope;
+  struct berval mp_filter;
+  PagedResultsCookie mp_cookie;
+  unsigned long mp_gen; /* tells the list apart from a later one */
+  time_t mp_used;
+  int mp_exact; /* mp_ids are the exact matches, see mdb_filter_exact() */
+  ID mp_size; /* number of IDs in mp_ids */
+  ID mp_ids[1];
+};
+
+static void paged_free(struct mdb_info *mdb, struct mdb_paged **prev) {
+  struct mdb_paged *mp = *prev;
+
+  *prev = mp->mp_next;
+  mdb->mi_paged_used -= mp->mp_size;
+  ch_free(mp->mp_filter.bv_val);
+  ch_free(mp);
+}
+
+/* find the list of a connection, dropping expired ones on the way */
+static struct mdb_paged **paged_find(struct mdb_info *mdb, unsigned long connid) {
+  struct mdb_paged **prev = &mdb->mi_paged;
+  time_t now = ldap_time_steady();
+
+  while (*prev) {
+    if (mdb->mi_paged_ttl && (*prev)->mp_used + (time_t)mdb->mi_paged_ttl < now) {
+      paged_free(mdb, prev);
+      continue;
+    }
+    if ((*prev)->mp_connid == connid)
+      return prev;
+    prev = &(*prev)->mp_next;
+  }
+  return prev;
+}
+
+/* Copy the saved candidates into ids if the request continues the
+ * paged search they were saved for. */
+int mdb_paged_get(Operation *op, ID base, PagedResultsCookie cookie, ID *ids, int *exact, unsigned long *gen) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  struct mdb_paged **prev, *mp;
+  int rc = MDBX_NOTFOUND;
+
+  if (!mdb->mi_paged_max)
+    return rc;
+
+  ldap_pvt_thread_mutex_lock(&mdb->mi_paged_mutex);
+  prev = paged_find(mdb, op->o_connid);
+  mp = *prev;
+  if (mp && mp->mp_base == base && mp->mp_scope == op->ors_scope && mp->mp_cookie == cookie &&
+      ber_bvcmp(&mp->mp_filter, &op->ors_filterstr) == 0) {
+    memcpy(ids, mp->mp_ids, mp->mp_size * sizeof(ID));
+    *exact = mp->mp_exact;
+    *gen = mp->mp_gen;
+    /* move to front */
+    *prev = mp->mp_next;
+    mp->mp_next = mdb->mi_paged;
+    mdb->mi_paged = mp;
+    mp->mp_used = ldap_time_steady();
+    rc = 0;
+  }
+  ldap_pvt_thread_mutex_unlock(&mdb->mi_paged_mutex);
+
+  Debug(LDAP_DEBUG_TRACE, "mdb_paged_get: conn=%lu cookie=0x%08lx %s\n", op->o_connid, (unsigned long)cookie,
+        rc ? "miss" : "hit");
+  return rc;
+}
+
+/* Save the candidates of a paged search which has more pages to go.
+ * gen is what mdb_paged_get() gave for the candidates, 0 if they were
+ * computed afresh. */
+void mdb_paged_put(Operation *op, ID base, PagedResultsCookie cookie, ID *ids, int exact, unsigned long gen) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  struct mdb_paged **prev, *mp;
+  ID size = MDB_IDL_SIZEOF(ids) / sizeof(ID);
+
+  if (size > mdb->mi_paged_max) {
+    mdb_paged_drop(op->o_bd, op->o_connid);
+    return;
+  }
+
+  ldap_pvt_thread_mutex_lock(&mdb->mi_paged_mutex);
+  prev = paged_find(mdb, op->o_connid);
+  mp = *prev;
+  if (mp && gen && mp->mp_gen == gen) {
+    /* the same list, just remember the new position */
+    *prev = mp->mp_next;
+  } else {
+    if (mp)
+      paged_free(mdb, prev);
+    /* make room, dropping the least recently used */
+    while (mdb->mi_paged && mdb->mi_paged_used + size > mdb->mi_paged_max) {
+      for (prev = &mdb->mi_paged; (*prev)->mp_next; prev = &(*prev)->mp_next)
+        ;
+      paged_free(mdb, prev);
+    }
+    mp = ch_malloc(sizeof(struct mdb_paged) + (size - 1) * sizeof(ID));
+    mp->mp_connid = op->o_connid;
+    mp->mp_base = base;
+    mp->mp_scope = op->ors_scope;
+    ber_dupbv(&mp->mp_filter, &op->ors_filterstr);
+    mp->mp_exact = exact;
+    mp->mp_size = size;
+    mp->mp_gen = ++mdb->mi_paged_gen;
+    memcpy(mp->mp_ids, ids, size * sizeof(ID));
+    mdb->mi_paged_used += size;
+  }
+  mp->mp_cookie = cookie;
+  mp->mp_used = ldap_time_steady();
+  mp->mp_next = mdb->mi_paged;
+  mdb->mi_paged = mp;
+  ldap_pvt_thread_mutex_unlock(&mdb->mi_paged_mutex);
+}
+
+/* Forget the saved candidates of a connection. */
+void mdb_paged_drop(BackendDB *be, unsigned long connid) {
+  struct mdb_info *mdb = (struct mdb_info *)be->be_private;
+  struct mdb_paged **prev;
+
+  if (!mdb->mi_paged_max)
+    return;
+
+  ldap_pvt_thread_mutex_lock(&mdb->mi_paged_mutex);
+  prev = paged_find(mdb, connid);
+  if (*prev)
+    paged_free(mdb, prev);
+  ldap_pvt_thread_mutex_unlock(&mdb->mi_paged_mutex);
+}
+
+void mdb_paged_destroy(struct mdb_info *mdb) {
+  ldap_pvt_thread_mutex_lock(&mdb->mi_paged_mutex);
+  while (mdb->mi_paged)
+    paged_free(mdb, &mdb->mi_paged);
+  ldap_pvt_thread_mutex_unlock(&mdb->mi_paged_mutex);
+}
+
+int mdb_connection_destroy(BackendDB *be, Connection *conn) {
+  mdb_paged_drop(be, conn->c_connid);
+  return 0;
+}
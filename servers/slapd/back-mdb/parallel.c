@@ -0,0 +1,389 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/* Parallel candidate evaluation for mdb_search(), see "searchthreads".
+ *
+ * The candidates are cut into chunks of consecutive IDs. Helper tasks
+ * from the connection pool claim the chunks a little ahead of the
+ * search, load and decode their entries, give them their DNs and test
+ * the filter, and keep the matching ones. The search still walks the
+ * candidates in ID order and does the scope, ACL and the sending itself,
+ * it only takes the entries the helpers left for it. A chunk nobody has
+ * claimed yet when the search gets to it is done by the search itself,
+ * so it never waits on a helper which did not start.
+ *
+ * MDBX read transactions belong to their thread, so each helper reads in
+ * a transaction of its own, begun when it joins, and keeps it until the
+ * search is past its entries since those point into its pages. Like the
+ * renewal of the dreamcatcher, an entry may thus come from a snapshot a
+ * bit newer than the one the candidates were taken from.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "back-mdb.h"
+#include "idl.h"
+
+#define MDB_PAR_CHUNK 256 /* candidates per chunk */
+#define MDB_PAR_AHEAD 2   /* chunks claimed ahead of the search, per helper */
+
+#define PC_PENDING 0
+#define PC_BUSY 1    /* a helper is on it */
+#define PC_DONE 2    /* its entries are in pc_res */
+#define PC_SERIAL 3  /* left to the search */
+#define PC_PASSED 4
+
+typedef struct par_res {
+  ID pr_id;
+  Entry *pr_e;
+} par_res;
+
+typedef struct par_chunk {
+  ID pc_lo;
+  ID pc_hi;
+  int pc_state;
+  par_res *pc_res;
+  unsigned pc_nres;
+  unsigned pc_pos;
+} par_chunk;
+
+typedef struct par_helper {
+  struct mdb_par *ph_par;
+  int ph_num;
+  void *ph_cookie;
+  int ph_started;
+  int ph_exited;
+} par_helper;
+
+struct mdb_par {
+  Operation *mp_op;
+  ID *mp_ids;
+  ID mp_base;
+  ldap_pvt_thread_mutex_t mp_mutex;
+  ldap_pvt_thread_cond_t mp_cond;
+  int mp_stop;
+  unsigned mp_cur; /* the chunk the search is in */
+  unsigned mp_window;
+  unsigned mp_nchunks;
+  par_chunk *mp_chunks;
+  int mp_nhelpers;
+  par_helper mp_helpers[1];
+};
+
+static void par_free_res(Operation *op, par_chunk *pc) {
+  for (; pc->pc_pos < pc->pc_nres; pc->pc_pos++)
+    mdb_entry_return(op, pc->pc_res[pc->pc_pos].pr_e);
+  ch_free(pc->pc_res);
+  pc->pc_res = NULL;
+  pc->pc_nres = pc->pc_pos = 0;
+}
+
+/* Load the entries of a chunk and keep those the search will want.
+ * Sets *whole unless it stopped short of the end of the chunk. */
+static int par_chunk_run(Operation *op, struct mdb_par *mp, par_chunk *pc, MDBX_txn *txn, MDBX_cursor *mci,
+                         MDBX_cursor **mcd, int *whole) {
+  MDBX_val edata;
+  Entry *e;
+  ID id, cursor = pc->pc_lo;
+  int manageDSAit = get_manageDSAit(op);
+  int rc = 0, n = 0;
+
+  *whole = 0;
+  pc->pc_res = ch_malloc(MDB_PAR_CHUNK * sizeof(par_res));
+  for (id = mdb_idl_first(mp->mp_ids, &cursor); id != NOID && id <= pc->pc_hi;
+       id = mdb_idl_next(mp->mp_ids, &cursor)) {
+    if (id == mp->mp_base)
+      continue;
+    /* check the main operation every now and then */
+    if (!(++n % 32) && (mp->mp_stop || slap_get_op_abandon(mp->mp_op) || slapd_shutdown))
+      return 0;
+
+    rc = mdb_id2edata(op, mci, id, &edata);
+    if (rc == MDBX_NOTFOUND) {
+      rc = 0;
+      continue;
+    }
+    if (rc)
+      return rc;
+    rc = mdb_entry_decode(op, txn, &edata, id, &e);
+    if (rc)
+      return rc;
+    e->e_id = id;
+    BER_BVZERO(&e->e_name);
+    BER_BVZERO(&e->e_nname);
+    rc = mdb_id2name(op, txn, mcd, id, &e->e_name, &e->e_nname);
+    if (rc) {
+      mdb_entry_return(op, e);
+      return rc;
+    }
+
+    /* referrals go to the search regardless of the filter */
+    if ((!manageDSAit && op->oq_search.rs_scope != LDAP_SCOPE_BASE && is_entry_referral(e)) ||
+        test_filter(op, e, op->oq_search.rs_filter) == LDAP_COMPARE_TRUE) {
+      if (pc->pc_nres % MDB_PAR_CHUNK == 0 && pc->pc_nres)
+        pc->pc_res = ch_realloc(pc->pc_res, (pc->pc_nres + MDB_PAR_CHUNK) * sizeof(par_res));
+      pc->pc_res[pc->pc_nres].pr_id = id;
+      pc->pc_res[pc->pc_nres].pr_e = e;
+      pc->pc_nres++;
+    } else {
+      mdb_entry_return(op, e);
+    }
+  }
+  *whole = 1;
+  return 0;
+}
+
+static void *par_helper_task(void *ctx, void *arg) {
+  par_helper *ph = arg;
+  struct mdb_par *mp = ph->ph_par;
+  struct mdb_info *mdb = (struct mdb_info *)mp->mp_op->o_bd->be_private;
+  OperationBuffer opbuf;
+  Operation *op = &opbuf.ob_op;
+  mdb_op_info opinfo = {{{0}}}, *moi = &opinfo;
+  MDBX_cursor *mci = NULL, *mcd = NULL;
+  par_chunk *pc;
+  unsigned i, last = 0;
+  int rc, whole;
+
+  ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+  ph->ph_started = 1;
+  if (mp->mp_stop) {
+    ph->ph_exited = 1;
+    ldap_pvt_thread_cond_broadcast(&mp->mp_cond);
+    ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+    return NULL;
+  }
+  ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+
+  /* a copy of the search with memory of our own */
+  *op = *mp->mp_op;
+  opbuf.ob_hdr = *mp->mp_op->o_hdr;
+  op->o_hdr = &opbuf.ob_hdr;
+  op->o_threadctx = ctx;
+  op->o_tmpmemctx = NULL;
+  op->o_tmpmfuncs = &ch_mfuncs;
+  LDAP_SLIST_INIT(&op->o_extra);
+
+  rc = mdb_opinfo_get(op, mdb, 1, &moi);
+  if (rc == 0) {
+    rc = mdbx_cursor_open(moi->moi_txn, mdb->mi_id2entry, &mci);
+    if (rc == 0)
+      rc = mdbx_cursor_open(moi->moi_txn, mdb->mi_dn2id, &mcd);
+  }
+
+  ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+  while (rc == 0 && !mp->mp_stop) {
+    unsigned end = mp->mp_cur + mp->mp_window;
+    if (end > mp->mp_nchunks)
+      end = mp->mp_nchunks;
+    for (i = mp->mp_cur; i < end; i++)
+      if (mp->mp_chunks[i].pc_state == PC_PENDING)
+        break;
+    if (i == end) {
+      if (end == mp->mp_nchunks)
+        break;
+      /* too far ahead, wait for the search to catch up */
+      ldap_pvt_thread_cond_wait(&mp->mp_cond, &mp->mp_mutex);
+      continue;
+    }
+    pc = &mp->mp_chunks[i];
+    pc->pc_state = PC_BUSY;
+    ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+
+    rc = par_chunk_run(op, mp, pc, moi->moi_txn, mci, &mcd, &whole);
+
+    ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+    if (whole) {
+      pc->pc_state = PC_DONE;
+      last = i + 1;
+    } else {
+      /* the search will do it, or find out why we could not */
+      par_free_res(op, pc);
+      pc->pc_state = PC_SERIAL;
+    }
+    ldap_pvt_thread_cond_broadcast(&mp->mp_cond);
+  }
+  if (rc)
+    Debug(LDAP_DEBUG_ANY, "mdb_par: helper %d failed, %s(%d)\n", ph->ph_num, mdbx_strerror(rc), rc);
+
+  /* our entries point into our snapshot, keep it until they are used */
+  while (!mp->mp_stop && mp->mp_cur < last)
+    ldap_pvt_thread_cond_wait(&mp->mp_cond, &mp->mp_mutex);
+  ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+
+  if (mcd)
+    mdbx_cursor_close(mcd);
+  if (mci)
+    mdbx_cursor_close(mci);
+  if (moi->moi_txn) {
+    int __maybe_unused rc2 = mdbx_txn_reset(moi->moi_txn);
+    assert(rc2 == MDBX_SUCCESS);
+  }
+  if (moi->moi_oe.oe_key)
+    LDAP_SLIST_REMOVE(&op->o_extra, &moi->moi_oe, OpExtra, oe_next);
+
+  ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+  ph->ph_exited = 1;
+  ldap_pvt_thread_cond_broadcast(&mp->mp_cond);
+  ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+  return NULL;
+}
+
+struct mdb_par *mdb_par_begin(Operation *op, ID *ids, ID base, ID ncand) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  struct mdb_par *mp;
+  unsigned i, nchunks, nhelpers;
+  uint64_t span = 0;
+
+  if (!mdb->mi_search_threads || !op->o_threadctx || !(slapMode & SLAP_SERVER_MODE) || ncand < 2 * MDB_PAR_CHUNK)
+    return NULL;
+
+  nchunks = (ncand + MDB_PAR_CHUNK - 1) / MDB_PAR_CHUNK;
+  nhelpers = mdb->mi_search_threads;
+  if (nhelpers > nchunks - 1)
+    nhelpers = nchunks - 1;
+
+  mp = ch_calloc(1, sizeof(struct mdb_par) + (nhelpers - 1) * sizeof(par_helper));
+  mp->mp_chunks = ch_calloc(nchunks, sizeof(par_chunk));
+  mp->mp_op = op;
+  mp->mp_ids = ids;
+  mp->mp_base = base;
+  mp->mp_nchunks = nchunks;
+  mp->mp_window = nhelpers * MDB_PAR_AHEAD;
+
+  if (!MDB_IDL_IS_LIST(ids))
+    span = MDB_IDL_LAST(ids) - MDB_IDL_FIRST(ids) + 1;
+  for (i = 0; i < nchunks; i++) {
+    par_chunk *pc = &mp->mp_chunks[i];
+    if (MDB_IDL_IS_LIST(ids)) {
+      /* cut a list by position */
+      ID hi = (i + 1) * MDB_PAR_CHUNK;
+      pc->pc_lo = ids[i * MDB_PAR_CHUNK + 1];
+      pc->pc_hi = ids[hi < ids[0] ? hi : ids[0]];
+    } else {
+      /* and ranges and bitmaps by ID */
+      pc->pc_lo = MDB_IDL_FIRST(ids) + (ID)(span * i / nchunks);
+      pc->pc_hi = MDB_IDL_FIRST(ids) + (ID)(span * (i + 1) / nchunks) - 1;
+    }
+  }
+
+  ldap_pvt_thread_mutex_init(&mp->mp_mutex);
+  ldap_pvt_thread_cond_init(&mp->mp_cond);
+
+  for (i = 0; i < nhelpers; i++) {
+    par_helper *ph = &mp->mp_helpers[mp->mp_nhelpers];
+    ph->ph_par = mp;
+    ph->ph_num = mp->mp_nhelpers;
+    if (ldap_pvt_thread_pool_submit2(&connection_pool, par_helper_task, ph, &ph->ph_cookie))
+      break;
+    mp->mp_nhelpers++;
+  }
+  if (!mp->mp_nhelpers) {
+    mdb_par_end(op, mp);
+    return NULL;
+  }
+
+  Debug(LDAP_DEBUG_TRACE, "mdb_par_begin: %u chunks, %d helpers\n", nchunks, mp->mp_nhelpers);
+  return mp;
+}
+
+/* Called by the search for each candidate in scope, in ID order. Tells
+ * whether the search has to load the entry itself, or hands over the one
+ * a helper loaded, or says the helper found it does not match.
+ */
+int mdb_par_take(Operation *op, struct mdb_par *mp, ID id, Entry **ep) {
+  par_chunk *pc;
+  int rc = MDB_PAR_SERIAL;
+
+  if (id == mp->mp_base)
+    return MDB_PAR_SERIAL;
+
+  ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+  /* leave the chunks behind */
+  while (mp->mp_cur < mp->mp_nchunks && id > mp->mp_chunks[mp->mp_cur].pc_hi) {
+    pc = &mp->mp_chunks[mp->mp_cur];
+    if (pc->pc_state == PC_PENDING)
+      pc->pc_state = PC_PASSED;
+    while (pc->pc_state == PC_BUSY)
+      ldap_pvt_thread_cond_wait(&mp->mp_cond, &mp->mp_mutex);
+    if (pc->pc_state == PC_DONE)
+      par_free_res(op, pc);
+    pc->pc_state = PC_PASSED;
+    mp->mp_cur++;
+    ldap_pvt_thread_cond_broadcast(&mp->mp_cond);
+  }
+  if (mp->mp_cur == mp->mp_nchunks || id < mp->mp_chunks[mp->mp_cur].pc_lo)
+    goto out;
+
+  pc = &mp->mp_chunks[mp->mp_cur];
+  if (pc->pc_state == PC_PENDING) {
+    /* nobody got to it, do it ourselves */
+    pc->pc_state = PC_SERIAL;
+    goto out;
+  }
+  while (pc->pc_state == PC_BUSY)
+    ldap_pvt_thread_cond_wait(&mp->mp_cond, &mp->mp_mutex);
+  if (pc->pc_state != PC_DONE)
+    goto out;
+
+  while (pc->pc_pos < pc->pc_nres && pc->pc_res[pc->pc_pos].pr_id < id) {
+    mdb_entry_return(op, pc->pc_res[pc->pc_pos].pr_e);
+    pc->pc_pos++;
+  }
+  if (pc->pc_pos < pc->pc_nres && pc->pc_res[pc->pc_pos].pr_id == id) {
+    *ep = pc->pc_res[pc->pc_pos].pr_e;
+    pc->pc_pos++;
+    rc = MDB_PAR_ENTRY;
+  } else {
+    rc = MDB_PAR_SKIP;
+  }
+
+out:
+  ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+  return rc;
+}
+
+void mdb_par_end(Operation *op, struct mdb_par *mp) {
+  unsigned i;
+  int n;
+
+  ldap_pvt_thread_mutex_lock(&mp->mp_mutex);
+  mp->mp_stop = 1;
+  ldap_pvt_thread_cond_broadcast(&mp->mp_cond);
+  /* take back the helpers still in the queue */
+  for (n = 0; n < mp->mp_nhelpers; n++) {
+    par_helper *ph = &mp->mp_helpers[n];
+    if (!ph->ph_started && ldap_pvt_thread_pool_retract(ph->ph_cookie) > 0)
+      ph->ph_started = ph->ph_exited = 1;
+  }
+  /* and wait for the others */
+  for (n = 0; n < mp->mp_nhelpers; n++) {
+    while (!mp->mp_helpers[n].ph_exited)
+      ldap_pvt_thread_cond_wait(&mp->mp_cond, &mp->mp_mutex);
+  }
+  ldap_pvt_thread_mutex_unlock(&mp->mp_mutex);
+
+  for (i = 0; i < mp->mp_nchunks; i++)
+    if (mp->mp_chunks[i].pc_res)
+      par_free_res(op, &mp->mp_chunks[i]);
+
+  ldap_pvt_thread_cond_destroy(&mp->mp_cond);
+  ldap_pvt_thread_mutex_destroy(&mp->mp_mutex);
+  ch_free(mp->mp_chunks);
+  ch_free(mp);
+}
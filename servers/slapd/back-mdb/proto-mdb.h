@@ -47,6 +47,13 @@ void mdb_attr_multi_unparse(struct mdb_info *mdb, BerVarray *bva);
 
 void mdb_attr_multi_thresh(struct mdb_info *mdb, AttributeDescription *ad, unsigned *hi, unsigned *lo);
 
+int mdb_attr_ngram_config(struct mdb_info *mdb, const char *fname, int lineno, int argc, char **argv,
+                          struct config_reply_s *cr);
+
+void mdb_attr_ngram_unparse(struct mdb_info *mdb, BerVarray *bva);
+
+unsigned mdb_attr_ngram_len(struct mdb_info *mdb, AttrInfo *ai);
+
 void mdb_attr_info_free(AttrInfo *ai);
 
 int mdb_ad_read(struct mdb_info *mdb, MDBX_txn *txn);
@@ -95,6 +102,12 @@ int mdb_idscopechk(Operation *op, struct IdScopes *isc);
 
 int mdb_dn2id_walk(Operation *op, struct IdScopes *isc);
 
+int mdb_dn2id_range(Operation *op, MDBX_txn *txn, ID id, ID *lo, ID *hi);
+
+int mdb_dn2id_range_add(Operation *op, MDBX_cursor *mc, ID pid, ID id);
+
+int mdb_dn2id_ranges_open(BackendDB *be, MDBX_txn *txn);
+
 void mdb_dn2id_wrestore(Operation *op, struct IdScopes *isc);
 
 MDBX_cmp_func mdb_dup_compare;
@@ -104,6 +117,7 @@ MDBX_cmp_func mdb_dup_compare;
  */
 
 int mdb_filter_candidates(Operation *op, MDBX_txn *txn, Filter *f, ID *ids, ID *tmp, ID *stack);
+int mdb_filter_exact(Operation *op, MDBX_txn *txn, Filter *f, ID *ids, ID *tmp, ID *stack);
 
 /*
  * id2entry.c
@@ -130,6 +144,7 @@ BI_op_txn mdb_txn;
 #endif
 
 int mdb_entry_decode(Operation *op, MDBX_txn *txn, MDBX_val *data, ID id, Entry **e);
+int mdb_entry_substrings(Operation *op, MDBX_cursor *mc, ID id, SubstringsAssertion *sub);
 
 void mdb_reader_flush(MDBX_env *env);
 int mdb_opinfo_get(Operation *op, struct mdb_info *mdb, int rdonly, mdb_op_info **moi);
@@ -146,8 +161,15 @@ unsigned mdb_idl_search(ID *ids, ID id);
 int mdb_idl_fetch_key(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, ID *ids, MDBX_cursor **saved_cursor,
                       int get_flag);
 
+int mdb_idl_read_cursor(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_cursor *cursor, MDBX_val *key, ID *ids);
+
 int mdb_idl_insert(ID *ids, ID id);
 
+int mdb_idl_count_key(MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, ID *count);
+
+int mdb_idl_fetch_range(BackendDB *be, MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *lo, MDBX_val *hi, ID *ids, ID *tmp,
+                        ID limit);
+
 typedef int(mdb_idl_keyfunc)(BackendDB *be, MDBX_cursor *mc, struct berval *key, ID id);
 
 mdb_idl_keyfunc mdb_idl_insert_keys;
@@ -157,6 +179,12 @@ int mdb_idl_intersection(ID *a, ID *b);
 
 int mdb_idl_union(ID *a, ID *b);
 
+int mdb_idl_notin(ID *a, ID *b, ID *ids);
+
+int mdb_idl_contains(ID *ids, ID id);
+
+int mdb_idl_bitmap_drop(struct mdb_info *mdb, MDBX_txn *txn, AttributeDescription *ad);
+
 ID mdb_idl_first(ID *ids, ID *cursor);
 ID mdb_idl_next(ID *ids, ID *cursor);
 
@@ -164,6 +192,15 @@ void mdb_idl_sort(ID *ids, ID *tmp);
 int mdb_idl_append(ID *a, ID *b);
 int mdb_idl_append_one(ID *ids, ID id);
 
+/*
+ * idlmerge.c
+ */
+
+int mdb_idl_kernel_set(int kind);
+const char *mdb_idl_kernel_name(void);
+void mdb_idl_and_lists(ID *a, ID *b, ID lo, ID hi);
+int mdb_idl_or_lists(ID *a, ID *b);
+
 /*
  * index.c
  */
@@ -173,6 +210,12 @@ extern AttrInfo *mdb_index_mask(Backend *be, AttributeDescription *desc, struct
 extern int mdb_index_param(Backend *be, AttributeDescription *desc, int ftype, MDBX_dbi *dbi, slap_mask_t *mask,
                            struct berval *prefix);
 
+int mdb_index_ordered_rule(AttributeType *at);
+int mdb_index_ordered_keys(AttributeType *at, BerVarray vals, BerVarray *keysp, void *ctx);
+int mdb_index_ngram_rule(AttributeType *at);
+void mdb_index_ngram_key(struct berval *key, int kind, const char *src, ber_len_t n, int reverse, void *ctx);
+int mdb_index_ngram_keys(unsigned len, BerVarray vals, BerVarray *keysp, void *ctx);
+
 extern int mdb_index_values(Operation *op, MDBX_txn *txn, AttributeDescription *desc, BerVarray vals, ID id, int opid);
 
 extern int mdb_index_recset(struct mdb_info *mdb, Attribute *a, AttributeType *type, struct berval *tags, IndexRec *ir);
@@ -191,6 +234,8 @@ int mdb_index_entry(Operation *op, MDBX_txn *t, int r, Entry *e);
 extern int mdb_key_read(Backend *be, MDBX_txn *txn, MDBX_dbi dbi, struct berval *k, ID *ids, MDBX_cursor **saved_cursor,
                         int get_flags);
 
+extern int mdb_key_count(MDBX_txn *txn, MDBX_dbi dbi, struct berval *k, ID *count);
+
 /*
  * nextid.c
  */
@@ -217,6 +262,34 @@ int mdb_monitor_db_destroy(BackendDB *be);
 int mdb_monitor_idx_add(struct mdb_info *mdb, AttributeDescription *desc, slap_mask_t type);
 #endif /* MDB_MONITOR_IDX */
 
+/*
+ * paged.c
+ */
+
+int mdb_paged_get(Operation *op, ID base, PagedResultsCookie cookie, ID *ids, int *exact, unsigned long *gen);
+void mdb_paged_put(Operation *op, ID base, PagedResultsCookie cookie, ID *ids, int exact, unsigned long gen);
+void mdb_paged_drop(BackendDB *be, unsigned long connid);
+void mdb_paged_destroy(struct mdb_info *mdb);
+
+/*
+ * parallel.c
+ */
+
+struct mdb_par *mdb_par_begin(Operation *op, ID *ids, ID base, ID ncand);
+int mdb_par_take(Operation *op, struct mdb_par *mp, ID id, Entry **ep);
+void mdb_par_end(Operation *op, struct mdb_par *mp);
+
+/*
+ * sort.c
+ */
+
+struct mdb_sort *mdb_sort_begin(Operation *op, MDBX_txn *txn, MDBX_cursor *mci, ID *ids);
+ID mdb_sort_next(Operation *op, struct mdb_sort *ms);
+int mdb_sort_check(Operation *op, struct mdb_sort *ms, Entry *e);
+int mdb_sort_take(Operation *op, struct mdb_sort *ms, Entry *e);
+void mdb_sort_renew(struct mdb_sort *ms);
+void mdb_sort_end(Operation *op, struct mdb_sort *ms);
+
 /*
  * former external.h
  */
@@ -240,6 +313,8 @@ extern BI_operational mdb_operational;
 
 extern BI_has_subordinates mdb_hasSubordinates;
 
+extern BI_connection_destroy mdb_connection_destroy;
+
 /* tools.c */
 extern BI_tool_entry_open mdb_tool_entry_open;
 extern BI_tool_entry_close mdb_tool_entry_close;
@@ -26,6 +26,10 @@ static int base_candidate(BackendDB *be, Entry *e, ID *ids);
 static int search_candidates(Operation *op, SlapReply *rs, Entry *e, IdScopes *isc, MDBX_cursor *mci, ID *ids,
                              ID *stack);
 
+static int search_dnonly(Operation *op);
+
+static int search_exact(Operation *op, IdScopes *isc, ID *ids, ID *stack, int *exact);
+
 static int parse_paged_cookie(Operation *op, SlapReply *rs);
 
 static void send_paged_response(Operation *op, SlapReply *rs, ID *lastid, int tentries);
@@ -394,7 +398,12 @@ int mdb_search(Operation *op, SlapReply *rs) {
   slap_mask_t mask;
   time_t stoptime;
   int manageDSAit;
+  int paged;
+  unsigned long paged_gen = 0; /* of the saved candidates reused, see paged.c */
+  int exact = 0, dnonly = 0;
   int tentries = 0;
+  struct mdb_sort *ms = NULL;
+  struct mdb_par *par = NULL;
   IdScopes isc;
   MDBX_cursor *mci, *mcd;
   ww_ctx wwctx = {0};
@@ -406,6 +415,7 @@ int mdb_search(Operation *op, SlapReply *rs) {
   Debug(LDAP_DEBUG_TRACE, "=> " LDAP_XSTRING(mdb_search) "\n");
 
   manageDSAit = get_manageDSAit(op);
+  paged = get_pagedresults(op) > SLAP_CONTROL_IGNORED;
 
   rs->sr_err = mdb_opinfo_get(op, mdb, 1, &moi);
   switch (rs->sr_err) {
@@ -603,7 +613,31 @@ dn2entry_retry:
     scopes[0].mid = 1;
     scopes[1].mid = base->e_id;
     scopes[1].mval.iov_base = NULL;
-    rs->sr_err = search_candidates(op, rs, base, &isc, mci, candidates, stack);
+    rs->sr_err = MDBX_NOTFOUND;
+    if (paged && mdb->mi_paged_max && !(op->ors_deref & LDAP_DEREF_SEARCHING) &&
+        ((PagedResultsState *)op->o_pagedresults_state)->ps_cookieval.bv_len == sizeof(PagedResultsCookie)) {
+      /* a later page, try the candidates saved by the previous one */
+      PagedResultsCookie reqcookie;
+      memcpy(&reqcookie, ((PagedResultsState *)op->o_pagedresults_state)->ps_cookieval.bv_val, sizeof(reqcookie));
+      rs->sr_err = mdb_paged_get(op, base->e_id, reqcookie, candidates, &exact, &paged_gen);
+    }
+    if (rs->sr_err != LDAP_SUCCESS && search_dnonly(op))
+      rs->sr_err = search_exact(op, &isc, candidates, stack, &exact);
+    if (rs->sr_err != LDAP_SUCCESS)
+      rs->sr_err = search_candidates(op, rs, base, &isc, mci, candidates, stack);
+    if (exact && search_dnonly(op)) {
+      Debug(LDAP_DEBUG_TRACE, LDAP_XSTRING(mdb_search) ": index-only, DNs from dn2id\n");
+      dnonly = 1;
+    }
+    if (mdb->mi_subtree_ranges && base->e_id && !(op->ors_deref & LDAP_DEREF_SEARCHING) &&
+        !MDB_IDL_IS_ZERO(candidates)) {
+      /* nothing outside the base's subtree range can be in scope */
+      ID lo, hi, range[3];
+      if (mdb_dn2id_range(op, ltid, base->e_id, &lo, &hi) == 0) {
+        MDB_IDL_RANGE(range, lo, hi);
+        mdb_idl_intersection(candidates, range);
+      }
+    }
     ncand = MDB_IDL_N(candidates);
     if (!base->e_id || ncand == NOID) {
       /* grab entry count from id2entry stat
@@ -639,6 +673,17 @@ dn2entry_retry:
     tentries = ncand;
   }
 
+  /* take the candidates in the order of a server side sort */
+  ms = mdb_sort_begin(op, ltid, mci, candidates);
+  if (ms) {
+    nsubs = ncand; /* always bypass scope'd search */
+    dnonly = 0;
+  }
+
+  /* load and filter the candidates on helper threads */
+  if (!ms && !dnonly && !paged && nsubs >= ncand && op->ors_scope != LDAP_SCOPE_BASE)
+    par = mdb_par_begin(op, candidates, base->e_id, ncand);
+
   wwctx.txn = ltid;
   /* If we're running in our own read txn */
   if (moi == &opinfo) {
@@ -704,15 +749,18 @@ dn2entry_retry:
     else
       id = isc.id;
     cscope = 0;
+  } else if (ms) {
+    id = mdb_sort_next(op, ms);
   } else {
     id = mdb_idl_first(candidates, &cursor);
   }
 
   while (id != NOID) {
-    int scopeok;
+    int scopeok, prefetched;
     MDBX_val edata;
 
   loop_begin:
+    prefetched = 0;
 
     /* check for abandon */
     if (slap_get_op_abandon(op)) {
@@ -740,17 +788,8 @@ dn2entry_retry:
     }
 
     if (nsubs < ncand) {
-      unsigned i;
       /* Is this entry in the candidate list? */
-      scopeok = 0;
-      if (MDB_IDL_IS_RANGE(candidates)) {
-        if (id >= MDB_IDL_RANGE_FIRST(candidates) && id <= MDB_IDL_RANGE_LAST(candidates))
-          scopeok = 1;
-      } else {
-        i = mdb_idl_search(candidates, id);
-        if (i <= candidates[0] && candidates[i] == id)
-          scopeok = 1;
-      }
+      scopeok = mdb_idl_contains(candidates, id);
       if (scopeok)
         goto scopeok;
       goto loop_continue;
@@ -804,13 +843,24 @@ dn2entry_retry:
   scopeok:
     if (id == base->e_id) {
       e = base;
+    } else if (dnonly) {
+      /* the candidates are the exact matches and none of them is
+       * a referral, alias, subentry or glue: the DN is enough */
+      e = op->o_tmpcalloc(1, sizeof(Entry), op->o_tmpmemctx);
+      e->e_private = e;
+      e->e_id = id;
+      e->e_ocflags = SLAP_OC__END;
+    } else if (par && (prefetched = mdb_par_take(op, par, id, &e)) != MDB_PAR_SERIAL) {
+      /* a helper has loaded it, named it and tested the filter */
+      if (prefetched == MDB_PAR_SKIP)
+        goto loop_continue;
     } else {
 
       /* get the entry */
       rs->sr_err = mdb_id2edata(op, mci, id, &edata);
       if (rs->sr_err == MDBX_NOTFOUND) {
       notfound:
-        if (nsubs < ncand)
+        if (nsubs < ncand || ms)
           goto loop_continue;
 
         if (!MDB_IDL_IS_RANGE(candidates)) {
@@ -851,6 +901,10 @@ dn2entry_retry:
       e->e_nname.bv_val = NULL;
     }
 
+    /* not where the sort would put it */
+    if (ms && !mdb_sort_check(op, ms, e))
+      goto loop_continue;
+
     if (is_entry_subentry(e)) {
       if (op->oq_search.rs_scope != LDAP_SCOPE_BASE) {
         if (!get_subentries_visibility(op)) {
@@ -882,7 +936,7 @@ dn2entry_retry:
       goto loop_continue;
     }
 
-    if (e != base) {
+    if (e != base && !prefetched) {
       struct berval pdn, pndn;
       char *d, *n;
       int i;
@@ -966,15 +1020,35 @@ dn2entry_retry:
     }
 
     /* if it matches the filter and scope, send it */
-    rs->sr_err = test_filter(op, e, op->oq_search.rs_filter);
+    if ((dnonly || prefetched) && e != base)
+      rs->sr_err = LDAP_COMPARE_TRUE;
+    else
+      rs->sr_err = test_filter(op, e, op->oq_search.rs_filter);
 
     if (rs->sr_err == LDAP_COMPARE_TRUE) {
+      if (ms) {
+        int take = mdb_sort_take(op, ms, e);
+        if (take < 0) {
+          /* the page of the sort is full */
+          if (e != base)
+            mdb_entry_return(op, e);
+          e = NULL;
+          goto nochange;
+        }
+        if (!take)
+          goto loop_continue;
+      }
+
       /* check size limit */
       if (get_pagedresults(op) > SLAP_CONTROL_IGNORED) {
         if (rs->sr_nentries >= ((PagedResultsState *)op->o_pagedresults_state)->ps_size) {
           if (e != base)
             mdb_entry_return(op, e);
           e = NULL;
+          if (mdb->mi_paged_max && !(op->ors_deref & LDAP_DEREF_SEARCHING) && op->ors_scope != LDAP_SCOPE_BASE) {
+            mdb_paged_put(op, base->e_id, lastid, candidates, exact, paged_gen);
+            paged = 2; /* keep the candidates for the next page */
+          }
           send_paged_response(op, rs, &lastid, tentries);
           goto done;
         }
@@ -1054,6 +1128,8 @@ dn2entry_retry:
         send_ldap_result(op, rs);
         goto done;
       }
+      if (ms)
+        mdb_sort_renew(ms);
     }
 
     if (e != NULL) {
@@ -1091,6 +1167,8 @@ dn2entry_retry:
         }
       } else
         id = isc.id;
+    } else if (ms) {
+      id = mdb_sort_next(op, ms);
     } else {
       id = mdb_idl_next(candidates, &cursor);
     }
@@ -1122,6 +1200,14 @@ done:
       scp = &(*scp)->sc_next;
     }
   }
+  if (paged == 1 && mdb->mi_paged_max) {
+    /* the last page, abandoned or failed */
+    mdb_paged_drop(op->o_bd, op->o_connid);
+  }
+  if (ms)
+    mdb_sort_end(op, ms);
+  if (par)
+    mdb_par_end(op, par);
   mdbx_cursor_close(mcd);
   mdbx_cursor_close(mci);
   if (rs->sr_v2ref) {
@@ -1295,6 +1381,83 @@ static int search_candidates(Operation *op, SlapReply *rs, Entry *e, IdScopes *i
   return rc;
 }
 
+/* Searches asking for no attributes but the DN are answered without
+ * reading the entries when the indices resolve the filter exactly.
+ * The rest of the entry must be of no interest to anyone else either:
+ * no callbacks, and no ACLs which could look at the attributes.
+ */
+static int search_dnonly(Operation *op) {
+  AttributeName *an;
+  if (op->ors_attrs == NULL || BER_BVISNULL(&op->ors_attrs[0].an_name) || op->o_callback != NULL ||
+      op->ors_scope == LDAP_SCOPE_BASE || (op->ors_deref & LDAP_DEREF_SEARCHING) || get_subentries_visibility(op))
+    return 0;
+
+  for (an = op->ors_attrs; !BER_BVISNULL(&an->an_name); an++) {
+    if (an->an_desc != slap_schema.si_ad_entryDN && !bvmatch(&an->an_name, slap_bv_no_attrs))
+      return 0;
+  }
+
+  return be_isroot(op) ||
+         (op->o_bd->be_acl == NULL && frontendDB->be_acl == NULL && op->o_bd->be_dfltaccess >= ACL_READ);
+}
+
+/* Resolve the filter by mdb_filter_exact(). On success *exact tells
+ * whether the search may skip the entries, i.e. none of the matches
+ * needs the special handling of referrals, aliases, subentries or
+ * glue; either way ids are valid candidates.
+ */
+static int search_exact(Operation *op, IdScopes *isc, ID *ids, ID *stack, int *exact) {
+  struct mdb_info *mdb = (struct mdb_info *)op->o_bd->be_private;
+  int rc, depth = 1;
+  Filter of, sf[4];
+  AttributeAssertion aa[4] = {ATTRIBUTEASSERTION_INIT, ATTRIBUTEASSERTION_INIT, ATTRIBUTEASSERTION_INIT,
+                              ATTRIBUTEASSERTION_INIT};
+  ObjectClass *ocs[4];
+  int i;
+
+  *exact = 0;
+
+  /* same stack layout as search_candidates() */
+  (void)oc_filter(op->ors_filter, 1, &depth);
+  if (depth + 1 > mdb->mi_search_stack_depth)
+    return MDBX_RESULT_TRUE;
+
+  rc = mdb_filter_exact(op, isc->mt, op->ors_filter, ids, stack, stack + MDB_IDL_UM_SIZE);
+  if (rc)
+    return MDBX_RESULT_TRUE;
+  if (MDB_IDL_IS_ZERO(ids)) {
+    *exact = 1;
+    return LDAP_SUCCESS;
+  }
+
+  /* (|(objectClass=referral)(objectClass=alias)
+   *   (objectClass=subentry)(objectClass=glue)) */
+  ocs[0] = slap_schema.si_oc_referral;
+  ocs[1] = slap_schema.si_oc_alias;
+  ocs[2] = slap_schema.si_oc_subentry;
+  ocs[3] = slap_schema.si_oc_glue;
+  for (i = 0; i < 4; i++) {
+    sf[i].f_choice = LDAP_FILTER_EQUALITY;
+    sf[i].f_ava = &aa[i];
+    sf[i].f_av_desc = slap_schema.si_ad_objectClass;
+    sf[i].f_av_value = ocs[i]->soc_cname;
+    sf[i].f_next = i < 3 ? &sf[i + 1] : NULL;
+  }
+  of.f_choice = LDAP_FILTER_OR;
+  of.f_or = sf;
+  of.f_next = NULL;
+
+  rc = mdb_filter_exact(op, isc->mt, &of, stack, stack + MDB_IDL_UM_SIZE, stack + 2 * MDB_IDL_UM_SIZE);
+  if (rc == 0) {
+    mdb_idl_intersection(stack, ids);
+    *exact = MDB_IDL_IS_ZERO(stack);
+  }
+
+  Debug(LDAP_DEBUG_TRACE, "mdb_search_exact: id=%ld first=%ld last=%ld%s\n", (long)ids[0], (long)MDB_IDL_FIRST(ids),
+        (long)MDB_IDL_LAST(ids), *exact ? "" : ", entries needed");
+  return LDAP_SUCCESS;
+}
+
 static int parse_paged_cookie(Operation *op, SlapReply *rs) {
   int rc = LDAP_SUCCESS;
   PagedResultsState *ps = op->o_pagedresults_state;
@@ -0,0 +1,576 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+/* Server side sorting served from an ordered index. Instead of walking
+ * the candidates in ID order, mdb_search() takes them from a walk of the
+ * index keys of the sort attribute, so the entries go out in the order
+ * requested and the sort overlay passes them on as they come, see
+ * SortedSearch in slap.h.
+ *
+ * An entry sorts by the least of its values, so it is only taken under
+ * the key of that value. Keys cut to MDB_ORDERED_KEYLEN may stand for
+ * several values, the candidates of such a key are sorted by value.
+ * The entries without the attribute come last, or first when reversed,
+ * just as the sort overlay does it.
+ *
+ * A page of a paged search goes on after the last entry of the previous
+ * one, see sort_resume().
+ *
+ * For VLV the IDs of all the matching entries are collected first, to
+ * know the content count and the target, then the window around the
+ * target is sent.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "back-mdb.h"
+#include "idl.h"
+
+#define MS_WALK 1    /* the entries with the attribute, in key order */
+#define MS_MISSING 2 /* the candidates without it */
+#define MS_LIST 3    /* the VLV window out of ms_list */
+#define MS_DONE 4
+
+struct mdb_sort {
+  SortedSearch *ms_ss;
+  MDBX_txn *ms_txn;
+  MDBX_dbi ms_dbi;
+  MDBX_cursor *ms_cursor; /* on the ordered index */
+  MDBX_cursor *ms_mci;    /* on id2entry */
+  ID *ms_cands;
+  int ms_step;
+  int ms_phase;
+
+  MDBX_val ms_key; /* the current key of the walk */
+  char ms_keybuf[MDB_ORDERED_KEYLEN];
+  ID *ms_slot; /* the IDs under it */
+  ID *ms_sorted;
+  ID ms_nsorted; /* ms_sorted holds them if the key is a cut one */
+  ID ms_cur;
+  ID ms_from; /* the first ID to look at, when resuming */
+  int ms_first;
+
+  unsigned char *ms_seen; /* the IDs taken by the walk */
+  ID ms_lo;
+  ID ms_hi;
+  struct berval *ms_val; /* the value the checked entry sorts by */
+
+  int ms_pos;  /* the entries taken so far */
+  int ms_sent; /* and sent */
+  int ms_skip; /* the ones to skip, unless resumed */
+
+  ID *ms_list; /* VLV: the matching entries */
+  ID ms_nlist;
+  ID ms_maxlist;
+  ID ms_target;  /* the first one not before ss_vlv_value */
+  ID ms_listend; /* the end of the window */
+};
+
+static const int ms_steps[2][4] = {{MS_WALK, MS_MISSING, MS_LIST, MS_DONE}, {MS_MISSING, MS_WALK, MS_LIST, MS_DONE}};
+
+#define SEEN_SET(ms, id) ((ms)->ms_seen[((id) - (ms)->ms_lo) >> 3] |= 1 << (((id) - (ms)->ms_lo) & 7))
+#define SEEN_GET(ms, id) ((ms)->ms_seen[((id) - (ms)->ms_lo) >> 3] & (1 << (((id) - (ms)->ms_lo) & 7)))
+
+/* RFC 2891 Section 2.2: the least value of a multi-valued attribute */
+static struct berval *sort_value(Attribute *a, MatchingRule *mr) {
+  struct berval *bv = a->a_nvals;
+  unsigned i;
+  int cmp;
+
+  for (i = 1; i < a->a_numvals; i++) {
+    mr->smr_match(&cmp, 0, mr->smr_syntax, mr, bv, &a->a_nvals[i]);
+    if (cmp > 0)
+      bv = &a->a_nvals[i];
+  }
+  return bv;
+}
+
+/* Sort the candidates under a cut key by their values, ties stay in
+ * ID order whichever the direction. */
+static void sort_slot(Operation *op, struct mdb_sort *ms) {
+  SortedSearch *ss = ms->ms_ss;
+  MatchingRule *mr = ss->ss_ordering;
+  struct berval *vals;
+  ID id, cursor, i, j, n = 0;
+  Entry *e;
+  Attribute *a;
+  int cmp;
+
+  cursor = 0;
+  for (id = mdb_idl_first(ms->ms_slot, &cursor); id != NOID; id = mdb_idl_next(ms->ms_slot, &cursor)) {
+    if (mdb_idl_contains(ms->ms_cands, id))
+      n++;
+  }
+  ms->ms_sorted = op->o_tmpalloc((n + 1) * sizeof(ID), op->o_tmpmemctx);
+  vals = op->o_tmpalloc((n + 1) * sizeof(struct berval), op->o_tmpmemctx);
+  ms->ms_nsorted = 0;
+
+  cursor = 0;
+  for (id = mdb_idl_first(ms->ms_slot, &cursor); id != NOID; id = mdb_idl_next(ms->ms_slot, &cursor)) {
+    if (ms->ms_nsorted == n)
+      break;
+    if (!mdb_idl_contains(ms->ms_cands, id) || mdb_id2entry(op, ms->ms_mci, id, &e))
+      continue;
+    i = ms->ms_nsorted++;
+    BER_BVZERO(&vals[i]);
+    a = attr_find(e->e_attrs, ss->ss_ad);
+    if (a)
+      ber_dupbv_x(&vals[i], sort_value(a, mr), op->o_tmpmemctx);
+    mdb_entry_return(op, e);
+
+    /* insert after the equal ones */
+    for (j = i; j > 0; j--) {
+      if (BER_BVISNULL(&vals[i]) || BER_BVISNULL(&vals[j - 1])) {
+        /* without the value it can't be taken here anyway */
+        cmp = BER_BVISNULL(&vals[i]) ? -1 : 1;
+      } else {
+        mr->smr_match(&cmp, 0, mr->smr_syntax, mr, &vals[j - 1], &vals[i]);
+        if (ss->ss_reverse)
+          cmp = -cmp;
+      }
+      if (cmp <= 0)
+        break;
+    }
+    if (j < i) {
+      struct berval bv = vals[i];
+      memmove(&vals[j + 1], &vals[j], (i - j) * sizeof(struct berval));
+      memmove(&ms->ms_sorted[j + 1], &ms->ms_sorted[j], (i - j) * sizeof(ID));
+      vals[j] = bv;
+    }
+    ms->ms_sorted[j] = id;
+  }
+
+  for (i = 0; i < ms->ms_nsorted; i++) {
+    if (!BER_BVISNULL(&vals[i]))
+      op->o_tmpfree(vals[i].bv_val, op->o_tmpmemctx);
+  }
+  op->o_tmpfree(vals, op->o_tmpmemctx);
+}
+
+/* Read the IDs under the key the cursor is on */
+static int sort_key_read(Operation *op, struct mdb_sort *ms, MDBX_val *key) {
+  int rc = MDBX_CORRUPTED;
+
+  if (key->iov_len <= sizeof(ms->ms_keybuf))
+    rc = mdb_idl_read_cursor(op->o_bd, ms->ms_txn, ms->ms_dbi, ms->ms_cursor, key, ms->ms_slot);
+  if (rc != MDBX_SUCCESS) {
+    if (rc != MDBX_NOTFOUND)
+      Debug(LDAP_DEBUG_ANY, "mdb_sort_next: %s walk failed: %s (%d)\n", ms->ms_ss->ss_ad->ad_cname.bv_val,
+            mdbx_strerror(rc), rc);
+    return rc;
+  }
+
+  memcpy(ms->ms_keybuf, key->iov_base, key->iov_len);
+  ms->ms_key.iov_base = ms->ms_keybuf;
+  ms->ms_key.iov_len = key->iov_len;
+  ms->ms_first = 1;
+
+  if (key->iov_len == MDB_ORDERED_KEYLEN && MDB_IDL_N(ms->ms_slot) > 1) {
+    sort_slot(op, ms);
+    ms->ms_cur = 0;
+  }
+  return rc;
+}
+
+/* Move the walk to the next key and read its IDs */
+static int sort_key_next(Operation *op, struct mdb_sort *ms) {
+  int reverse = ms->ms_ss->ss_reverse;
+  MDBX_val key, data;
+  int rc;
+
+  if (ms->ms_sorted) {
+    op->o_tmpfree(ms->ms_sorted, op->o_tmpmemctx);
+    ms->ms_sorted = NULL;
+  }
+
+  if (!ms->ms_key.iov_base) {
+    rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, reverse ? MDBX_LAST : MDBX_FIRST);
+  } else {
+    /* the cursor may have been renewed, find the key again */
+    key = ms->ms_key;
+    rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, MDBX_SET_RANGE);
+    if (rc == MDBX_SUCCESS) {
+      if (reverse)
+        rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, MDBX_PREV_NODUP);
+      else if (mdbx_cmp(ms->ms_txn, ms->ms_dbi, &key, &ms->ms_key) == 0)
+        rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, MDBX_NEXT_NODUP);
+    } else if (rc == MDBX_NOTFOUND && reverse) {
+      rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, MDBX_LAST);
+    }
+  }
+  if (rc == MDBX_SUCCESS)
+    rc = sort_key_read(op, ms, &key);
+  return rc;
+}
+
+/* Place the VLV window, the same way the sort overlay does it */
+static void sort_window(struct mdb_sort *ms) {
+  SortedSearch *ss = ms->ms_ss;
+  ID n = ms->ms_nlist, pos, back = 0;
+
+  ss->ss_nentries = n;
+  ms->ms_cur = ms->ms_listend = 0;
+  if (!n)
+    return;
+
+  if (!BER_BVISNULL(&ss->ss_vlv_value)) {
+    /* past the last one if there is none */
+    pos = ms->ms_target == NOID ? n : ms->ms_target;
+    ss->ss_target = pos + 1;
+  } else {
+    ID target;
+
+    if (ss->ss_vlv_offset == ss->ss_vlv_count) {
+      target = n;
+    } else if (ss->ss_vlv_offset == 1) {
+      target = 1;
+    } else if (ss->ss_vlv_count && (ID)ss->ss_vlv_count != n) {
+      if (ss->ss_vlv_offset > ss->ss_vlv_count)
+        goto range_err;
+      target = n * ss->ss_vlv_offset / ss->ss_vlv_count;
+    } else {
+      if ((ID)ss->ss_vlv_offset > n)
+        goto range_err;
+      target = ss->ss_vlv_offset;
+    }
+    ss->ss_target = target;
+    pos = target ? target - 1 : 0;
+  }
+
+  if (pos >= n) {
+    pos = n - 1;
+    back = 1;
+  }
+  for (; back < (ID)ss->ss_vlv_before && pos > 0; back++)
+    pos--;
+  ms->ms_cur = pos;
+  ms->ms_listend = pos + back + ss->ss_vlv_after + 1;
+  if (ms->ms_listend > n)
+    ms->ms_listend = n;
+  return;
+
+range_err:
+  ss->ss_range = 1;
+}
+
+/* The next candidate in the order of the sort */
+ID mdb_sort_next(Operation *op, struct mdb_sort *ms) {
+  ID id;
+
+  for (;;) {
+    switch (ms->ms_phase) {
+    case MS_WALK:
+      if (ms->ms_sorted) {
+        if (ms->ms_cur < ms->ms_nsorted)
+          return ms->ms_sorted[ms->ms_cur++];
+      } else if (ms->ms_key.iov_base) {
+        if (ms->ms_first) {
+          ms->ms_cur = ms->ms_from > ms->ms_lo ? ms->ms_from : ms->ms_lo;
+          id = mdb_idl_first(ms->ms_slot, &ms->ms_cur);
+          ms->ms_first = 0;
+          ms->ms_from = 0;
+        } else {
+          id = mdb_idl_next(ms->ms_slot, &ms->ms_cur);
+        }
+        for (; id != NOID && id <= ms->ms_hi; id = mdb_idl_next(ms->ms_slot, &ms->ms_cur)) {
+          if (mdb_idl_contains(ms->ms_cands, id))
+            return id;
+        }
+      }
+      if (sort_key_next(op, ms) == MDBX_SUCCESS)
+        continue;
+      break;
+
+    case MS_MISSING:
+      if (ms->ms_first) {
+        ms->ms_cur = ms->ms_from;
+        id = mdb_idl_first(ms->ms_cands, &ms->ms_cur);
+        ms->ms_first = 0;
+        ms->ms_from = 0;
+      } else {
+        id = mdb_idl_next(ms->ms_cands, &ms->ms_cur);
+      }
+      for (; id != NOID && id <= ms->ms_hi; id = mdb_idl_next(ms->ms_cands, &ms->ms_cur)) {
+        if (!ms->ms_seen || !SEEN_GET(ms, id))
+          return id;
+      }
+      break;
+
+    case MS_LIST:
+      if (ms->ms_cur < ms->ms_listend)
+        return ms->ms_list[ms->ms_cur++];
+      break;
+
+    default:
+      return NOID;
+    }
+
+    ms->ms_phase = ms_steps[ms->ms_ss->ss_reverse != 0][++ms->ms_step];
+    ms->ms_first = 1;
+    if (ms->ms_phase == MS_LIST) {
+      if (ms->ms_ss->ss_vlv)
+        sort_window(ms);
+      else
+        ms->ms_phase = MS_DONE;
+    }
+  }
+}
+
+/* Whether the entry sorts where the walk is */
+int mdb_sort_check(Operation *op, struct mdb_sort *ms, Entry *e) {
+  SortedSearch *ss = ms->ms_ss;
+  struct berval vals[2], *keys;
+  Attribute *a;
+  int rc;
+
+  ms->ms_val = NULL;
+  a = attr_find(e->e_attrs, ss->ss_ad);
+
+  switch (ms->ms_phase) {
+  case MS_WALK:
+    if (!a)
+      return 0;
+    vals[0] = *sort_value(a, ss->ss_ordering);
+    BER_BVZERO(&vals[1]);
+    if (mdb_index_ordered_keys(ss->ss_ad->ad_type, vals, &keys, op->o_tmpmemctx) != LDAP_SUCCESS || !keys)
+      return 0;
+    rc = keys[0].bv_len == ms->ms_key.iov_len && !memcmp(keys[0].bv_val, ms->ms_key.iov_base, keys[0].bv_len);
+    ber_bvarray_free_x(keys, op->o_tmpmemctx);
+    if (rc) {
+      ms->ms_val = sort_value(a, ss->ss_ordering);
+      if (ms->ms_seen)
+        SEEN_SET(ms, e->e_id);
+    }
+    return rc;
+
+  case MS_MISSING:
+    return a == NULL;
+
+  case MS_LIST:
+    return 1;
+  }
+  return 0;
+}
+
+/* An entry which matched the filter: 1 to send it, 0 to skip it,
+ * -1 when the page is full. */
+int mdb_sort_take(Operation *op, struct mdb_sort *ms, Entry *e) {
+  SortedSearch *ss = ms->ms_ss;
+
+  if (ms->ms_phase == MS_LIST)
+    return 1;
+
+  if (ss->ss_vlv) {
+    if (ms->ms_nlist == ms->ms_maxlist) {
+      ms->ms_maxlist = ms->ms_maxlist ? ms->ms_maxlist * 2 : MDB_IDL_DB_SIZE;
+      ms->ms_list = ch_realloc(ms->ms_list, ms->ms_maxlist * sizeof(ID));
+    }
+    if (ms->ms_target == NOID && !BER_BVISNULL(&ss->ss_vlv_value)) {
+      MatchingRule *mr = ss->ss_ordering;
+      int cmp = -1;
+
+      if (ms->ms_val) {
+        mr->smr_match(&cmp, 0, mr->smr_syntax, mr, ms->ms_val, &ss->ss_vlv_value);
+        if (ss->ss_reverse)
+          cmp = -cmp;
+      } else if (!ss->ss_reverse) {
+        /* without the value it sorts after any */
+        cmp = 1;
+      }
+      if (cmp >= 0)
+        ms->ms_target = ms->ms_nlist;
+    }
+    ms->ms_list[ms->ms_nlist++] = e->e_id;
+    return 0;
+  }
+
+  if (ms->ms_pos++ < ms->ms_skip)
+    return 0;
+  if (ss->ss_size && ms->ms_sent >= ss->ss_size) {
+    ss->ss_more = 1;
+    return -1;
+  }
+  ms->ms_sent++;
+  ss->ss_after = e->e_id;
+  if (ms->ms_sent == ss->ss_size) {
+    /* the last one of the page, the next page goes on from its value */
+    if (!BER_BVISNULL(&ss->ss_after_val))
+      op->o_tmpfree(ss->ss_after_val.bv_val, op->o_tmpmemctx);
+    BER_BVZERO(&ss->ss_after_val);
+    if (ms->ms_val)
+      ber_dupbv_x(&ss->ss_after_val, ms->ms_val, op->o_tmpmemctx);
+  }
+  return 1;
+}
+
+/* Where the walk of a cut key goes on: after the last entry of the
+ * previous page or, if it is gone, after the ones sorting before it */
+static ID sort_slot_after(Operation *op, struct mdb_sort *ms) {
+  SortedSearch *ss = ms->ms_ss;
+  MatchingRule *mr = ss->ss_ordering;
+  Attribute *a;
+  Entry *e;
+  ID i;
+  int cmp;
+
+  for (i = 0; i < ms->ms_nsorted; i++) {
+    if (ms->ms_sorted[i] == ss->ss_after)
+      return i + 1;
+  }
+
+  for (i = 0; i < ms->ms_nsorted; i++) {
+    if (mdb_id2entry(op, ms->ms_mci, ms->ms_sorted[i], &e))
+      continue;
+    cmp = 1;
+    a = attr_find(e->e_attrs, ss->ss_ad);
+    if (a) {
+      mr->smr_match(&cmp, 0, mr->smr_syntax, mr, sort_value(a, mr), &ss->ss_after_val);
+      if (ss->ss_reverse)
+        cmp = -cmp;
+    }
+    mdb_entry_return(op, e);
+    if (cmp > 0 || (cmp == 0 && ms->ms_sorted[i] > ss->ss_after))
+      break;
+  }
+  return i;
+}
+
+/* Put the walk right after the last entry of the previous page, by
+ * the value it sorted by, so the entry itself may be gone by now. That
+ * is under the key of the value, or with the ones without the attribute. */
+static int sort_resume(Operation *op, struct mdb_sort *ms) {
+  SortedSearch *ss = ms->ms_ss;
+  int reverse = ss->ss_reverse != 0;
+  struct berval vals[2], *keys = NULL;
+  MDBX_val key, data;
+  int rc;
+
+  if (BER_BVISNULL(&ss->ss_after_val)) {
+    ms->ms_step = !reverse;
+    ms->ms_from = ss->ss_after + 1;
+    rc = 0;
+  } else {
+    ms->ms_step = reverse;
+    vals[0] = ss->ss_after_val;
+    BER_BVZERO(&vals[1]);
+    rc = mdb_index_ordered_keys(ss->ss_ad->ad_type, vals, &keys, op->o_tmpmemctx);
+    if (rc == LDAP_SUCCESS && keys) {
+      key.iov_base = keys[0].bv_val;
+      key.iov_len = keys[0].bv_len;
+      rc = mdbx_cursor_get(ms->ms_cursor, &key, &data, MDBX_SET);
+      if (rc == MDBX_SUCCESS) {
+        rc = sort_key_read(op, ms, &key);
+      } else if (rc == MDBX_NOTFOUND && keys[0].bv_len <= sizeof(ms->ms_keybuf)) {
+        /* nothing sorts by it anymore, go on from the next key */
+        memcpy(ms->ms_keybuf, keys[0].bv_val, keys[0].bv_len);
+        ms->ms_key.iov_base = ms->ms_keybuf;
+        ms->ms_key.iov_len = keys[0].bv_len;
+        MDB_IDL_ZERO(ms->ms_slot);
+        rc = MDBX_SUCCESS;
+      }
+      ber_bvarray_free_x(keys, op->o_tmpmemctx);
+    } else {
+      rc = -1;
+    }
+    if (rc == MDBX_SUCCESS) {
+      if (ms->ms_sorted)
+        ms->ms_cur = sort_slot_after(op, ms);
+      else
+        ms->ms_from = ss->ss_after + 1;
+    }
+  }
+  ms->ms_phase = ms_steps[reverse][ms->ms_step];
+  return rc;
+}
+
+/* The walk must go on in the renewed read txn */
+void mdb_sort_renew(struct mdb_sort *ms) { mdbx_cursor_renew(ms->ms_txn, ms->ms_cursor); }
+
+/* Set up a sorted walk of the candidates, if the search asks for a sort
+ * this database can serve from an ordered index. */
+struct mdb_sort *mdb_sort_begin(Operation *op, MDBX_txn *txn, MDBX_cursor *mci, ID *ids) {
+  SortedSearch *ss = slap_sorted_search(op);
+  struct mdb_sort *ms;
+  AttributeDescription *ad;
+  struct berval prefix = BER_BVNULL;
+  slap_mask_t mask;
+  MDBX_dbi dbi;
+
+  /* the filter candidates end at the last entry, see mdb_filter_candidates(),
+   * so a range up to NOID is not worth a bitmap of the entries seen */
+  if (!ss || op->ors_scope == LDAP_SCOPE_BASE || (op->ors_deref & LDAP_DEREF_SEARCHING) || MDB_IDL_LAST(ids) == NOID)
+    return NULL;
+
+  ad = ss->ss_ad;
+  if (ad != ad->ad_type->sat_ad || ss->ss_ordering != ad->ad_type->sat_ordering ||
+      !mdb_index_ordered_rule(ad->ad_type) ||
+      mdb_index_param(op->o_bd, ad, LDAP_FILTER_GE, &dbi, &mask, &prefix) != LDAP_SUCCESS)
+    return NULL;
+
+  ms = op->o_tmpcalloc(1, sizeof(struct mdb_sort), op->o_tmpmemctx);
+  if (mdbx_cursor_open(txn, dbi, &ms->ms_cursor) != MDBX_SUCCESS) {
+    op->o_tmpfree(ms, op->o_tmpmemctx);
+    return NULL;
+  }
+  ms->ms_ss = ss;
+  ms->ms_txn = txn;
+  ms->ms_dbi = dbi;
+  ms->ms_mci = mci;
+  ms->ms_cands = ids;
+  ms->ms_slot = ch_malloc(MDB_IDL_UM_SIZEOF);
+  ms->ms_target = NOID;
+
+  ms->ms_lo = MDB_IDL_FIRST(ids);
+  ms->ms_hi = MDB_IDL_LAST(ids);
+
+  /* when the entries without the attribute come last, skip the ones
+   * the walk has taken */
+  if (!ss->ss_reverse && ms->ms_lo <= ms->ms_hi)
+    ms->ms_seen = ch_calloc(1, ((ms->ms_hi - ms->ms_lo) >> 3) + 1);
+
+  ms->ms_phase = ms_steps[ss->ss_reverse != 0][0];
+  ms->ms_first = 1;
+  if (ss->ss_after && sort_resume(op, ms)) {
+    /* it can't be found, count from the beginning */
+    if (ms->ms_sorted) {
+      op->o_tmpfree(ms->ms_sorted, op->o_tmpmemctx);
+      ms->ms_sorted = NULL;
+    }
+    ms->ms_key.iov_base = NULL;
+    ms->ms_from = 0;
+    ms->ms_step = 0;
+    ms->ms_phase = ms_steps[ss->ss_reverse != 0][0];
+    ms->ms_first = 1;
+    ms->ms_skip = ss->ss_offset;
+  }
+  ss->ss_served = 1;
+
+  Debug(LDAP_DEBUG_TRACE, "mdb_sort_begin: %s%s from the ordered index\n", ss->ss_reverse ? "-" : "",
+        ad->ad_cname.bv_val);
+  return ms;
+}
+
+void mdb_sort_end(Operation *op, struct mdb_sort *ms) {
+  if (ms->ms_sorted)
+    op->o_tmpfree(ms->ms_sorted, op->o_tmpmemctx);
+  mdbx_cursor_close(ms->ms_cursor);
+  ch_free(ms->ms_slot);
+  ch_free(ms->ms_seen);
+  ch_free(ms->ms_list);
+  op->o_tmpfree(ms, op->o_tmpmemctx);
+}
@@ -68,6 +68,13 @@ static unsigned nholes;
 
 static struct berval *tool_base;
 static int tool_scope;
+
+/* With subtreeranges, slapcat walks the DIT in preorder so that reloading
+ * its output gives every subtree a contiguous range of entryIDs.
+ */
+static MDBX_cursor *tool_ditcursor;
+static ID *tool_dit;
+static unsigned tool_ndit, tool_mdit;
 static Filter *tool_filter;
 static Entry *tool_next_entry;
 
@@ -148,6 +155,13 @@ static int mdb_tool_terminate_txn(BackendDB *be, MDBX_txn *txn, int abort) {
     mdbx_cursor_close(idcursor);
     idcursor = NULL;
   }
+  if (tool_ditcursor) {
+    mdbx_cursor_close(tool_ditcursor);
+    tool_ditcursor = NULL;
+  }
+  ch_free(tool_dit);
+  tool_dit = NULL;
+  tool_ndit = tool_mdit = 0;
   if (cursor) {
     mdbx_cursor_close(cursor);
     cursor = NULL;
@@ -234,6 +248,13 @@ int mdb_tool_entry_close(BackendDB *be) {
     mdbx_cursor_close(idcursor);
     idcursor = NULL;
   }
+  if (tool_ditcursor) {
+    mdbx_cursor_close(tool_ditcursor);
+    tool_ditcursor = NULL;
+  }
+  ch_free(tool_dit);
+  tool_dit = NULL;
+  tool_ndit = tool_mdit = 0;
   if (cursor) {
     mdbx_cursor_close(cursor);
     cursor = NULL;
@@ -281,6 +302,37 @@ int mdb_tool_entry_close(BackendDB *be) {
   return 0;
 }
 
+/* Push the children of pid, the first child ends up on top */
+static int mdb_tool_dit_push(ID pid) {
+  MDBX_val dkey, ddata;
+  unsigned first = tool_ndit, i, j;
+  int rc;
+
+  dkey.iov_base = &pid;
+  dkey.iov_len = sizeof(ID);
+  rc = mdbx_cursor_get(tool_ditcursor, &dkey, &ddata, MDBX_SET);
+  while (rc == 0) {
+    /* skip our own node */
+    if (*(unsigned char *)ddata.iov_base & 0x80) {
+      if (tool_ndit == tool_mdit) {
+        tool_mdit = tool_mdit ? tool_mdit * 2 : 1024;
+        tool_dit = ch_realloc(tool_dit, tool_mdit * sizeof(ID));
+      }
+      memcpy(&tool_dit[tool_ndit++], (char *)ddata.iov_base + ddata.iov_len - 2 * sizeof(ID), sizeof(ID));
+    }
+    rc = mdbx_cursor_get(tool_ditcursor, &dkey, &ddata, MDBX_NEXT_DUP);
+  }
+  if (rc != MDBX_NOTFOUND)
+    return rc;
+
+  for (i = first, j = tool_ndit; i + 1 < j; i++, j--) {
+    ID tmp = tool_dit[i];
+    tool_dit[i] = tool_dit[j - 1];
+    tool_dit[j - 1] = tmp;
+  }
+  return 0;
+}
+
 ID mdb_tool_entry_first_x(BackendDB *be, struct berval *base, int scope, Filter *f) {
   tool_base = base;
   tool_scope = scope;
@@ -309,12 +361,32 @@ ID mdb_tool_entry_next(BackendDB *be) {
       mdb_tool_txn_abort(be, mdb_tool_txn);
       return NOID;
     }
+    if (mdb->mi_subtree_ranges && (slapMode & SLAP_TOOL_READONLY) && !BER_BVISEMPTY(&be->be_nsuffix[0])) {
+      rc = mdbx_cursor_open(mdb_tool_txn, mdb->mi_dn2id, &tool_ditcursor);
+      if (rc == 0)
+        rc = mdb_tool_dit_push(0);
+      if (rc)
+        return NOID;
+    }
   }
 
 next:;
-  rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT);
-  if (rc) {
-    return NOID;
+  if (tool_ditcursor) {
+    if (!tool_ndit)
+      return NOID;
+    previd = tool_dit[--tool_ndit];
+    if (mdb_tool_dit_push(previd))
+      return NOID;
+    key.iov_base = &previd;
+    key.iov_len = sizeof(ID);
+    rc = mdbx_cursor_get(cursor, &key, &data, MDBX_SET);
+    if (rc)
+      goto next;
+  } else {
+    rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT);
+    if (rc) {
+      return NOID;
+    }
   }
 
   previd = *(ID *)key.iov_base;
@@ -836,6 +908,34 @@ int mdb_tool_entry_reindex(BackendDB *be, ID id, AttributeDescription **adv) {
               mi->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
         goto done;
       }
+      if (mi->mi_attrs[i]->ai_odbi) {
+        rc = mdbx_drop(txi, mi->mi_attrs[i]->ai_odbi, 0);
+        if (rc) {
+          Debug(LDAP_DEBUG_ANY,
+                LDAP_XSTRING(mdb_tool_entry_reindex) ": (Truncate) mdbx_drop(%s" MDB_ORDERED_SUFFIX ") "
+                                                     "failed: %s (%d)\n",
+                mi->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
+          goto done;
+        }
+      }
+      if (mi->mi_attrs[i]->ai_gdbi) {
+        rc = mdbx_drop(txi, mi->mi_attrs[i]->ai_gdbi, 0);
+        if (rc) {
+          Debug(LDAP_DEBUG_ANY,
+                LDAP_XSTRING(mdb_tool_entry_reindex) ": (Truncate) mdbx_drop(%s" MDB_NGRAM_SUFFIX ") "
+                                                     "failed: %s (%d)\n",
+                mi->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
+          goto done;
+        }
+      }
+      rc = mdb_idl_bitmap_drop(mi, txi, mi->mi_attrs[i]->ai_desc);
+      if (rc) {
+        Debug(LDAP_DEBUG_ANY,
+              LDAP_XSTRING(mdb_tool_entry_reindex) ": (Truncate) mdb_idl_bitmap_drop(%s) "
+                                                   "failed: %s (%d)\n",
+              mi->mi_attrs[i]->ai_desc->ad_type->sat_cname.bv_val, mdbx_strerror(rc), rc);
+        goto done;
+      }
     }
     slapMode ^= SLAP_TRUNCATE_MODE;
   }
@@ -151,6 +151,7 @@ enum {
   SLAPD_MONITOR_DATABASE,
   SLAPD_MONITOR_LISTENER,
   SLAPD_MONITOR_LOG,
+  SLAPD_MONITOR_MEMORY,
   SLAPD_MONITOR_OPS,
   SLAPD_MONITOR_OVERLAY,
   SLAPD_MONITOR_SASL,
@@ -185,6 +186,10 @@ enum {
 #define SLAPD_MONITOR_LOG_RDN SLAPD_MONITOR_AT "=" SLAPD_MONITOR_LOG_NAME
 #define SLAPD_MONITOR_LOG_DN SLAPD_MONITOR_LOG_RDN "," SLAPD_MONITOR_DN
 
+#define SLAPD_MONITOR_MEMORY_NAME "Memory"
+#define SLAPD_MONITOR_MEMORY_RDN SLAPD_MONITOR_AT "=" SLAPD_MONITOR_MEMORY_NAME
+#define SLAPD_MONITOR_MEMORY_DN SLAPD_MONITOR_MEMORY_RDN "," SLAPD_MONITOR_DN
+
 #define SLAPD_MONITOR_OPS_NAME "Operations"
 #define SLAPD_MONITOR_OPS_RDN SLAPD_MONITOR_AT "=" SLAPD_MONITOR_OPS_NAME
 #define SLAPD_MONITOR_OPS_DN SLAPD_MONITOR_OPS_RDN "," SLAPD_MONITOR_DN
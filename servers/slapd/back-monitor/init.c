@@ -144,6 +144,19 @@ static struct monitor_subsys_t known_monitor_subsys[] = {
         NULL, /* create */
         NULL, /* modify */
     },
+    {
+        SLAPD_MONITOR_MEMORY_NAME,
+        BER_BVNULL,
+        BER_BVNULL,
+        BER_BVNULL,
+        {BER_BVC("This subsystem contains information about memory usage."), BER_BVNULL},
+        MONITOR_F_PERSISTENT_CH,
+        monitor_subsys_memory_init,
+        NULL, /* destroy */
+        NULL, /* update */
+        NULL, /* create */
+        NULL  /* modify */
+    },
     {
         SLAPD_MONITOR_OPS_NAME,
         BER_BVNULL,
@@ -228,8 +241,12 @@ static struct monitor_subsys_t known_monitor_subsys[] = {
         BER_BVNULL,
         BER_BVNULL,
         {BER_BVC("This subsystem contains information about TLS."), BER_BVNULL},
-        MONITOR_F_NONE,
+        MONITOR_F_PERSISTENT_CH,
+#ifdef WITH_TLS
+        monitor_subsys_tls_init,
+#else
         NULL, /* init */
+#endif
         NULL, /* destroy */
         NULL, /* update */
         NULL, /* create */
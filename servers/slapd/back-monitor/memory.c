@@ -0,0 +1,342 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2001-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "slap.h"
+#include "back-monitor.h"
+
+
+static int monitor_subsys_memory_destroy(BackendDB *be, monitor_subsys_t *ms);
+
+static int monitor_subsys_memory_update(Operation *op, SlapReply *rs, Entry *e);
+
+enum {
+  MONITOR_MEM_ENTRIES = 0,
+  MONITOR_MEM_ENTRIES_FREE,
+  MONITOR_MEM_ENTRY_REFILLS,
+  MONITOR_MEM_ENTRY_RETURNS,
+  MONITOR_MEM_ATTRS,
+  MONITOR_MEM_ATTRS_FREE,
+  MONITOR_MEM_ATTR_REFILLS,
+  MONITOR_MEM_ATTR_RETURNS,
+  MONITOR_MEM_BER_HITS,
+  MONITOR_MEM_BER_MISSES,
+  MONITOR_MEM_BER_RETAINED,
+
+  MONITOR_MEM_LAST
+};
+
+struct monitor_memory_t {
+  struct berval rdn;
+  struct berval nrdn;
+} monitor_memory[] = {{BER_BVC("cn=Entries"), BER_BVNULL},
+                      {BER_BVC("cn=Free Entries"), BER_BVNULL},
+                      {BER_BVC("cn=Entry Refills"), BER_BVNULL},
+                      {BER_BVC("cn=Entry Returns"), BER_BVNULL},
+                      {BER_BVC("cn=Attributes"), BER_BVNULL},
+                      {BER_BVC("cn=Free Attributes"), BER_BVNULL},
+                      {BER_BVC("cn=Attribute Refills"), BER_BVNULL},
+                      {BER_BVC("cn=Attribute Returns"), BER_BVNULL},
+                      {BER_BVC("cn=BER Buffer Hits"), BER_BVNULL},
+                      {BER_BVC("cn=BER Buffer Misses"), BER_BVNULL},
+                      {BER_BVC("cn=BER Buffer Bytes"), BER_BVNULL},
+                      {BER_BVNULL, BER_BVNULL}};
+
+/* heap usage of the subsystems, indexed by slap_mem_tag */
+struct monitor_memtag_t {
+  struct berval rdn;
+  struct berval nrdn;
+  unsigned long allocs; /* ms_allocs and time at the previous update */
+  slap_time_t time;
+  unsigned long rate;
+} monitor_memtag[] = {{BER_BVC("cn=Connection Buffers"), BER_BVNULL},
+                      {BER_BVC("cn=Entry Free Lists"), BER_BVNULL},
+                      {BER_BVC("cn=Slab Arenas"), BER_BVNULL},
+                      {BER_BVC("cn=Syncprov Session Logs"), BER_BVNULL},
+                      {BER_BVC("cn=Proxy Cache Queries"), BER_BVNULL},
+                      {BER_BVC("cn=Sort Trees"), BER_BVNULL},
+                      {BER_BVNULL, BER_BVNULL}};
+
+int monitor_subsys_memory_init(BackendDB *be, monitor_subsys_t *ms) {
+  monitor_info_t *mi;
+
+  Entry **ep, *e_memory;
+  monitor_entry_t *mp;
+  int i;
+
+  assert(be != NULL);
+
+  ms->mss_destroy = monitor_subsys_memory_destroy;
+  ms->mss_update = monitor_subsys_memory_update;
+
+  mi = (monitor_info_t *)be->be_private;
+
+  if (monitor_cache_get(mi, &ms->mss_ndn, &e_memory)) {
+    Debug(LDAP_DEBUG_ANY,
+          "monitor_subsys_memory_init: "
+          "unable to get entry \"%s\"\n",
+          ms->mss_ndn.bv_val);
+    return -1;
+  }
+
+  mp = (monitor_entry_t *)e_memory->e_private;
+  mp->mp_children = NULL;
+  ep = &mp->mp_children;
+  int rc = -1;
+
+  for (i = 0; i < MONITOR_MEM_LAST; i++) {
+    struct berval nrdn, bv;
+    Entry *e;
+
+    e = monitor_entry_stub(&ms->mss_dn, &ms->mss_ndn, &monitor_memory[i].rdn, mi->mi_oc_monitorCounterObject, NULL,
+                           NULL);
+
+    if (e == NULL) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_memory_init: "
+            "unable to create entry \"%s,%s\"\n",
+            monitor_memory[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    /* steal normalized RDN */
+    dnRdn(&e->e_nname, &nrdn);
+    ber_dupbv(&monitor_memory[i].nrdn, &nrdn);
+
+    BER_BVSTR(&bv, "0");
+    attr_merge_one(e, mi->mi_ad_monitorCounter, &bv, NULL);
+
+    mp = monitor_entrypriv_create();
+    if (mp == NULL) {
+      goto bailout;
+    }
+    e->e_private = (void *)mp;
+    mp->mp_info = ms;
+    mp->mp_flags = ms->mss_flags | MONITOR_F_SUB | MONITOR_F_PERSISTENT;
+
+    if (monitor_cache_add(mi, e)) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_memory_init: "
+            "unable to add entry \"%s,%s\"\n",
+            monitor_memory[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    *ep = e;
+    ep = &mp->mp_next;
+  }
+
+  for (i = 0; i < SLAP_MEM_LAST; i++) {
+    struct berval nrdn, bv;
+    Entry *e;
+
+    e = monitor_entry_stub(&ms->mss_dn, &ms->mss_ndn, &monitor_memtag[i].rdn, mi->mi_oc_monitorCounterObject, NULL,
+                           NULL);
+
+    if (e == NULL) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_memory_init: "
+            "unable to create entry \"%s,%s\"\n",
+            monitor_memtag[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    dnRdn(&e->e_nname, &nrdn);
+    ber_dupbv(&monitor_memtag[i].nrdn, &nrdn);
+    monitor_memtag[i].time = ldap_now_steady();
+
+    BER_BVSTR(&bv, "0");
+    attr_merge_one(e, mi->mi_ad_monitorCounter, &bv, NULL);
+    BER_BVSTR(&bv, "peak=0 allocs=0 frees=0 rate=0/s");
+    attr_merge_one(e, mi->mi_ad_monitoredInfo, &bv, NULL);
+
+    mp = monitor_entrypriv_create();
+    if (mp == NULL) {
+      goto bailout;
+    }
+    e->e_private = (void *)mp;
+    mp->mp_info = ms;
+    mp->mp_flags = ms->mss_flags | MONITOR_F_SUB | MONITOR_F_PERSISTENT;
+
+    if (monitor_cache_add(mi, e)) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_memory_init: "
+            "unable to add entry \"%s,%s\"\n",
+            monitor_memtag[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    *ep = e;
+    ep = &mp->mp_next;
+  }
+
+  rc = 0;
+
+bailout:
+  monitor_cache_release(mi, e_memory);
+  return rc;
+}
+
+static int monitor_subsys_memory_destroy(BackendDB *be, monitor_subsys_t *ms) {
+  int i;
+
+  for (i = 0; i < MONITOR_MEM_LAST; i++) {
+    if (!BER_BVISNULL(&monitor_memory[i].nrdn)) {
+      ch_free(monitor_memory[i].nrdn.bv_val);
+    }
+  }
+  for (i = 0; i < SLAP_MEM_LAST; i++) {
+    if (!BER_BVISNULL(&monitor_memtag[i].nrdn)) {
+      ch_free(monitor_memtag[i].nrdn.bv_val);
+    }
+  }
+
+  return 0;
+}
+
+/* the entry is locked by the caller, which also protects monitor_memtag[tag] */
+static int monitor_subsys_memtag_update(monitor_info_t *mi, Entry *e, slap_mem_tag tag) {
+  struct monitor_memtag_t *mt = &monitor_memtag[tag];
+  slap_mem_stats ms;
+  Attribute *a;
+  char buf[4 * LDAP_PVT_INTTYPE_CHARS(unsigned long) + sizeof("peak= allocs= frees= rate=/s")];
+  ber_len_t len;
+  slap_time_t now;
+
+  slap_mem_stats_get(tag, &ms);
+  now = ldap_now_steady();
+  if (now.ns > mt->time.ns) {
+    mt->rate = (ms.ms_allocs - mt->allocs) * (uint64_t)1000000000 / (now.ns - mt->time.ns);
+    mt->allocs = ms.ms_allocs;
+    mt->time = now;
+  }
+
+  a = attr_find(e->e_attrs, mi->mi_ad_monitorCounter);
+  assert(a != NULL);
+  len = snprintf(buf, sizeof(buf), "%lu", ms.ms_bytes);
+  if (len > a->a_vals[0].bv_len) {
+    a->a_vals[0].bv_val = ber_memrealloc(a->a_vals[0].bv_val, len + 1);
+  }
+  a->a_vals[0].bv_len = len;
+  memcpy(a->a_vals[0].bv_val, buf, len + 1);
+
+  a = attr_find(e->e_attrs, mi->mi_ad_monitoredInfo);
+  assert(a != NULL);
+  len = snprintf(buf, sizeof(buf), "peak=%lu allocs=%lu frees=%lu rate=%lu/s", ms.ms_peak, ms.ms_allocs, ms.ms_frees,
+                 mt->rate);
+  if (len > a->a_vals[0].bv_len) {
+    a->a_vals[0].bv_val = ber_memrealloc(a->a_vals[0].bv_val, len + 1);
+  }
+  a->a_vals[0].bv_len = len;
+  memcpy(a->a_vals[0].bv_val, buf, len + 1);
+
+  return SLAP_CB_CONTINUE;
+}
+
+static int monitor_subsys_memory_update(Operation *op, SlapReply *rs, Entry *e) {
+  monitor_info_t *mi = (monitor_info_t *)op->o_bd->be_private;
+
+  struct berval nrdn;
+  slap_freelist_stats fs;
+  struct lber_bufpool_stats bs;
+  unsigned long n;
+  Attribute *a;
+  char buf[LDAP_PVT_INTTYPE_CHARS(unsigned long)];
+  ber_len_t len;
+  int i;
+
+  assert(mi != NULL);
+  assert(e != NULL);
+
+  dnRdn(&e->e_nname, &nrdn);
+
+  for (i = 0; i < MONITOR_MEM_LAST; i++) {
+    if (dn_match(&nrdn, &monitor_memory[i].nrdn)) {
+      break;
+    }
+  }
+
+  if (i == MONITOR_MEM_LAST) {
+    for (i = 0; i < SLAP_MEM_LAST; i++) {
+      if (dn_match(&nrdn, &monitor_memtag[i].nrdn)) {
+        return monitor_subsys_memtag_update(mi, e, i);
+      }
+    }
+    return SLAP_CB_CONTINUE;
+  }
+
+  if (i < MONITOR_MEM_ATTRS)
+    entry_freelist_stats(&fs);
+  else if (i < MONITOR_MEM_BER_HITS)
+    attr_freelist_stats(&fs);
+  else
+    ber_get_option(NULL, LBER_OPT_BUFPOOL_STATS, &bs);
+  switch (i) {
+  case MONITOR_MEM_ENTRIES:
+  case MONITOR_MEM_ATTRS:
+    n = fs.fs_total;
+    break;
+
+  case MONITOR_MEM_ENTRIES_FREE:
+  case MONITOR_MEM_ATTRS_FREE:
+    n = fs.fs_free;
+    break;
+
+  case MONITOR_MEM_ENTRY_REFILLS:
+  case MONITOR_MEM_ATTR_REFILLS:
+    n = fs.fs_refills;
+    break;
+
+  case MONITOR_MEM_ENTRY_RETURNS:
+  case MONITOR_MEM_ATTR_RETURNS:
+    n = fs.fs_returns;
+    break;
+
+  case MONITOR_MEM_BER_HITS:
+    n = bs.bps_hits;
+    break;
+
+  case MONITOR_MEM_BER_MISSES:
+    n = bs.bps_misses;
+    break;
+
+  case MONITOR_MEM_BER_RETAINED:
+    n = bs.bps_retained;
+    break;
+
+  default:
+    LDAP_BUG();
+  }
+
+  a = attr_find(e->e_attrs, mi->mi_ad_monitorCounter);
+  assert(a != NULL);
+
+  snprintf(buf, sizeof(buf), "%lu", n);
+  len = strlen(buf);
+  if (len > a->a_vals[0].bv_len) {
+    a->a_vals[0].bv_val = ber_memrealloc(a->a_vals[0].bv_val, len + 1);
+  }
+  a->a_vals[0].bv_len = len;
+  memcpy(a->a_vals[0].bv_val, buf, len + 1);
+
+  /* FIXME: touch modifyTimestamp? */
+
+  return SLAP_CB_CONTINUE;
+}
+
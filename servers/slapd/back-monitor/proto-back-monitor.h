@@ -114,6 +114,11 @@ extern int monitor_subsys_listener_init(BackendDB *be, monitor_subsys_t *ms);
  */
 extern int monitor_subsys_log_init(BackendDB *be, monitor_subsys_t *ms);
 
+/*
+ * memory
+ */
+extern int monitor_subsys_memory_init(BackendDB *be, monitor_subsys_t *ms);
+
 /*
  * operations
  */
@@ -139,6 +144,11 @@ extern int monitor_subsys_thread_init(BackendDB *be, monitor_subsys_t *ms);
  */
 extern int monitor_subsys_time_init(BackendDB *be, monitor_subsys_t *ms);
 
+/*
+ * TLS
+ */
+extern int monitor_subsys_tls_init(BackendDB *be, monitor_subsys_t *ms);
+
 /*
  * waiters
  */
@@ -33,6 +33,9 @@ typedef enum {
   MT_UNKNOWN,
   MT_RUNQUEUE,
   MT_TASKLIST,
+  MT_SLABS,
+  MT_NUMA,
+  MT_FAULTS,
 
   MT_LAST
 } monitor_thread_t;
@@ -77,6 +80,13 @@ static struct {
              "operations"),
      BER_BVNULL, LDAP_PVT_THREAD_POOL_PARAM_UNKNOWN, MT_TASKLIST},
 
+    {BER_BVC("cn=Slabs"), BER_BVC("Per-thread slabs and the pages backing them"), BER_BVNULL,
+     LDAP_PVT_THREAD_POOL_PARAM_UNKNOWN, MT_SLABS},
+    {BER_BVC("cn=NUMA"), BER_BVC("Threads bound to each NUMA node"), BER_BVNULL, LDAP_PVT_THREAD_POOL_PARAM_UNKNOWN,
+     MT_NUMA},
+    {BER_BVC("cn=Page Faults"), BER_BVC("Minor and major page faults of the process"), BER_BVNULL,
+     LDAP_PVT_THREAD_POOL_PARAM_UNKNOWN, MT_FAULTS},
+
     {BER_BVNULL}};
 
 static int monitor_subsys_thread_update(Operation *op, SlapReply *rs, Entry *e);
@@ -281,6 +291,46 @@ static int monitor_subsys_thread_update(Operation *op, SlapReply *rs, Entry *e)
       }
       break;
 
+    case MT_SLABS:
+    case MT_NUMA:
+    case MT_FAULTS: {
+      slap_sl_stats ss;
+
+      if (a != NULL) {
+        if (a->a_nvals != a->a_vals) {
+          ber_bvarray_free(a->a_nvals);
+        }
+        ber_bvarray_free(a->a_vals);
+        a->a_vals = NULL;
+        a->a_nvals = NULL;
+        a->a_numvals = 0;
+      }
+
+      slap_sl_mem_stats(&ss);
+      bv.bv_val = buf;
+      if (mt[which].mt == MT_SLABS) {
+        bv.bv_len = snprintf(buf, sizeof(buf), "slabs=%lu hugetlb=%lu thp=%lu fallback=%lu", ss.ss_slabs,
+                             ss.ss_hugetlb, ss.ss_thp, ss.ss_fallback);
+        value_add_one(&vals, &bv);
+      } else if (mt[which].mt == MT_NUMA) {
+        for (i = 0; i < ss.ss_nodes; i++) {
+          bv.bv_len = snprintf(buf, sizeof(buf), "{%d}node%d threads=%lu", i, i, ss.ss_node_threads[i]);
+          value_add_one(&vals, &bv);
+        }
+      } else {
+        bv.bv_len = snprintf(buf, sizeof(buf), "minor=%ld major=%ld", ss.ss_minflt, ss.ss_majflt);
+        value_add_one(&vals, &bv);
+      }
+
+      if (vals) {
+        attr_merge_normalize(e, mi->mi_ad_monitoredInfo, vals, NULL);
+        ber_bvarray_free(vals);
+
+      } else {
+        attr_delete(&e->e_attrs, mi->mi_ad_monitoredInfo);
+      }
+    } break;
+
     default:
       LDAP_BUG();
     }
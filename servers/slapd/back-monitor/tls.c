@@ -0,0 +1,218 @@
+/* $ReOpenLDAP$ */
+/* Copyright 2001-2018 ReOpenLDAP AUTHORS: please see AUTHORS file.
+ * All rights reserved.
+ *
+ * This file is part of ReOpenLDAP.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted only as authorized by the OpenLDAP
+ * Public License.
+ *
+ * A copy of this license is available in the file LICENSE in the
+ * top-level directory of the distribution or, alternatively, at
+ * <http://www.OpenLDAP.org/license.html>.
+ */
+
+#include "reldap.h"
+
+#include <stdio.h>
+#include <ac/string.h>
+
+#include "slap.h"
+#include "back-monitor.h"
+
+#ifdef WITH_TLS
+
+static int monitor_subsys_tls_destroy(BackendDB *be, monitor_subsys_t *ms);
+
+static int monitor_subsys_tls_update(Operation *op, SlapReply *rs, Entry *e);
+
+enum {
+  MONITOR_TLS_HANDSHAKES = 0,
+  MONITOR_TLS_HITS,
+  MONITOR_TLS_MISSES,
+  MONITOR_TLS_TIMEOUTS,
+  MONITOR_TLS_CACHED,
+  MONITOR_TLS_TICKETS,
+  MONITOR_TLS_KTLS,
+
+  MONITOR_TLS_LAST
+};
+
+struct monitor_tls_t {
+  struct berval rdn;
+  struct berval nrdn;
+} monitor_tls[] = {{BER_BVC("cn=Handshakes"), BER_BVNULL},
+                   {BER_BVC("cn=Session Hits"), BER_BVNULL},
+                   {BER_BVC("cn=Session Misses"), BER_BVNULL},
+                   {BER_BVC("cn=Session Timeouts"), BER_BVNULL},
+                   {BER_BVC("cn=Sessions Cached"), BER_BVNULL},
+                   {BER_BVC("cn=Tickets Issued"), BER_BVNULL},
+                   {BER_BVC("cn=Kernel Offloads"), BER_BVNULL},
+                   {BER_BVNULL, BER_BVNULL}};
+
+int monitor_subsys_tls_init(BackendDB *be, monitor_subsys_t *ms) {
+  monitor_info_t *mi;
+
+  Entry **ep, *e_tls;
+  monitor_entry_t *mp;
+  int i;
+
+  assert(be != NULL);
+
+  ms->mss_destroy = monitor_subsys_tls_destroy;
+  ms->mss_update = monitor_subsys_tls_update;
+
+  mi = (monitor_info_t *)be->be_private;
+
+  if (monitor_cache_get(mi, &ms->mss_ndn, &e_tls)) {
+    Debug(LDAP_DEBUG_ANY,
+          "monitor_subsys_tls_init: "
+          "unable to get entry \"%s\"\n",
+          ms->mss_ndn.bv_val);
+    return -1;
+  }
+
+  mp = (monitor_entry_t *)e_tls->e_private;
+  mp->mp_children = NULL;
+  ep = &mp->mp_children;
+  int rc = -1;
+
+  for (i = 0; i < MONITOR_TLS_LAST; i++) {
+    struct berval nrdn, bv;
+    Entry *e;
+
+    e = monitor_entry_stub(&ms->mss_dn, &ms->mss_ndn, &monitor_tls[i].rdn, mi->mi_oc_monitorCounterObject, NULL, NULL);
+
+    if (e == NULL) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_tls_init: "
+            "unable to create entry \"%s,%s\"\n",
+            monitor_tls[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    /* steal normalized RDN */
+    dnRdn(&e->e_nname, &nrdn);
+    ber_dupbv(&monitor_tls[i].nrdn, &nrdn);
+
+    BER_BVSTR(&bv, "0");
+    attr_merge_one(e, mi->mi_ad_monitorCounter, &bv, NULL);
+
+    mp = monitor_entrypriv_create();
+    if (mp == NULL) {
+      goto bailout;
+    }
+    e->e_private = (void *)mp;
+    mp->mp_info = ms;
+    mp->mp_flags = ms->mss_flags | MONITOR_F_SUB | MONITOR_F_PERSISTENT;
+
+    if (monitor_cache_add(mi, e)) {
+      Debug(LDAP_DEBUG_ANY,
+            "monitor_subsys_tls_init: "
+            "unable to add entry \"%s,%s\"\n",
+            monitor_tls[i].rdn.bv_val, ms->mss_ndn.bv_val);
+      goto bailout;
+    }
+
+    *ep = e;
+    ep = &mp->mp_next;
+  }
+
+  rc = 0;
+
+bailout:
+  monitor_cache_release(mi, e_tls);
+  return rc;
+}
+
+static int monitor_subsys_tls_destroy(BackendDB *be, monitor_subsys_t *ms) {
+  int i;
+
+  for (i = 0; i < MONITOR_TLS_LAST; i++) {
+    if (!BER_BVISNULL(&monitor_tls[i].nrdn)) {
+      ch_free(monitor_tls[i].nrdn.bv_val);
+    }
+  }
+
+  return 0;
+}
+
+static int monitor_subsys_tls_update(Operation *op, SlapReply *rs, Entry *e) {
+  monitor_info_t *mi = (monitor_info_t *)op->o_bd->be_private;
+
+  struct berval nrdn;
+  ldap_pvt_tls_stats ts;
+  unsigned long n;
+  Attribute *a;
+  char buf[LDAP_PVT_INTTYPE_CHARS(unsigned long)];
+  ber_len_t len;
+  int i;
+
+  assert(mi != NULL);
+  assert(e != NULL);
+
+  dnRdn(&e->e_nname, &nrdn);
+
+  for (i = 0; i < MONITOR_TLS_LAST; i++) {
+    if (dn_match(&nrdn, &monitor_tls[i].nrdn)) {
+      break;
+    }
+  }
+
+  if (i == MONITOR_TLS_LAST) {
+    return SLAP_CB_CONTINUE;
+  }
+
+  /* counters restart whenever the TLS configuration is reloaded */
+  ldap_pvt_tls_get_stats(slap_tls_ctx, &ts);
+  switch (i) {
+  case MONITOR_TLS_HANDSHAKES:
+    n = ts.ts_accepts;
+    break;
+
+  case MONITOR_TLS_HITS:
+    n = ts.ts_hits;
+    break;
+
+  case MONITOR_TLS_MISSES:
+    n = ts.ts_misses;
+    break;
+
+  case MONITOR_TLS_TIMEOUTS:
+    n = ts.ts_timeouts;
+    break;
+
+  case MONITOR_TLS_CACHED:
+    n = ts.ts_cached;
+    break;
+
+  case MONITOR_TLS_TICKETS:
+    n = ts.ts_tickets;
+    break;
+
+  case MONITOR_TLS_KTLS:
+    n = ts.ts_ktls;
+    break;
+
+  default:
+    LDAP_BUG();
+  }
+
+  a = attr_find(e->e_attrs, mi->mi_ad_monitorCounter);
+  assert(a != NULL);
+
+  snprintf(buf, sizeof(buf), "%lu", n);
+  len = strlen(buf);
+  if (len > a->a_vals[0].bv_len) {
+    a->a_vals[0].bv_val = ber_memrealloc(a->a_vals[0].bv_val, len + 1);
+  }
+  a->a_vals[0].bv_len = len;
+  memcpy(a->a_vals[0].bv_val, buf, len + 1);
+
+  /* FIXME: touch modifyTimestamp? */
+
+  return SLAP_CB_CONTINUE;
+}
+
+#endif /* WITH_TLS */
@@ -139,6 +139,8 @@ static ConfigDriver config_rootpw;
 static ConfigDriver config_restrict;
 static ConfigDriver config_allows;
 static ConfigDriver config_disallows;
+static ConfigDriver config_inline;
+static ConfigDriver config_admission_shed;
 static ConfigDriver config_requires;
 static ConfigDriver config_security;
 static ConfigDriver config_referral;
@@ -220,6 +222,11 @@ enum {
   CFG_TLS_CACERT,
   CFG_TLS_CERT,
   CFG_TLS_KEY,
+  CFG_TLS_SESSION_CACHE,
+  CFG_TLS_SESSION_TIMEOUT,
+  CFG_TLS_TICKET_ROTATE,
+  CFG_TLS_KTLS,
+  CFG_TLS_THREADS,
 
   CFG_LAST
 };
@@ -332,6 +339,23 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY booleanMatch "
      "SYNTAX OMsBoolean SINGLE-VALUE )",
      NULL, NULL},
+    {"admission-interval", "milliseconds", 2, 2, 0, ARG_UINT, &global_admission_interval,
+     "( OLcfgGlAt:104 NAME 'olcAdmissionInterval' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
+    {"admission-shed", "operations", 2, 0, 0, ARG_MAGIC, &config_admission_shed,
+     "( OLcfgGlAt:105 NAME 'olcAdmissionShed' "
+     "DESC 'Operations rejected while overloaded' "
+     "EQUALITY caseIgnoreMatch "
+     "SYNTAX OMsDirectoryString )",
+     NULL, NULL},
+    {"admission-target", "milliseconds", 2, 2, 0, ARG_UINT, &global_admission_target,
+     "( OLcfgGlAt:103 NAME 'olcAdmissionTarget' "
+     "DESC 'Queueing delay that counts as overload' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
     {"allows", "features", 2, 0, 5, ARG_PRE_DB | ARG_MAGIC, &config_allows,
      "( OLcfgGlAt:2 NAME 'olcAllows' "
      "DESC 'Allowed set of deprecated features' "
@@ -500,6 +524,27 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseIgnoreMatch "
      "SYNTAX OMsDirectoryString X-ORDERED 'VALUES' )",
      NULL, NULL},
+    {"listener-inline", "operations", 2, 0, 0,
+#ifdef NO_THREADS
+     ARG_IGNORED, NULL,
+#else
+     ARG_MAGIC, &config_inline,
+#endif
+     "( OLcfgGlAt:100 NAME 'olcListenerInline' "
+     "DESC 'Operations run on the listener threads' "
+     "EQUALITY caseIgnoreMatch "
+     "SYNTAX OMsDirectoryString )",
+     NULL, NULL},
+    {"listener-inline-budget", "microseconds", 2, 2, 0,
+#ifdef NO_THREADS
+     ARG_IGNORED, NULL,
+#else
+     ARG_UINT, &global_inline_budget,
+#endif
+     "( OLcfgGlAt:101 NAME 'olcListenerInlineBudget' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
     {"listener-threads", "count", 2, 0, 0,
 #ifdef NO_THREADS
      ARG_IGNORED, NULL,
@@ -760,6 +805,16 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseExactMatch "
      "SYNTAX OMsDirectoryString SINGLE-VALUE )",
      NULL, NULL},
+    {"slab-hugepages", "on|off", 2, 2, 0, ARG_ON_OFF, &slap_sl_hugepages,
+     "( OLcfgGlAt:111 NAME 'olcSlabHugePages' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
+    {"slab-numa", "on|off", 2, 2, 0, ARG_ON_OFF, &slap_sl_numa,
+     "( OLcfgGlAt:112 NAME 'olcSlabNuma' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
     {"sockbuf_max_incoming", "max", 2, 2, 0, ARG_BER_LEN_T, &sockbuf_max_incoming,
      "( OLcfgGlAt:61 NAME 'olcSockbufMaxIncoming' "
      "EQUALITY integerMatch "
@@ -833,6 +888,16 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseExactMatch "
      "SYNTAX OMsDirectoryString SINGLE-VALUE )",
      NULL, NULL},
+    {"tls-handshake-threads", "count", 2, 2, 0,
+#ifdef WITH_TLS
+     ARG_INT | ARG_MAGIC | CFG_TLS_THREADS, &config_generic,
+#else
+     ARG_IGNORED, NULL,
+#endif
+     "( OLcfgGlAt:109 NAME 'olcTLSHandshakeThreads' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
     {"TLSCACertificate", NULL, 2, 2, 0,
 #ifdef WITH_TLS
      CFG_TLS_CACERT | ARG_BINARY | ARG_MAGIC, &config_tls_option,
@@ -976,6 +1041,16 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseExactMatch "
      "SYNTAX OMsDirectoryString SINGLE-VALUE )",
      NULL, NULL},
+    {"TLSKernelOffload", "on|off", 2, 2, 0,
+#ifdef WITH_TLS
+     CFG_TLS_KTLS | ARG_STRING | ARG_MAGIC, &config_tls_config,
+#else
+     ARG_IGNORED, NULL,
+#endif
+     "( OLcfgGlAt:110 NAME 'olcTLSKernelOffload' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
     {"TLSProtocolMin", NULL, 2, 2, 0,
 #ifdef WITH_TLS
      CFG_TLS_PROTOCOL_MIN | ARG_STRING | ARG_MAGIC, &config_tls_config,
@@ -986,6 +1061,36 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseExactMatch "
      "SYNTAX OMsDirectoryString SINGLE-VALUE )",
      NULL, NULL},
+    {"TLSSessionCache", "entries", 2, 2, 0,
+#ifdef WITH_TLS
+     CFG_TLS_SESSION_CACHE | ARG_STRING | ARG_MAGIC, &config_tls_config,
+#else
+     ARG_IGNORED, NULL,
+#endif
+     "( OLcfgGlAt:106 NAME 'olcTLSSessionCache' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
+    {"TLSSessionTicketRotate", "seconds", 2, 2, 0,
+#ifdef WITH_TLS
+     CFG_TLS_TICKET_ROTATE | ARG_STRING | ARG_MAGIC, &config_tls_config,
+#else
+     ARG_IGNORED, NULL,
+#endif
+     "( OLcfgGlAt:108 NAME 'olcTLSSessionTicketRotate' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
+    {"TLSSessionTimeout", "seconds", 2, 2, 0,
+#ifdef WITH_TLS
+     CFG_TLS_SESSION_TIMEOUT | ARG_STRING | ARG_MAGIC, &config_tls_config,
+#else
+     ARG_IGNORED, NULL,
+#endif
+     "( OLcfgGlAt:107 NAME 'olcTLSSessionTimeout' "
+     "EQUALITY integerMatch "
+     "SYNTAX OMsInteger SINGLE-VALUE )",
+     NULL, NULL},
     {"tool-threads", "count", 2, 2, 0, ARG_INT | ARG_MAGIC | CFG_TTHREADS, &config_generic,
      "( OLcfgGlAt:80 NAME 'olcToolThreads' "
      "EQUALITY integerMatch "
@@ -1002,6 +1107,17 @@ static ConfigTable config_back_cf_table[] = {
      "EQUALITY caseIgnoreMatch "
      "SUP labeledURI )",
      NULL, NULL},
+    {"weighted-queue", "on|off", 2, 2, 0,
+#ifdef NO_THREADS
+     ARG_IGNORED, NULL,
+#else
+     ARG_ON_OFF, &global_weighted_queue,
+#endif
+     "( OLcfgGlAt:102 NAME 'olcWeightedQueue' "
+     "DESC 'Queue operations per identity, weighted by limits' "
+     "EQUALITY booleanMatch "
+     "SYNTAX OMsBoolean SINGLE-VALUE )",
+     NULL, NULL},
     {"writetimeout", "timeout", 2, 2, 0, ARG_INT, &global_writetimeout,
      "( OLcfgGlAt:88 NAME 'olcWriteTimeout' "
      "EQUALITY integerMatch "
@@ -1087,7 +1203,9 @@ static ConfigOCs cf_ocs[] = {{"( OLcfgGlOc:0 "
                               "NAME 'olcGlobal' "
                               "DESC 'OpenLDAP Global configuration options' "
                               "SUP olcConfig STRUCTURAL "
-                              "MAY ( cn $ olcConfigFile $ olcConfigDir $ olcAllows $ olcArgsFile $ "
+                              "MAY ( cn $ olcConfigFile $ olcConfigDir $ "
+                              "olcAdmissionInterval $ olcAdmissionShed $ olcAdmissionTarget $ "
+                              "olcAllows $ olcArgsFile $ "
                               "olcAttributeOptions $ olcAuthIDRewrite $ "
                               "olcAuthzPolicy $ olcAuthzRegexp $ olcConcurrency $ "
                               "olcConnMaxPending $ olcConnMaxPendingAuth $ "
@@ -1095,6 +1213,7 @@ static ConfigOCs cf_ocs[] = {{"( OLcfgGlOc:0 "
                               "olcIndexSubstrIfMaxLen $ olcIndexSubstrIfMinLen $ "
                               "olcIndexSubstrAnyLen $ olcIndexSubstrAnyStep $ olcIndexHash64 $ "
                               "olcIndexIntLen $ "
+                              "olcListenerInline $ olcListenerInlineBudget $ "
                               "olcListenerThreads $ olcLocalSSF $ olcLogFile $ olcLogLevel $ "
                               "olcPasswordCryptSaltFormat $ olcPasswordHash $ olcPidFile $ "
                               "olcPluginLogFile $ olcReadOnly $ olcReferral $ "
@@ -1103,7 +1222,7 @@ static ConfigOCs cf_ocs[] = {{"( OLcfgGlOc:0 "
                               "olcSaslAuxprops $ olcSaslAuxpropsDontUseCopy $ "
                               "olcSaslAuxpropsDontUseCopyIgnore $ "
                               "olcSaslHost $ olcSaslRealm $ olcSaslSecProps $ "
-                              "olcSecurity $ olcServerID $ olcSizeLimit $ "
+                              "olcSecurity $ olcServerID $ olcSizeLimit $ olcSlabHugePages $ olcSlabNuma $ "
                               "olcSockbufMaxIncoming $ olcSockbufMaxIncomingAuth $ "
                               "olcTCPBuffer $ "
                               "olcThreads $ olcThreadQueues $ "
@@ -1112,7 +1231,11 @@ static ConfigOCs cf_ocs[] = {{"( OLcfgGlOc:0 "
                               "olcTLSCertificateKeyFile $ olcTLSCipherSuite $ olcTLSCRLCheck $ "
                               "olcTLSCACertificate $ olcTLSCertificate $ olcTLSCertificateKey $ "
                               "olcTLSRandFile $ olcTLSVerifyClient $ olcTLSDHParamFile $ olcTLSECName $ "
-                              "olcTLSCRLFile $ olcTLSProtocolMin $ olcToolThreads $ olcWriteTimeout $ "
+                              "olcTLSCRLFile $ olcTLSProtocolMin $ olcTLSSessionCache $ olcTLSSessionTimeout $ "
+                              "olcTLSSessionTicketRotate $ olcTLSHandshakeThreads $ olcTLSKernelOffload $ "
+                              "olcToolThreads $ "
+                              "olcWeightedQueue $ "
+                              "olcWriteTimeout $ "
                               "olcObjectIdentifier $ olcAttributeTypes $ olcObjectClasses $ "
                               "olcCrashBacktrace $ olcMemoryLimit $ olcCoredumpLimit $ olcReOpenLDAP $ "
                               "olcDitContentRules $ olcLdapSyntaxes ) )",
@@ -1223,6 +1346,13 @@ static int config_generic(ConfigArgs *c) {
     case CFG_LTHREADS:
       c->value_uint = slapd_daemon_threads;
       break;
+#ifdef WITH_TLS
+    case CFG_TLS_THREADS:
+      c->value_int = tls_handshake_pool_max;
+      if (!c->value_int)
+        rc = 1;
+      break;
+#endif
     case CFG_SALT:
       if (passwd_salt)
         c->value_string = ch_strdup(passwd_salt);
@@ -1597,6 +1727,13 @@ static int config_generic(ConfigArgs *c) {
     case CFG_SYNC_SUBENTRY:
       break;
 
+#ifdef WITH_TLS
+    case CFG_TLS_THREADS:
+      /* back to handshakes on the connection pool */
+      tls_handshake_pool_max = 0;
+      break;
+#endif
+
     /* no-ops, requires slapd restart */
     case CFG_PLUGIN:
     case CFG_MODLOAD:
@@ -1987,6 +2124,19 @@ static int config_generic(ConfigArgs *c) {
     slapd_daemon_threads = mask + 1;
   } break;
 
+#ifdef WITH_TLS
+  case CFG_TLS_THREADS:
+    if (c->value_int < 0) {
+      snprintf(c->cr_msg, sizeof(c->cr_msg), "tls-handshake-threads=%d is negative", c->value_int);
+      Debug(LDAP_DEBUG_ANY, "%s: %s.\n", c->log, c->cr_msg);
+      return ARG_BAD_CONF;
+    }
+    if ((slapMode & SLAP_SERVER_MODE) && c->value_int)
+      ldap_pvt_thread_pool_maxthreads(&tls_handshake_pool, c->value_int);
+    tls_handshake_pool_max = c->value_int;
+    break;
+#endif
+
   case CFG_SALT:
     if (passwd_salt)
       ch_free(passwd_salt);
@@ -3723,6 +3873,67 @@ static int config_disallows(ConfigArgs *c) {
   return 0;
 }
 
+static int config_inline(ConfigArgs *c) {
+  slap_mask_t ops = 0;
+  int i;
+  slap_verbmasks inline_ops[] = {{BER_BVC("abandon"), SLAP_INLINE_ABANDON},
+                                 {BER_BVC("compare"), SLAP_INLINE_COMPARE},
+                                 {BER_BVC("base"), SLAP_INLINE_SEARCH_BASE},
+                                 {BER_BVNULL, 0}};
+  if (c->op == SLAP_CONFIG_EMIT) {
+    return mask_to_verbs(inline_ops, global_inline_ops, &c->rvalue_vals);
+  } else if (c->op == LDAP_MOD_DELETE) {
+    if (!c->line) {
+      global_inline_ops = 0;
+    } else {
+      i = verb_to_mask(c->line, inline_ops);
+      global_inline_ops &= ~inline_ops[i].mask;
+    }
+    return 0;
+  }
+  i = verbs_to_mask(c->argc, c->argv, inline_ops, &ops);
+  if (i) {
+    snprintf(c->cr_msg, sizeof(c->cr_msg), "<%s> unknown operation", c->argv[0]);
+    Debug(LDAP_DEBUG_ANY, "%s: %s %s\n", c->log, c->cr_msg, c->argv[i]);
+    return ARG_BAD_CONF;
+  }
+  global_inline_ops |= ops;
+  return 0;
+}
+
+static int config_admission_shed(ConfigArgs *c) {
+  slap_mask_t ops = 0;
+  int i;
+  slap_verbmasks shed_ops[] = {{BER_BVC("add"), 1U << SLAP_OP_ADD},
+                               {BER_BVC("bind"), 1U << SLAP_OP_BIND},
+                               {BER_BVC("compare"), 1U << SLAP_OP_COMPARE},
+                               {BER_BVC("delete"), 1U << SLAP_OP_DELETE},
+                               {BER_BVC("extended"), 1U << SLAP_OP_EXTENDED},
+                               {BER_BVC("modify"), 1U << SLAP_OP_MODIFY},
+                               {BER_BVC("modrdn"), 1U << SLAP_OP_MODRDN},
+                               {BER_BVC("search"), 1U << SLAP_OP_SEARCH},
+                               {BER_BVNULL, 0}};
+  if (c->op == SLAP_CONFIG_EMIT) {
+    return mask_to_verbs(shed_ops, global_admission_shed, &c->rvalue_vals);
+  } else if (c->op == LDAP_MOD_DELETE) {
+    if (!c->line) {
+      global_admission_shed = 0;
+    } else {
+      i = verb_to_mask(c->line, shed_ops);
+      global_admission_shed &= ~shed_ops[i].mask;
+    }
+    return 0;
+  }
+  i = verbs_to_mask(c->argc, c->argv, shed_ops, &ops);
+  if (i) {
+    snprintf(c->cr_msg, sizeof(c->cr_msg), "<%s> unknown operation", c->argv[0]);
+    Debug(LDAP_DEBUG_ANY, "%s: %s %s\n", c->log, c->cr_msg, c->argv[i]);
+    return ARG_BAD_CONF;
+  }
+  global_admission_shed |= ops;
+  return 0;
+}
+
 static int config_requires(ConfigArgs *c) {
   slap_mask_t
     requires
@@ -4424,6 +4635,18 @@ static int config_tls_config(ConfigArgs *c) {
   case CFG_TLS_PROTOCOL_MIN:
     flag = LDAP_OPT_X_TLS_PROTOCOL_MIN;
     break;
+  case CFG_TLS_SESSION_CACHE:
+    flag = LDAP_OPT_X_TLS_SESSION_CACHE;
+    break;
+  case CFG_TLS_SESSION_TIMEOUT:
+    flag = LDAP_OPT_X_TLS_SESSION_TIMEOUT;
+    break;
+  case CFG_TLS_TICKET_ROTATE:
+    flag = LDAP_OPT_X_TLS_TICKET_ROTATE;
+    break;
+  case CFG_TLS_KTLS:
+    flag = LDAP_OPT_X_TLS_KTLS;
+    break;
   default:
     Debug(LDAP_DEBUG_ANY,
           "%s: "
@@ -104,3 +104,99 @@ void ch_free(void *ptr) {
     ber_memfree_x(ptr, NULL);
   }
 }
+
+/*
+ * Tagged allocations carry a small header with their size and owner,
+ * so that the heap usage of each subsystem can be reported in
+ * cn=Memory,cn=Monitor. They must be released with ch_free_tag().
+ * Memory which is sized elsewhere is accounted via slap_mem_charge().
+ */
+typedef union ch_mem_hdr {
+  struct {
+    ber_len_t size;
+    slap_mem_tag tag;
+#if LDAP_MEMORY_DEBUG > 0
+    unsigned magic;
+#endif /* LDAP_MEMORY_DEBUG */
+  } mh;
+  long double mh_align; /* keep the payload aligned like malloc() does */
+} ch_mem_hdr;
+
+#if LDAP_MEMORY_DEBUG > 0
+#define CH_MEM_MAGIC 0x7A66ED01u
+#define ch_mem_hdr_mark(h) ((h)->mh.magic = CH_MEM_MAGIC)
+#else
+#define ch_mem_hdr_mark(h) ((void)0)
+#endif /* LDAP_MEMORY_DEBUG */
+
+static slap_mem_stats ch_mem_stats[SLAP_MEM_LAST];
+
+void slap_mem_charge(slap_mem_tag tag, ber_len_t size) {
+  slap_mem_stats *ms = &ch_mem_stats[tag];
+  unsigned long bytes, peak;
+
+  assert(tag < SLAP_MEM_LAST);
+  __sync_fetch_and_add(&ms->ms_allocs, 1);
+  bytes = __sync_add_and_fetch(&ms->ms_bytes, size);
+  while ((peak = ms->ms_peak) < bytes && !__sync_bool_compare_and_swap(&ms->ms_peak, peak, bytes))
+    ;
+}
+
+void slap_mem_uncharge(slap_mem_tag tag, ber_len_t size) {
+  slap_mem_stats *ms = &ch_mem_stats[tag];
+
+  assert(tag < SLAP_MEM_LAST);
+  __sync_fetch_and_add(&ms->ms_frees, 1);
+  __sync_fetch_and_sub(&ms->ms_bytes, size);
+}
+
+void slap_mem_stats_get(slap_mem_tag tag, slap_mem_stats *ms) {
+  assert(tag < SLAP_MEM_LAST);
+  *ms = ch_mem_stats[tag];
+}
+
+void *ch_malloc_tag(ber_len_t size, slap_mem_tag tag) {
+  ch_mem_hdr *h;
+
+  h = ch_malloc(sizeof(ch_mem_hdr) + size);
+  h->mh.size = size;
+  h->mh.tag = tag;
+  ch_mem_hdr_mark(h);
+  slap_mem_charge(tag, size);
+  return h + 1;
+}
+
+void *ch_calloc_tag(ber_len_t nelem, ber_len_t size, slap_mem_tag tag) {
+  ch_mem_hdr *h;
+
+  if (size && nelem > ((ber_len_t)-1 - sizeof(ch_mem_hdr)) / size) {
+    Debug(LDAP_DEBUG_ANY, "ch_calloc_tag of %lu elems of %lu bytes failed\n", (long)nelem, (long)size);
+    LDAP_BUG();
+    exit(EXIT_FAILURE);
+  }
+  size *= nelem;
+  h = ch_calloc(1, sizeof(ch_mem_hdr) + size);
+  h->mh.size = size;
+  h->mh.tag = tag;
+  ch_mem_hdr_mark(h);
+  slap_mem_charge(tag, size);
+  return h + 1;
+}
+
+void ch_free_tag(void *ptr) {
+  ch_mem_hdr *h;
+
+  if (ptr == NULL)
+    return;
+  h = (ch_mem_hdr *)ptr - 1;
+#if LDAP_MEMORY_DEBUG > 0
+  /* catch ch_free_tag() of untagged memory, and double frees */
+  if (unlikely(h->mh.magic != CH_MEM_MAGIC || h->mh.tag >= SLAP_MEM_LAST)) {
+    Debug(LDAP_DEBUG_ANY, "ch_free_tag: %p was not allocated by ch_malloc_tag()\n", ptr);
+    LDAP_BUG();
+  }
+  h->mh.magic = ~CH_MEM_MAGIC;
+#endif /* LDAP_MEMORY_DEBUG */
+  slap_mem_uncharge(h->mh.tag, h->mh.size);
+  ch_free(h);
+}
@@ -52,6 +52,12 @@
  */
 slap_mask_t global_allows = 0;
 slap_mask_t global_disallows = 0;
+slap_mask_t global_inline_ops = 0;
+unsigned global_inline_budget = SLAP_INLINE_BUDGET_DEFAULT;
+int global_weighted_queue = 0;
+unsigned global_admission_target = 0;
+unsigned global_admission_interval = SLAP_ADMISSION_INTERVAL_DEFAULT;
+slap_mask_t global_admission_shed = 0;
 int global_gentlehup = 0;
 int global_idletimeout = 0;
 int global_writetimeout = 0;
@@ -1626,6 +1632,11 @@ int slap_tls_get_config(LDAP *ld, int opt, char **val) {
   case LDAP_OPT_X_TLS_REQUIRE_CERT:
     keys = vfykeys;
     break;
+  case LDAP_OPT_X_TLS_KTLS:
+    if (ldap_pvt_tls_get_option(ld, opt, &ival) || ival == 0)
+      return -1;
+    *val = ch_strdup("TRUE");
+    return 0;
   case LDAP_OPT_X_TLS_PROTOCOL_MIN: {
     char buf[8];
     ldap_pvt_tls_get_option(ld, opt, &ival);
@@ -1633,6 +1644,16 @@ int slap_tls_get_config(LDAP *ld, int opt, char **val) {
     *val = ch_strdup(buf);
     return 0;
   }
+  case LDAP_OPT_X_TLS_SESSION_CACHE:
+  case LDAP_OPT_X_TLS_SESSION_TIMEOUT:
+  case LDAP_OPT_X_TLS_TICKET_ROTATE: {
+    char buf[16];
+    if (ldap_pvt_tls_get_option(ld, opt, &ival) || ival == 0)
+      return -1;
+    snprintf(buf, sizeof(buf), "%d", ival);
+    *val = ch_strdup(buf);
+    return 0;
+  }
   default:
     return -1;
   }
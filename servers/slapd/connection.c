@@ -46,6 +46,50 @@ static unsigned long conn_nextid = SLAPD_SYNC_SYNCCONN_OFFSET;
 
 static const char conn_lost_str[] = "connection lost";
 
+/*
+ * Pending operations queued per bound identity, for weighted-queue.
+ * A flow exists while it has operations queued and is then also on
+ * conn_flows_ring; the head of the ring runs up to cf_weight operations
+ * before moving to the tail.  Queuing an operation adds one
+ * connection_sched_run() task (or caller), which runs operations until
+ * the ring is empty; so as long as anything is queued some task is
+ * there to run it, even if a later submit fails.  After
+ * SLAP_SCHED_BATCH operations a task hands the rest over to a new one
+ * at the end of the pool queue, so that it does not keep its thread
+ * from the other tasks for as long as the ring stays busy.
+ */
+#define SLAP_SCHED_BATCH 16
+typedef struct conn_flow {
+  struct berval cf_ndn;
+  int cf_weight;
+  int cf_ran; /* operations run in the current turn */
+  LDAP_STAILQ_HEAD(cf_o, Operation) cf_ops;
+  LDAP_TAILQ_ENTRY(conn_flow) cf_next;
+} conn_flow;
+
+/* protected by conn_flows_mutex */
+static ldap_pvt_thread_mutex_t conn_flows_mutex;
+static Avlnode *conn_flows = NULL;
+static LDAP_TAILQ_HEAD(cf_r, conn_flow) conn_flows_ring = LDAP_TAILQ_HEAD_INITIALIZER(conn_flows_ring);
+static unsigned long conn_flows_runners; /* connection_sched_run() tasks */
+
+/*
+ * Admission control, see admission-target.  For each type of operation
+ * keep the lowest queueing delay seen over an interval: if even that
+ * one is above the target, the queue is not draining, and operations
+ * of the types in admission-shed that are late themselves get
+ * LDAP_BUSY during the next interval instead of being executed.
+ */
+typedef struct conn_admit {
+  slap_time_t ca_until; /* end of the current interval */
+  uint64_t ca_min;      /* lowest delay in it, microseconds */
+  int ca_shed;          /* the previous interval was above target */
+} conn_admit;
+
+/* protected by conn_admit_mutex */
+static ldap_pvt_thread_mutex_t conn_admit_mutex;
+static conn_admit conn_admits[SLAP_OP_LAST];
+
 const char *connection_state2str(int state) {
   switch (state) {
   case SLAP_C_INVALID:
@@ -73,6 +117,7 @@ typedef struct conn_readinfo {
   void *arg;
   void *ctx;
   int nullop;
+  int inplace; /* reading on a listener thread */
 } conn_readinfo;
 
 static int connection_input(Connection *c, conn_readinfo *cri);
@@ -85,6 +130,8 @@ static void connection_abandon(Connection *conn);
 static void connection_destroy(Connection *c);
 
 static ldap_pvt_thread_start_t connection_operation;
+static ldap_pvt_thread_start_t connection_sched_run;
+static void conn_flow_drop(conn_flow *cf);
 
 /*
  * Initialize connection management infrastructure.
@@ -102,6 +149,8 @@ int connections_init(void) {
   /* should check return of every call */
   ldap_pvt_thread_mutex_init(&connections_mutex);
   ldap_pvt_thread_mutex_init(&conn_nextid_mutex);
+  ldap_pvt_thread_mutex_init(&conn_flows_mutex);
+  ldap_pvt_thread_mutex_init(&conn_admit_mutex);
 
   connections = (Connection *)ch_calloc(dtblsize, sizeof(Connection));
 
@@ -133,6 +182,8 @@ int connections_init(void) {
 
 int connections_destroy(void) {
   ber_socket_t i;
+  conn_flow *cf;
+  Operation *op;
 
   /* should check return of every call */
 
@@ -160,6 +211,20 @@ int connections_destroy(void) {
 
   ldap_pvt_thread_mutex_destroy(&connections_mutex);
   ldap_pvt_thread_mutex_destroy(&conn_nextid_mutex);
+
+  /* operations still queued were never run, free them with their flows */
+  while ((cf = LDAP_TAILQ_FIRST(&conn_flows_ring)) != NULL) {
+    while ((op = LDAP_STAILQ_FIRST(&cf->cf_ops)) != NULL) {
+      LDAP_STAILQ_REMOVE_HEAD(&cf->cf_ops, o_sched_next);
+      LDAP_STAILQ_NEXT(op, o_next) = NULL;
+      op->o_conn = NULL;
+      slap_op_free(op, NULL);
+    }
+    conn_flow_drop(cf);
+  }
+  conn_flows_runners = 0;
+  ldap_pvt_thread_mutex_destroy(&conn_flows_mutex);
+  ldap_pvt_thread_mutex_destroy(&conn_admit_mutex);
   return 0;
 }
 
@@ -518,7 +583,7 @@ Connection *connection_init(const ber_socket_t s, Listener *listener, const char
 #ifdef LDAP_DEBUG
     ber_sockbuf_add_io(c->c_sb, &ber_sockbuf_io_debug, LBER_SBIOD_LEVEL_PROVIDER, (void *)"tcp_");
 #endif
-    ber_sockbuf_add_io(c->c_sb, &ber_sockbuf_io_tcp, LBER_SBIOD_LEVEL_PROVIDER, (void *)&sfd);
+    ber_sockbuf_add_io(c->c_sb, slapd_sockbuf_io(s), LBER_SBIOD_LEVEL_PROVIDER, (void *)&sfd);
   }
 
 #ifdef LDAP_DEBUG
@@ -597,6 +662,7 @@ void connection2anonymous(Connection *c) {
   BER_BVZERO(&c->c_sasl_authz_dn);
 
   c->c_authz_backend = NULL;
+  c->c_sched_weight = 0;
 }
 
 static void connection_destroy(Connection *c) {
@@ -650,6 +716,7 @@ static void connection_destroy(Connection *c) {
   BER_BVZERO(&c->c_peer_name);
 
   c->c_sasl_bind_in_progress = 0;
+  c->c_inline_slow = 0;
   if (c->c_sasl_bind_mech.bv_val != NULL) {
     free(c->c_sasl_bind_mech.bv_val);
   }
@@ -844,6 +911,13 @@ static void connection_close(Connection *c) {
   connection_destroy(c);
 }
 
+/* Closes c if its close was deferred while output of a finished
+ * operation was still being written; c_mutex is locked by the caller */
+void connection_write_done(Connection *c) {
+  if (c->c_struct_state == SLAP_C_USED && c->c_conn_state == SLAP_C_CLOSING)
+    connection_close(c);
+}
+
 unsigned long connections_nextid(void) {
   unsigned long id;
   assert(connections != NULL);
@@ -1052,6 +1126,46 @@ void connection_op_finish(Operation *op) {
   ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
 }
 
+static int connection_op_shed(Operation *op, slap_op_t opidx) {
+  conn_admit *ca = &conn_admits[opidx];
+  slap_mask_t shed_ops = global_admission_shed ? global_admission_shed : SLAP_ADMISSION_SHED_DEFAULT;
+  uint64_t target = global_admission_target * (uint64_t)1000;
+  uint64_t interval = global_admission_interval * (uint64_t)1000000;
+  struct timeval tv;
+  slap_time_t now;
+  int64_t delay, since;
+  int shed;
+
+  /* Requests run by the task that read them waited as that task did,
+   * others since they were read (o_time/o_tincr, the wall clock).
+   */
+  delay = ldap_pvt_thread_pool_waited(op->o_threadctx);
+  gettimeofday(&tv, NULL);
+  since = (int64_t)(tv.tv_sec - op->o_time) * 1000000 + tv.tv_usec - op->o_tincr;
+  if (since > delay)
+    delay = since;
+
+  now = ldap_now_steady();
+  ldap_pvt_thread_mutex_lock(&conn_admit_mutex);
+  if (now.ns >= ca->ca_until.ns) {
+    /* a quiet spell in between means the queue did drain */
+    ca->ca_shed = ca->ca_until.ns && now.ns < ca->ca_until.ns + interval && ca->ca_min > target;
+    ca->ca_min = delay;
+    ca->ca_until.ns = now.ns + interval;
+  } else if ((uint64_t)delay < ca->ca_min) {
+    ca->ca_min = delay;
+  }
+  shed = ca->ca_shed;
+  ldap_pvt_thread_mutex_unlock(&conn_admit_mutex);
+
+  if (!shed || !(shed_ops & (1U << opidx)) || (uint64_t)delay <= target)
+    return 0;
+
+  Debug(LDAP_DEBUG_CONNS, "connection_op_shed: %s queued for %ld.%03ldms, rejected\n", op->o_log_prefix,
+        (long)(delay / 1000), (long)(delay % 1000));
+  return 1;
+}
+
 static void *connection_operation(void *ctx, void *arg_v) {
   int rc = LDAP_OTHER, cancel;
   Operation *op = arg_v;
@@ -1141,7 +1255,12 @@ static void *connection_operation(void *ctx, void *arg_v) {
   opidx = slap_req2op(tag);
   assert(opidx != SLAP_OP_LAST);
   INCR_OP_INITIATED(opidx);
-  rc = (*(opfun[opidx]))(op, &rs);
+  if (global_admission_target && connection_op_shed(op, opidx)) {
+    send_ldap_error(op, &rs, LDAP_BUSY, "server is overloaded");
+    rc = LDAP_BUSY;
+  } else {
+    rc = (*(opfun[opidx]))(op, &rs);
+  }
 
 operations_error:
   if (rc == SLAPD_DISCONNECT) {
@@ -1221,6 +1340,131 @@ operations_error:
   return NULL;
 }
 
+static int conn_flow_cmp(const void *v1, const void *v2) {
+  const conn_flow *f1 = v1, *f2 = v2;
+  int rc = (int)f1->cf_ndn.bv_len - (int)f2->cf_ndn.bv_len;
+
+  if (rc == 0 && f1->cf_ndn.bv_len)
+    rc = memcmp(f1->cf_ndn.bv_val, f2->cf_ndn.bv_val, f1->cf_ndn.bv_len);
+  return rc;
+}
+
+/* Queue op behind the other pending operations of its identity,
+ * the caller then has to provide a connection_sched_run() task.
+ */
+static void connection_sched_put(Operation *op) {
+  conn_flow *cf, key;
+  int weight;
+
+  weight = slap_tsan__read_int(&op->o_conn->c_sched_weight);
+  if (weight < 1)
+    weight = 1;
+
+  key.cf_ndn = op->o_ndn;
+  ldap_pvt_thread_mutex_lock(&conn_flows_mutex);
+  cf = avl_find(conn_flows, &key, conn_flow_cmp);
+  if (cf == NULL) {
+    cf = ch_malloc(sizeof(conn_flow) + key.cf_ndn.bv_len + 1);
+    cf->cf_ndn.bv_val = (char *)(cf + 1);
+    cf->cf_ndn.bv_len = key.cf_ndn.bv_len;
+    if (key.cf_ndn.bv_len)
+      memcpy(cf->cf_ndn.bv_val, key.cf_ndn.bv_val, key.cf_ndn.bv_len);
+    cf->cf_ndn.bv_val[cf->cf_ndn.bv_len] = '\0';
+    cf->cf_ran = 0;
+    LDAP_STAILQ_INIT(&cf->cf_ops);
+    avl_insert(&conn_flows, cf, conn_flow_cmp, avl_dup_error);
+    LDAP_TAILQ_INSERT_TAIL(&conn_flows_ring, cf, cf_next);
+  }
+  /* the latest binding of the identity decides, as limits may change */
+  cf->cf_weight = weight;
+  LDAP_STAILQ_INSERT_TAIL(&cf->cf_ops, op, o_sched_next);
+  conn_flows_runners++;
+  ldap_pvt_thread_mutex_unlock(&conn_flows_mutex);
+}
+
+static void conn_flow_drop(conn_flow *cf) {
+  LDAP_TAILQ_REMOVE(&conn_flows_ring, cf, cf_next);
+  avl_delete(&conn_flows, cf, conn_flow_cmp);
+  ch_free(cf);
+}
+
+/* Run the queued operations in weighted round-robin order */
+static void *connection_sched_run(void *ctx, void *arg) {
+  conn_flow *cf;
+  Operation *op;
+  void *rc = NULL;
+  int n = 0;
+
+  ldap_pvt_thread_mutex_lock(&conn_flows_mutex);
+  while ((cf = LDAP_TAILQ_FIRST(&conn_flows_ring)) != NULL) {
+    if (n++ == SLAP_SCHED_BATCH) {
+      ldap_pvt_thread_mutex_unlock(&conn_flows_mutex);
+      /* the new task takes over this one's place in conn_flows_runners */
+      if (ldap_pvt_thread_pool_submit(&connection_pool, connection_sched_run, NULL) == 0)
+        return rc;
+      /* go on here then */
+      n = 1;
+      ldap_pvt_thread_mutex_lock(&conn_flows_mutex);
+      continue;
+    }
+    op = LDAP_STAILQ_FIRST(&cf->cf_ops);
+    LDAP_STAILQ_REMOVE_HEAD(&cf->cf_ops, o_sched_next);
+    if (LDAP_STAILQ_EMPTY(&cf->cf_ops)) {
+      conn_flow_drop(cf);
+    } else if (++cf->cf_ran >= cf->cf_weight) {
+      /* turn is over, let the others go first */
+      cf->cf_ran = 0;
+      LDAP_TAILQ_REMOVE(&conn_flows_ring, cf, cf_next);
+      LDAP_TAILQ_INSERT_TAIL(&conn_flows_ring, cf, cf_next);
+    }
+    ldap_pvt_thread_mutex_unlock(&conn_flows_mutex);
+
+    rc = connection_operation(ctx, op);
+
+    ldap_pvt_thread_mutex_lock(&conn_flows_mutex);
+  }
+  conn_flows_runners--;
+  ldap_pvt_thread_mutex_unlock(&conn_flows_mutex);
+
+  return rc;
+}
+
+/* Hand op over to the thread pool */
+static int connection_op_submit(Operation *op) {
+  conn_flow *cf, key;
+  Operation *o;
+  int rc;
+
+  if (!global_weighted_queue)
+    return ldap_pvt_thread_pool_submit(&connection_pool, connection_operation, (void *)op);
+
+  connection_sched_put(op);
+  rc = ldap_pvt_thread_pool_submit(&connection_pool, connection_sched_run, NULL);
+  if (rc != 0) {
+    key.cf_ndn = op->o_ndn;
+    ldap_pvt_thread_mutex_lock(&conn_flows_mutex);
+    conn_flows_runners--;
+    /* another task may have run op already, or will still run it */
+    o = NULL;
+    if (!conn_flows_runners && (cf = avl_find(conn_flows, &key, conn_flow_cmp)) != NULL) {
+      LDAP_STAILQ_FOREACH(o, &cf->cf_ops, o_sched_next) {
+        if (o == op)
+          break;
+      }
+    }
+    if (o) {
+      /* nobody is going to run it */
+      LDAP_STAILQ_REMOVE(&cf->cf_ops, op, Operation, o_sched_next);
+      if (LDAP_STAILQ_EMPTY(&cf->cf_ops))
+        conn_flow_drop(cf);
+    } else {
+      rc = 0;
+    }
+    ldap_pvt_thread_mutex_unlock(&conn_flows_mutex);
+  }
+  return rc;
+}
+
 static const Listener dummy_list = {BER_BVC(""), BER_BVC("")};
 
 Connection *connection_client_setup(const ber_socket_t s, ldap_pvt_thread_start_t *func, void *arg) {
@@ -1275,7 +1519,7 @@ static int connection_read(ber_socket_t s, conn_readinfo *cri);
 
 static void *connection_read_thread(void *ctx, void *argv) {
   int rc;
-  conn_readinfo cri = {NULL, NULL, NULL, NULL, 0};
+  conn_readinfo cri = {NULL, NULL, NULL, NULL, 0, 0};
   ber_socket_t s = (long)argv;
 
   /*
@@ -1290,7 +1534,13 @@ static void *connection_read_thread(void *ctx, void *argv) {
 
   /* execute a single queued request in the same thread */
   if (cri.op && !cri.nullop) {
-    rc = (long)connection_operation(ctx, cri.op);
+    if (global_weighted_queue) {
+      /* but only when its turn comes */
+      connection_sched_put(cri.op);
+      rc = (long)connection_sched_run(ctx, NULL);
+    } else {
+      rc = (long)connection_operation(ctx, cri.op);
+    }
   } else if (cri.func) {
     rc = (long)cri.func(ctx, cri.arg);
   }
@@ -1319,6 +1569,224 @@ int connection_read_activate(ber_socket_t s) {
   return rc;
 }
 
+/* Whether op is one of the listener-inline operations */
+static int connection_op_inline(Operation *op) {
+  slap_mask_t ops = global_inline_ops;
+
+  if (slap_tsan__read_char(&op->o_conn->c_inline_slow))
+    return 0;
+
+  /* the output would only queue up behind a slow reader */
+  if (slap_tsan__read_char(&op->o_conn->c_writing) || slap_tsan__read_int(&op->o_conn->c_writers))
+    return 0;
+
+  switch (op->o_tag) {
+  case LDAP_REQ_ABANDON:
+    return (ops & SLAP_INLINE_ABANDON) != 0;
+  case LDAP_REQ_COMPARE:
+    return (ops & SLAP_INLINE_COMPARE) != 0;
+  case LDAP_REQ_SEARCH:
+    if (ops & SLAP_INLINE_SEARCH_BASE) {
+      BerElementBuffer berbuf;
+      BerElement *ber = (BerElement *)&berbuf;
+      struct berval bv;
+      ber_int_t scope;
+
+      /* peek at the scope, do_search() decodes the request */
+      if (ber_peek_element(op->o_ber, &bv) != LDAP_REQ_SEARCH)
+        return 0;
+      ber_init2(ber, &bv, 0);
+      return ber_scanf(ber, "xe", &scope) != LBER_ERROR && scope == LDAP_SCOPE_BASE;
+    }
+    /* FALLTHRU */
+  default:
+    return 0;
+  }
+}
+
+/*
+ * Read on the listener thread and, if the first request read is one of
+ * the listener-inline operations, execute it right there instead of
+ * handing it to the pool. An operation that takes longer than
+ * listener-inline-budget gets its connection's later requests sent
+ * to the pool again.  Other requests are queued as usual, which for
+ * weighted-queue means per identity.
+ */
+int connection_read_inline(ber_socket_t s, void *ctx) {
+  int rc;
+  conn_readinfo cri = {NULL, NULL, NULL, NULL, 0, 1};
+
+  /* the pool is pausing, don't run anything alongside */
+  if (ldap_pvt_thread_pool_enter(ctx))
+    return connection_read_activate(s);
+
+  rc = slapd_clr_read(s, 0);
+  if (rc)
+    goto done;
+
+  cri.ctx = ctx;
+  if ((rc = connection_read(s, &cri)) < 0) {
+    Debug(LDAP_DEBUG_CONNS, "connection_read(%d) error\n", s);
+    goto done;
+  }
+
+  if (cri.op && !cri.nullop) {
+    if (connection_op_inline(cri.op)) {
+      Connection *c = cri.op->o_conn;
+      unsigned long connid = cri.op->o_connid;
+      slap_time_t start = ldap_now_steady();
+
+      /* the listener must not wait for the client to read */
+      slap_write_inline_begin(ctx, cri.op);
+      connection_operation(ctx, cri.op);
+      slap_write_inline_end(ctx);
+      if (global_inline_budget &&
+          ldap_now_steady().ns - start.ns > global_inline_budget * (uint64_t)1000) {
+        ldap_pvt_thread_mutex_lock(&c->c_mutex);
+        if (c->c_connid == connid) {
+          Debug(LDAP_DEBUG_CONNS, "connection_read_inline(%d): conn=%lu over budget, using the pool\n", s, connid);
+          c->c_inline_slow = 1;
+        }
+        ldap_pvt_thread_mutex_unlock(&c->c_mutex);
+      }
+    } else {
+      rc = connection_op_submit(cri.op);
+    }
+  } else if (cri.func) {
+    rc = ldap_pvt_thread_pool_submit(&connection_pool, cri.func, cri.arg);
+  }
+
+  if (rc != 0) {
+    Debug(LDAP_DEBUG_ANY, "connection_read_inline(%d): submit failed (%d)\n", s, rc);
+  }
+
+done:
+  ldap_pvt_thread_pool_leave(ctx);
+  return rc;
+}
+
+#ifdef WITH_TLS
+/*
+ * Drive the TLS handshake of c forward, c_mutex is locked.  Returns -1
+ * if the connection got closed, 1 if the handshake waits for the socket
+ * to become writable, otherwise 0.
+ */
+static int connection_tls_accept(Connection *c, ber_socket_t s, void *ctx) {
+  int rc;
+
+  rc = ldap_pvt_tls_accept(c->c_sb, ctx);
+  if (rc < 0) {
+    Debug(LDAP_DEBUG_TRACE,
+          "connection_read(%d): TLS accept failure "
+          "error=%d id=%lu, closing\n",
+          s, rc, c->c_connid);
+
+    c->c_needs_tls_accept = 0;
+    /* c_mutex is locked */
+    connection_closing(c, "TLS negotiation failure");
+    connection_close(c);
+    return -1;
+
+  } else if (rc == 0) {
+    void *ssl;
+    struct berval authid = BER_BVNULL;
+    char msgbuf[32];
+
+    c->c_needs_tls_accept = 0;
+
+    /* we need to let SASL know */
+    ssl = ldap_pvt_tls_sb_ctx(c->c_sb);
+
+    c->c_tls_ssf = (slap_ssf_t)ldap_pvt_tls_get_strength(ssl);
+    if (c->c_tls_ssf > c->c_ssf) {
+      c->c_ssf = c->c_tls_ssf;
+    }
+
+    rc = dnX509peerNormalize(ssl, &authid);
+    if (rc != LDAP_SUCCESS) {
+      Debug(LDAP_DEBUG_TRACE,
+            "connection_read(%d): "
+            "unable to get TLS client DN, error=%d id=%lu\n",
+            s, rc, c->c_connid);
+    }
+    sprintf(msgbuf, "tls_ssf=%u ssf=%u", c->c_tls_ssf, c->c_ssf);
+    Statslog(LDAP_DEBUG_STATS, "conn=%lu fd=%d TLS established %s tls_proto=%s tls_cipher=%s\n", c->c_connid, (int)s,
+             msgbuf, ldap_pvt_tls_get_version(ssl), ldap_pvt_tls_get_cipher(ssl));
+    slap_sasl_external(c, c->c_tls_ssf, &authid);
+    if (authid.bv_val)
+      free(authid.bv_val);
+    {
+      char cbinding[64];
+      struct berval cbv = {sizeof(cbinding), cbinding};
+      if (ldap_pvt_tls_get_unique(ssl, &cbv, 1))
+        slap_sasl_cbinding(c, &cbv);
+    }
+  } else if (rc == 1 && ber_sockbuf_ctrl(c->c_sb, LBER_SB_OPT_NEEDS_WRITE, NULL)) { /* need to retry */
+    slapd_set_write(s, 1);
+    return 1;
+  }
+
+  return 0;
+}
+
+typedef struct conn_handshake {
+  ber_socket_t ch_sd;
+  unsigned long ch_connid;
+  void *ch_ctx;
+} conn_handshake;
+
+/*
+ * Runs on tls_handshake_pool. The connection goes back to the normal
+ * read path once the handshake is done, the TLS context was referenced
+ * by the submitter since the server may reload it meanwhile.
+ */
+static void *connection_handshake_thread(void *ctx, void *arg) {
+  conn_handshake *ch = arg;
+  ber_socket_t s = ch->ch_sd;
+  Connection *c;
+  int ready = 0;
+
+  c = connection_get(s);
+  if (c) {
+    Debug(LDAP_DEBUG_TRACE, "connection_handshake_thread(%d): TLS handshake on id=%lu\n", s, ch->ch_connid);
+    if (c->c_connid == ch->ch_connid && c->c_conn_state != SLAP_C_CLOSING && c->c_needs_tls_accept &&
+        !connection_tls_accept(c, s, ch->ch_ctx)) {
+      if (ber_sockbuf_ctrl(c->c_sb, LBER_SB_OPT_DATA_READY, NULL))
+        ready = 1;
+      else
+        slapd_set_read(s, 1);
+    }
+    connection_return(c);
+    if (ready)
+      connection_read_activate(s);
+  }
+
+  ldap_pvt_tls_ctx_free(ch->ch_ctx);
+  ch_free_tag(ch);
+  return NULL;
+}
+
+/* Hand the handshake of c over to tls_handshake_pool, c_mutex is locked */
+static int connection_handshake_submit(Connection *c, ber_socket_t s) {
+  conn_handshake *ch;
+  int rc;
+
+  ch = ch_malloc_tag(sizeof(conn_handshake), SLAP_MEM_CONN);
+  ch->ch_sd = s;
+  ch->ch_connid = c->c_connid;
+  ch->ch_ctx = NULL;
+  ldap_pvt_tls_get_option(slap_tls_ld, LDAP_OPT_X_TLS_CTX, &ch->ch_ctx);
+
+  rc = ldap_pvt_thread_pool_submit(&tls_handshake_pool, connection_handshake_thread, ch);
+  if (rc != 0) {
+    Debug(LDAP_DEBUG_ANY, "connection_handshake_submit(%d): submit failed (%d)\n", s, rc);
+    ldap_pvt_tls_ctx_free(ch->ch_ctx);
+    ch_free_tag(ch);
+  }
+  return rc;
+}
+#endif /* WITH_TLS */
+
 static int connection_read(ber_socket_t s, conn_readinfo *cri) {
   int rc = 0;
   Connection *c;
@@ -1353,57 +1821,21 @@ static int connection_read(ber_socket_t s, conn_readinfo *cri) {
   Debug(LDAP_DEBUG_TRACE, "connection_read(%d): checking for input on id=%lu\n", s, c->c_connid);
 
 #ifdef WITH_TLS
-  if (c->c_is_tls && c->c_needs_tls_accept) {
-    rc = ldap_pvt_tls_accept(c->c_sb, slap_tls_ctx);
-    if (rc < 0) {
-      Debug(LDAP_DEBUG_TRACE,
-            "connection_read(%d): TLS accept failure "
-            "error=%d id=%lu, closing\n",
-            s, rc, c->c_connid);
-
-      c->c_needs_tls_accept = 0;
-      /* c_mutex is locked */
-      connection_closing(c, "TLS negotiation failure");
-      connection_close(c);
-      connection_return(c);
-      return 0;
-
-    } else if (rc == 0) {
-      void *ssl;
-      struct berval authid = BER_BVNULL;
-      char msgbuf[32];
-
-      c->c_needs_tls_accept = 0;
-
-      /* we need to let SASL know */
-      ssl = ldap_pvt_tls_sb_ctx(c->c_sb);
+  if (c->c_is_tls && c->c_needs_tls_accept && tls_handshake_pool_max && !connection_handshake_submit(c, s)) {
+    connection_return(c);
+    return 0;
+  }
 
-      c->c_tls_ssf = (slap_ssf_t)ldap_pvt_tls_get_strength(ssl);
-      if (c->c_tls_ssf > c->c_ssf) {
-        c->c_ssf = c->c_tls_ssf;
-      }
+  if (c->c_is_tls && c->c_needs_tls_accept && cri->inplace) {
+    /* leave the handshake to the pool */
+    cri->func = connection_read_thread;
+    cri->arg = (void *)(long)s;
+    connection_return(c);
+    return 0;
+  }
 
-      rc = dnX509peerNormalize(ssl, &authid);
-      if (rc != LDAP_SUCCESS) {
-        Debug(LDAP_DEBUG_TRACE,
-              "connection_read(%d): "
-              "unable to get TLS client DN, error=%d id=%lu\n",
-              s, rc, c->c_connid);
-      }
-      sprintf(msgbuf, "tls_ssf=%u ssf=%u", c->c_tls_ssf, c->c_ssf);
-      Statslog(LDAP_DEBUG_STATS, "conn=%lu fd=%d TLS established %s tls_proto=%s tls_cipher=%s\n", c->c_connid, (int)s,
-               msgbuf, ldap_pvt_tls_get_version(ssl), ldap_pvt_tls_get_cipher(ssl));
-      slap_sasl_external(c, c->c_tls_ssf, &authid);
-      if (authid.bv_val)
-        free(authid.bv_val);
-      {
-        char cbinding[64];
-        struct berval cbv = {sizeof(cbinding), cbinding};
-        if (ldap_pvt_tls_get_unique(ssl, &cbv, 1))
-          slap_sasl_cbinding(c, &cbv);
-      }
-    } else if (rc == 1 && ber_sockbuf_ctrl(c->c_sb, LBER_SB_OPT_NEEDS_WRITE, NULL)) { /* need to retry */
-      slapd_set_write(s, 1);
+  if (c->c_is_tls && c->c_needs_tls_accept) {
+    if (connection_tls_accept(c, s, slap_tls_ctx)) {
       connection_return(c);
       return 0;
     }
@@ -1702,7 +2134,7 @@ static int connection_input(Connection *conn, conn_readinfo *cri) {
     } else {
       if (!cri->nullop) {
         cri->nullop = 1;
-        rc = ldap_pvt_thread_pool_submit(&connection_pool, connection_operation, (void *)cri->op);
+        rc = connection_op_submit(cri->op);
       }
       connection_op_activate(op);
     }
@@ -1780,6 +2212,9 @@ static int connection_bind_cleanup_cb(Operation *op, SlapReply *rs) {
 }
 
 static int connection_bind_cb(Operation *op, SlapReply *rs) {
+  struct berval ndn = BER_BVNULL;
+  int weigh = 0;
+
   ldap_pvt_thread_mutex_lock(&op->o_conn->c_mutex);
   op->o_conn->c_sasl_bind_in_progress = (rs->sr_err == LDAP_SASL_BIND_IN_PROGRESS);
 
@@ -1822,8 +2257,25 @@ static int connection_bind_cb(Operation *op, SlapReply *rs) {
       }
     }
   }
+  if (rs->sr_err == LDAP_SUCCESS && global_weighted_queue) {
+    /* the identity later operations will be queued by */
+    weigh = 1;
+    ber_dupbv_x(&ndn, BER_BVISNULL(&op->o_conn->c_sasl_authz_dn) ? &op->o_conn->c_ndn : &op->o_conn->c_sasl_authz_dn,
+                op->o_tmpmemctx);
+  }
   ldap_pvt_thread_mutex_unlock(&op->o_conn->c_mutex);
 
+  if (weigh) {
+    /* group limits need a backend lookup, don't hold c_mutex for it */
+    int weight = limits_weight(op, &ndn);
+
+    ldap_pvt_thread_mutex_lock(&op->o_conn->c_mutex);
+    op->o_conn->c_sched_weight = weight;
+    ldap_pvt_thread_mutex_unlock(&op->o_conn->c_mutex);
+    if (!BER_BVISNULL(&ndn))
+      op->o_tmpfree(ndn.bv_val, op->o_tmpmemctx);
+  }
+
   ch_free(op->o_callback);
   op->o_callback = NULL;
 
@@ -1853,6 +2305,11 @@ static void connection_op_queue(Operation *op) {
     }
   }
 
+  /* bound identities get their weight in connection_bind_cb() */
+  if (global_weighted_queue && !op->o_conn->c_sched_weight && BER_BVISEMPTY(&op->o_ndn)) {
+    op->o_conn->c_sched_weight = limits_weight(op, &op->o_ndn);
+  }
+
   op->o_authtype = op->o_conn->c_authtype;
   ber_dupbv(&op->o_authmech, &op->o_conn->c_authmech);
 
@@ -1875,7 +2332,7 @@ static int connection_op_activate(Operation *op) {
 
   connection_op_queue(op);
 
-  rc = ldap_pvt_thread_pool_submit(&connection_pool, connection_operation, (void *)op);
+  rc = connection_op_submit(op);
 
   if (rc != 0) {
     Debug(LDAP_DEBUG_ANY, "connection_op_activate: submit failed (%d) for conn=%lu\n", rc, op->o_connid);
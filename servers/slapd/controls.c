@@ -625,6 +625,7 @@ int slap_parse_ctrl(Operation *op, SlapReply *rs, LDAPControl *control, const ch
     if ((sc->sc_mask & tagmask) == tagmask) {
       /* available extension */
       if (sc->sc_parse) {
+        op->o_ctrls_parsed = 1;
         rc = sc->sc_parse(op, rs, control);
         assert(rc != LDAP_UNAVAILABLE_CRITICAL_EXTENSION);
 
@@ -944,6 +945,21 @@ int slap_remove_control(Operation *op, SlapReply *rs, int ctrl, BI_chk_controls
   return rs->sr_err;
 }
 
+/* The sort a database may serve itself, attached to the search by the
+ * sort overlay with oe_key == slap_sorted_search. Copies of the search
+ * share the o_extra list, but not the request. */
+SortedSearch *slap_sorted_search(Operation *op) {
+  OpExtra *oex;
+
+  LDAP_SLIST_FOREACH(oex, &op->o_extra, oe_next) {
+    if (oex->oe_key == (void *)slap_sorted_search) {
+      SortedSearch *ss = (SortedSearch *)oex;
+      return ss->ss_op == op && ss->ss_private == op->o_bd->be_private ? ss : NULL;
+    }
+  }
+  return NULL;
+}
+
 static int parseDontUseCopy(Operation *op, SlapReply *rs, LDAPControl *ctrl) {
   if (op->o_dontUseCopy != SLAP_CONTROL_NONE) {
     rs->sr_text = "dontUseCopy control specified multiple times";
@@ -24,6 +24,8 @@
 #include <ac/time.h>
 #include <ac/unistd.h>
 
+#include <fcntl.h>
+
 #include "slap.h"
 #include "ldap_pvt_thread.h"
 #include "lutil.h"
@@ -42,10 +44,14 @@
 
 #if defined(HAVE_SYS_EPOLL_H) && defined(HAVE_EPOLL)
 #include <sys/epoll.h>
+#ifdef SLAPD_IOURING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif /* SLAPD_IOURING */
 #elif defined(SLAP_X_DEVPOLL) && defined(HAVE_SYS_DEVPOLL_H) && defined(HAVE_DEVPOLL)
 #include <sys/types.h>
 #include <sys/stat.h>
-#include <fcntl.h>
 #include <sys/devpoll.h>
 #endif /* ! epoll && ! /dev/poll */
 
@@ -81,6 +87,8 @@ struct {
 #endif
 int slapd_daemon_threads = 1;
 int slapd_daemon_mask;
+int slapd_listener_reuseport;
+int slapd_iouring = 1;
 
 #ifdef LDAP_TCP_BUFFER
 int slapd_tcp_rmem;
@@ -172,6 +180,9 @@ typedef struct slap_daemon_st {
   struct epoll_event *sd_epolls;
   int *sd_index;
   int sd_epfd;
+#ifdef SLAPD_IOURING
+  struct slap_uring *sd_uring; /* NULL when plain epoll is used */
+#endif                         /* SLAPD_IOURING */
 #elif defined(SLAP_X_DEVPOLL) && defined(HAVE_DEVPOLL)
   /* eXperimental */
   struct pollfd *sd_pollfd;
@@ -187,6 +198,832 @@ typedef struct slap_daemon_st {
 
 static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
 
+#if defined(HAVE_EPOLL) && defined(SLAPD_IOURING)
+/*
+ * io_uring flavour of the epoll backend. The epoll bookkeeping
+ * (sd_epolls, sd_index) stays as is, only epoll_ctl() and epoll_wait()
+ * are replaced: interest changes are queued on the submission ring as
+ * one-shot poll requests, and the whole batch reaches the kernel with
+ * the same io_uring_enter() which waits for completions. A poll which
+ * fired is re-armed from the current interest mask on the next wait,
+ * this gives the level-triggered behaviour the loop expects of epoll.
+ *
+ * Input is not polled for where the kernel allows it. A listener gets
+ * a multishot accept, and the accepted descriptors are queued for
+ * slap_listener(). A connection gets a multishot recv into the buffers
+ * the ring provides, the data is copied to the input queue of the
+ * descriptor and the buffer is handed back at once; the connection's
+ * sockbuf provider (slap_uring_sbio) feeds ber_get_next() from that
+ * queue, with no read() of its own. A descriptor with queued input, or
+ * with the end of stream or an error, is reported readable as long as
+ * its EPOLLIN interest is set, so polls remain for EPOLLOUT only. The
+ * queues are bounded, a full one has its request canceled until it is
+ * drained. Output is written in place, as with epoll: the PDUs of a
+ * search are batched into few writes already (see slap_write_batch),
+ * and a write which would block waits for EPOLLOUT.
+ *
+ * Changes made while the owning thread sleeps in io_uring_enter() are
+ * submitted at once, otherwise they ride along with the next wait.
+ */
+#define SLAP_URING_ENTRIES 1024
+#define SLAP_URING_BUFS 128 /* provided buffers per ring, a power of 2 */
+#define SLAP_URING_BUFSIZE 8192
+#define SLAP_URING_BGID 0
+#define SLAP_URING_INPUT_MAX (256 * 1024)        /* bytes queued for a connection */
+#define SLAP_URING_ACCEPT_MAX (64 * sizeof(int)) /* descriptors queued for a listener */
+#define SLAP_URING_CTL_DATA ((__u64)-1)
+#define SLAP_URING_NOACCEPT (-2)
+#define SLAP_URING_DATA(kind, gen, fd) (((__u64)(kind) << 48) | ((__u64)(gen) << 32) | (__u32)(fd))
+#define SLAP_URING_KIND(data) ((unsigned)((data) >> 48))
+
+/* how the input of a descriptor is waited for */
+#define SLAP_URING_POLL 0   /* poll requests only */
+#define SLAP_URING_RECV 1   /* multishot recv */
+#define SLAP_URING_ACCEPT 2 /* multishot accept */
+
+#define SLAP_URING_IDLE 0   /* no request */
+#define SLAP_URING_ARMED 1  /* request is in the kernel */
+#define SLAP_URING_FIRED 2  /* poll completed, to be re-armed */
+#define SLAP_URING_CANCEL 3 /* input request is being canceled */
+
+#define SLAP_URING_TODO 1   /* on the ur_todo list */
+#define SLAP_URING_UPDATE 2 /* poll update deferred for want of an SQE */
+
+/* Whether a poll data pointer is an index slot rather than a Listener */
+#define SLAP_URING_IS_INDEX(sd, ptr) ((int *)(ptr) >= (sd)->sd_index && (int *)(ptr) <= &(sd)->sd_index[dtblsize])
+
+typedef struct slap_uring_input {
+  unsigned char in_kind;
+  unsigned char in_state;
+  unsigned char in_todo;
+  int in_err; /* -1 at the end of stream, else errno of the failure */
+  char *in_buf;
+  size_t in_head, in_tail, in_size;
+} slap_uring_input;
+
+typedef struct slap_uring {
+  ldap_pvt_thread_mutex_t ur_mutex;
+  int ur_fd;
+  int ur_sleeping;
+  unsigned ur_skip;
+  unsigned ur_sq_entries;
+  unsigned ur_sq_mask, ur_cq_mask;
+  unsigned *ur_sq_head, *ur_sq_tail;
+  unsigned *ur_cq_head, *ur_cq_tail;
+  struct io_uring_sqe *ur_sqes;
+  struct io_uring_cqe *ur_cqes;
+  void *ur_sq_ring, *ur_cq_ring;
+  size_t ur_sq_size, ur_cq_size;
+  unsigned char *ur_state;
+  unsigned short *ur_gen;
+  int *ur_fired;
+  int ur_nfired;
+  slap_uring_input *ur_input;
+  int *ur_todo;
+  int ur_ntodo;
+  struct io_uring_buf_ring *ur_br; /* NULL when input is polled for */
+  char *ur_bufs;
+  unsigned short ur_br_tail;
+  int ur_recv, ur_accept; /* multishot recv and accept are usable */
+} slap_uring;
+
+static int slap_uring_enter(slap_uring *ur, unsigned submit, unsigned wait, unsigned flags, void *arg, size_t argsz) {
+  return syscall(__NR_io_uring_enter, ur->ur_fd, submit, wait, flags, arg, argsz);
+}
+
+static unsigned slap_uring_queued(slap_uring *ur) {
+  return *ur->ur_sq_tail - __atomic_load_n(ur->ur_sq_head, __ATOMIC_ACQUIRE);
+}
+
+static struct io_uring_sqe *slap_uring_sqe(slap_uring *ur) {
+  struct io_uring_sqe *sqe;
+
+  if (slap_uring_queued(ur) >= ur->ur_sq_entries) {
+    slap_uring_enter(ur, slap_uring_queued(ur), 0, 0, NULL, 0);
+    if (slap_uring_queued(ur) >= ur->ur_sq_entries)
+      return NULL;
+  }
+
+  sqe = &ur->ur_sqes[*ur->ur_sq_tail & ur->ur_sq_mask];
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+static void slap_uring_push(slap_uring *ur) { __atomic_store_n(ur->ur_sq_tail, *ur->ur_sq_tail + 1, __ATOMIC_RELEASE); }
+
+static void slap_uring_todo(slap_uring *ur, ber_socket_t s, int flags) {
+  if (!(ur->ur_input[s].in_todo & SLAP_URING_TODO))
+    ur->ur_todo[ur->ur_ntodo++] = s;
+  ur->ur_input[s].in_todo |= SLAP_URING_TODO | flags;
+}
+
+/* Make a sleeping io_uring_enter() return, for the todo list to be seen */
+static void slap_uring_kick(slap_uring *ur) {
+  struct io_uring_sqe *sqe;
+
+  if (!ur->ur_sleeping)
+    return;
+  sqe = slap_uring_sqe(ur);
+  if (sqe != NULL) {
+    sqe->opcode = IORING_OP_NOP;
+    sqe->user_data = SLAP_URING_CTL_DATA;
+    slap_uring_push(ur);
+  }
+  slap_uring_enter(ur, slap_uring_queued(ur), 0, 0, NULL, 0);
+}
+
+static unsigned slap_uring_mask(slap_daemon_st *sd, ber_socket_t s) {
+  unsigned events = sd->sd_epolls[sd->sd_index[s]].events;
+
+  return sd->sd_uring->ur_input[s].in_kind == SLAP_URING_POLL ? events : events & ~EPOLLIN;
+}
+
+static int slap_uring_poll(slap_daemon_st *sd, ber_socket_t s) {
+  slap_uring *ur = sd->sd_uring;
+  struct io_uring_sqe *sqe = slap_uring_sqe(ur);
+
+  if (sqe == NULL)
+    return -1;
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = s;
+  sqe->poll_events = slap_uring_mask(sd, s);
+  sqe->user_data = SLAP_URING_DATA(SLAP_URING_POLL, ur->ur_gen[s], s);
+  slap_uring_push(ur);
+  ur->ur_state[s] = SLAP_URING_ARMED;
+  return 0;
+}
+
+/* Bring the poll request of s in line with its interest mask */
+static int slap_uring_update(slap_daemon_st *sd, ber_socket_t s) {
+  slap_uring *ur = sd->sd_uring;
+  struct io_uring_sqe *sqe;
+
+  switch (ur->ur_state[s]) {
+  case SLAP_URING_IDLE:
+    return slap_uring_mask(sd, s) ? slap_uring_poll(sd, s) : 0;
+
+  case SLAP_URING_ARMED:
+    /* an empty mask is not worth a removal, it fires on hangup only
+     * and is not re-armed then */
+    sqe = slap_uring_sqe(ur);
+    if (sqe == NULL)
+      return -1;
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->flags = ur->ur_skip;
+    sqe->addr = SLAP_URING_DATA(SLAP_URING_POLL, ur->ur_gen[s], s);
+    sqe->len = IORING_POLL_UPDATE_EVENTS;
+    sqe->poll_events = slap_uring_mask(sd, s);
+    sqe->user_data = SLAP_URING_CTL_DATA;
+    slap_uring_push(ur);
+    break;
+  }
+  /* a fired request picks the new mask up when re-armed */
+  return 0;
+}
+
+static int slap_uring_arm(slap_uring *ur, ber_socket_t s) {
+  slap_uring_input *in = &ur->ur_input[s];
+  struct io_uring_sqe *sqe = slap_uring_sqe(ur);
+
+  if (sqe == NULL)
+    return -1;
+  sqe->fd = s;
+  if (in->in_kind == SLAP_URING_RECV) {
+    sqe->opcode = IORING_OP_RECV;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = SLAP_URING_BGID;
+  } else {
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  }
+  sqe->user_data = SLAP_URING_DATA(in->in_kind, ur->ur_gen[s], s);
+  slap_uring_push(ur);
+  in->in_state = SLAP_URING_ARMED;
+  return 0;
+}
+
+static int slap_uring_cancel(slap_uring *ur, ber_socket_t s) {
+  slap_uring_input *in = &ur->ur_input[s];
+  struct io_uring_sqe *sqe = slap_uring_sqe(ur);
+
+  if (sqe == NULL)
+    return -1;
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->flags = ur->ur_skip;
+  sqe->addr = SLAP_URING_DATA(in->in_kind, ur->ur_gen[s], s);
+  sqe->user_data = SLAP_URING_CTL_DATA;
+  slap_uring_push(ur);
+  in->in_state = SLAP_URING_CANCEL;
+  return 0;
+}
+
+static size_t slap_uring_input_len(slap_uring_input *in) { return in->in_tail - in->in_head; }
+
+static size_t slap_uring_input_max(slap_uring_input *in) {
+  return in->in_kind == SLAP_URING_ACCEPT ? SLAP_URING_ACCEPT_MAX : SLAP_URING_INPUT_MAX;
+}
+
+static void slap_uring_input_put(slap_uring_input *in, const void *data, size_t len) {
+  if (in->in_head && in->in_tail + len > in->in_size) {
+    memmove(in->in_buf, in->in_buf + in->in_head, in->in_tail - in->in_head);
+    in->in_tail -= in->in_head;
+    in->in_head = 0;
+  }
+  if (in->in_tail + len > in->in_size) {
+    in->in_size = in->in_size ? in->in_size * 2 : SLAP_URING_BUFSIZE;
+    if (in->in_size < in->in_tail + len)
+      in->in_size = in->in_tail + len;
+    in->in_buf = ch_realloc(in->in_buf, in->in_size);
+  }
+  memcpy(in->in_buf + in->in_tail, data, len);
+  in->in_tail += len;
+}
+
+static void slap_uring_input_get(slap_uring_input *in, void *data, size_t len) {
+  memcpy(data, in->in_buf + in->in_head, len);
+  in->in_head += len;
+  if (in->in_head == in->in_tail)
+    in->in_head = in->in_tail = 0;
+}
+
+/* Drop the input of a descriptor no longer watched */
+static void slap_uring_input_drop(slap_uring_input *in) {
+  int fd;
+
+  if (in->in_kind == SLAP_URING_ACCEPT) {
+    while (slap_uring_input_len(in) >= sizeof(fd)) {
+      slap_uring_input_get(in, &fd, sizeof(fd));
+      close(fd);
+    }
+  }
+  ch_free(in->in_buf);
+  in->in_buf = NULL;
+  in->in_head = in->in_tail = in->in_size = 0;
+  in->in_err = 0;
+  in->in_kind = SLAP_URING_POLL;
+  in->in_state = SLAP_URING_IDLE;
+  in->in_todo &= ~SLAP_URING_UPDATE;
+}
+
+/* Whether s is to be reported readable out of its input queue */
+static int slap_uring_readable(slap_daemon_st *sd, ber_socket_t s) {
+  slap_uring_input *in = &sd->sd_uring->ur_input[s];
+
+  return (in->in_head != in->in_tail || in->in_err) && sd->sd_index[s] != -1 &&
+         (sd->sd_epolls[sd->sd_index[s]].events & EPOLLIN);
+}
+
+/* Whether the input request of s is to be (re)submitted */
+static int slap_uring_starving(slap_uring *ur, ber_socket_t s) {
+  slap_uring_input *in = &ur->ur_input[s];
+
+  return in->in_kind != SLAP_URING_POLL && in->in_state == SLAP_URING_IDLE && !in->in_err &&
+         slap_uring_input_len(in) < slap_uring_input_max(in);
+}
+
+static void slap_uring_recycle(slap_uring *ur, unsigned bid) {
+  struct io_uring_buf *buf = &ur->ur_br->bufs[ur->ur_br_tail & (SLAP_URING_BUFS - 1)];
+
+  /* the resv field of the first one is the ring tail */
+  buf->addr = (__u64)(uintptr_t)(ur->ur_bufs + bid * SLAP_URING_BUFSIZE);
+  buf->len = SLAP_URING_BUFSIZE;
+  buf->bid = bid;
+  __atomic_store_n(&ur->ur_br->tail, ++ur->ur_br_tail, __ATOMIC_RELEASE);
+}
+
+static void slap_uring_input_cqe(slap_uring *ur, struct io_uring_cqe *cqe) {
+  int fd = (__u32)cqe->user_data;
+  unsigned kind = SLAP_URING_KIND(cqe->user_data);
+  slap_uring_input *in = &ur->ur_input[fd];
+  int stale = cqe->user_data != SLAP_URING_DATA(in->in_kind, ur->ur_gen[fd], fd);
+
+  if (cqe->flags & IORING_CQE_F_BUFFER) {
+    unsigned bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+
+    if (!stale && cqe->res > 0)
+      slap_uring_input_put(in, ur->ur_bufs + bid * SLAP_URING_BUFSIZE, cqe->res);
+    slap_uring_recycle(ur, bid);
+  }
+  if (stale) {
+    /* accepted for a listener which is gone */
+    if (kind == SLAP_URING_ACCEPT && cqe->res >= 0)
+      close(cqe->res);
+    return;
+  }
+
+  if (kind == SLAP_URING_ACCEPT && cqe->res >= 0) {
+    slap_uring_input_put(in, &cqe->res, sizeof(cqe->res));
+  } else if (cqe->res == 0) {
+    in->in_err = -1;
+  } else if (cqe->res == -EINVAL && in->in_state == SLAP_URING_ARMED) {
+    /* the kernel knows no multishot for this one, poll instead */
+    Debug(LDAP_DEBUG_ANY, "daemon: io_uring multishot %s is not supported, polling instead\n",
+          kind == SLAP_URING_RECV ? "recv" : "accept");
+    if (kind == SLAP_URING_RECV)
+      ur->ur_recv = 0;
+    else
+      ur->ur_accept = 0;
+    in->in_kind = SLAP_URING_POLL;
+    in->in_state = SLAP_URING_IDLE;
+    slap_uring_todo(ur, fd, SLAP_URING_UPDATE);
+    return;
+  } else if (cqe->res < 0 && cqe->res != -ENOBUFS && cqe->res != -ECANCELED) {
+    in->in_err = -cqe->res;
+  }
+
+  if (!(cqe->flags & IORING_CQE_F_MORE))
+    in->in_state = SLAP_URING_IDLE;
+  else if (in->in_state == SLAP_URING_ARMED && slap_uring_input_len(in) >= slap_uring_input_max(in))
+    slap_uring_cancel(ur, fd);
+  slap_uring_todo(ur, fd, 0);
+}
+
+static int slap_uring_ctl(slap_daemon_st *sd, int op, ber_socket_t s, struct epoll_event *ev) {
+  slap_uring *ur = sd->sd_uring;
+  slap_uring_input *in = &ur->ur_input[s];
+  struct io_uring_sqe *sqe;
+  int rc = 0;
+
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  switch (op) {
+  case EPOLL_CTL_ADD:
+    assert(ur->ur_state[s] == SLAP_URING_IDLE);
+    if (!SLAP_URING_IS_INDEX(sd, ev->data.ptr) && ur->ur_accept
+#ifdef LDAP_CONNECTIONLESS
+        && !((Listener *)ev->data.ptr)->sl_is_udp
+#endif /* LDAP_CONNECTIONLESS */
+    )
+      in->in_kind = SLAP_URING_ACCEPT;
+    if (in->in_kind != SLAP_URING_POLL && slap_uring_arm(ur, s) != 0)
+      slap_uring_todo(ur, s, 0);
+    if (slap_uring_mask(sd, s))
+      rc = slap_uring_poll(sd, s);
+    break;
+
+  case EPOLL_CTL_MOD:
+    if (slap_uring_update(sd, s) != 0) {
+      /* the ring is full, the next wait does it */
+      Debug(LDAP_DEBUG_CONNS, "daemon: io_uring is full, update of %d deferred\n", s);
+      slap_uring_todo(ur, s, SLAP_URING_UPDATE);
+      slap_uring_kick(ur);
+    }
+    if (slap_uring_readable(sd, s)) {
+      slap_uring_todo(ur, s, 0);
+      slap_uring_kick(ur);
+    }
+    break;
+
+  case EPOLL_CTL_DEL:
+    if (ur->ur_state[s] == SLAP_URING_ARMED) {
+      sqe = slap_uring_sqe(ur);
+      if (sqe == NULL) {
+        rc = -1;
+        break;
+      }
+      sqe->opcode = IORING_OP_POLL_REMOVE;
+      sqe->fd = -1;
+      sqe->flags = ur->ur_skip;
+      sqe->addr = SLAP_URING_DATA(SLAP_URING_POLL, ur->ur_gen[s], s);
+      sqe->user_data = SLAP_URING_CTL_DATA;
+      slap_uring_push(ur);
+    }
+    /* the request holds the socket open until canceled */
+    if (in->in_state == SLAP_URING_ARMED && slap_uring_cancel(ur, s) != 0) {
+      rc = -1;
+      break;
+    }
+    slap_uring_input_drop(in);
+    /* late completions of the old requests are recognized as stale */
+    ur->ur_state[s] = SLAP_URING_IDLE;
+    ur->ur_gen[s]++;
+    break;
+  }
+
+  if (rc == 0 && ur->ur_sleeping)
+    slap_uring_enter(ur, slap_uring_queued(ur), 0, 0, NULL, 0);
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+
+  if (rc)
+    errno = EBUSY;
+  return rc;
+}
+
+static int slap_uring_wait(slap_daemon_st *sd, struct epoll_event *revents, int maxevents, slap_time_t *tvp) {
+  slap_uring *ur = sd->sd_uring;
+  struct io_uring_getevents_arg arg;
+  struct __kernel_timespec ts;
+  unsigned head, tail, submit;
+  int i, j, n, rc, err, ready;
+
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  for (i = n = 0; i < ur->ur_nfired; i++) {
+    int fd = ur->ur_fired[i];
+
+    if (ur->ur_state[fd] != SLAP_URING_FIRED)
+      continue;
+    if (!slap_uring_mask(sd, fd))
+      ur->ur_state[fd] = SLAP_URING_IDLE;
+    else if (slap_uring_poll(sd, fd) != 0)
+      ur->ur_fired[n++] = fd;
+  }
+  ur->ur_nfired = n;
+  ready = 0;
+  for (i = 0; i < ur->ur_ntodo; i++) {
+    int fd = ur->ur_todo[i];
+    slap_uring_input *in = &ur->ur_input[fd];
+
+    if (sd->sd_index[fd] == -1)
+      continue;
+    if ((in->in_todo & SLAP_URING_UPDATE) && slap_uring_update(sd, fd) == 0)
+      in->in_todo &= ~SLAP_URING_UPDATE;
+    if (slap_uring_starving(ur, fd))
+      slap_uring_arm(ur, fd);
+    ready |= slap_uring_readable(sd, fd);
+  }
+  ready |= __atomic_load_n(ur->ur_cq_tail, __ATOMIC_ACQUIRE) != *ur->ur_cq_head;
+  ur->ur_sleeping = !ready;
+  submit = slap_uring_queued(ur);
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+
+  memset(&arg, 0, sizeof(arg));
+  arg.sigmask_sz = _NSIG / 8;
+  if (tvp) {
+    ts.tv_sec = tvp->ns / 1000000000;
+    ts.tv_nsec = tvp->ns % 1000000000;
+    arg.ts = (__u64)(uintptr_t)&ts;
+  }
+  rc = slap_uring_enter(ur, submit, ready ? 0 : 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+  err = errno;
+
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  ur->ur_sleeping = 0;
+  head = *ur->ur_cq_head;
+  tail = __atomic_load_n(ur->ur_cq_tail, __ATOMIC_ACQUIRE);
+  for (n = 0; head != tail && n < maxevents; head++) {
+    struct io_uring_cqe *cqe = &ur->ur_cqes[head & ur->ur_cq_mask];
+    int fd = (__u32)cqe->user_data;
+    unsigned events;
+
+    if (cqe->user_data == SLAP_URING_CTL_DATA) {
+      if (cqe->res < 0 && cqe->res != -ENOENT && cqe->res != -EALREADY)
+        Debug(LDAP_DEBUG_CONNS, "daemon: io_uring poll update failed (%d)\n", -cqe->res);
+      continue;
+    }
+    if (SLAP_URING_KIND(cqe->user_data) != SLAP_URING_POLL) {
+      slap_uring_input_cqe(ur, cqe);
+      continue;
+    }
+    if (cqe->user_data != SLAP_URING_DATA(SLAP_URING_POLL, ur->ur_gen[fd], fd) ||
+        ur->ur_state[fd] != SLAP_URING_ARMED)
+      continue;
+
+    ur->ur_state[fd] = SLAP_URING_FIRED;
+    ur->ur_fired[ur->ur_nfired++] = fd;
+    if (cqe->res <= 0) {
+      Debug(LDAP_DEBUG_CONNS, "daemon: io_uring poll on %d failed (%d)\n", fd, -cqe->res);
+      continue;
+    }
+    events = cqe->res;
+    if (ur->ur_input[fd].in_kind != SLAP_URING_POLL) {
+      /* the input request tells about the input and the hangup */
+      if (!(slap_uring_mask(sd, fd) & EPOLLOUT))
+        continue;
+      events &= ~EPOLLIN;
+    }
+    revents[n].events = events;
+    revents[n].data.ptr = sd->sd_epolls[sd->sd_index[fd]].data.ptr;
+    n++;
+  }
+  __atomic_store_n(ur->ur_cq_head, head, __ATOMIC_RELEASE);
+
+  /* report the queued input, keep what is left to do for the next wait */
+  for (i = j = 0; i < ur->ur_ntodo; i++) {
+    int fd = ur->ur_todo[i];
+    slap_uring_input *in = &ur->ur_input[fd];
+
+    if (slap_uring_readable(sd, fd) && n < maxevents) {
+      revents[n].events = EPOLLIN;
+      revents[n].data.ptr = sd->sd_epolls[sd->sd_index[fd]].data.ptr;
+      n++;
+    } else if (sd->sd_index[fd] == -1 || (!(in->in_todo & SLAP_URING_UPDATE) && !slap_uring_starving(ur, fd))) {
+      in->in_todo = 0;
+      continue;
+    }
+    ur->ur_todo[j++] = fd;
+  }
+  ur->ur_ntodo = j;
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+
+  if (n == 0 && rc < 0 && err != ETIME && err != EBUSY) {
+    errno = err;
+    return -1;
+  }
+  return n;
+}
+
+/*
+ * Sockbuf provider of the connections a ring serves. Reads take the
+ * input the multishot recv queued, or go to the socket when the input
+ * is polled for; writes go to the socket as with ber_sockbuf_io_tcp.
+ */
+static int slap_uring_sb_setup(Sockbuf_IO_Desc *sbiod, void *arg) {
+  ber_socket_t s = *(ber_socket_t *)arg;
+  slap_uring *ur = slap_daemon[DAEMON_ID(s)].sd_uring;
+  int ktls = 0;
+
+#ifdef WITH_TLS
+  /* kTLS reads the socket from beneath the sockbuf */
+  ldap_pvt_tls_get_option(slap_tls_ld, LDAP_OPT_X_TLS_KTLS, &ktls);
+#endif /* WITH_TLS */
+  sbiod->sbiod_sb->sb_fd = s;
+  sbiod->sbiod_pvt = ur;
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  ur->ur_input[s].in_kind = ur->ur_recv && !ktls ? SLAP_URING_RECV : SLAP_URING_POLL;
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+  return 0;
+}
+
+static int slap_uring_sb_ctrl(Sockbuf_IO_Desc *sbiod, int opt, void *arg) {
+  slap_uring *ur = sbiod->sbiod_pvt;
+  int rc = 0;
+
+  if (opt == LBER_SB_OPT_DATA_READY) {
+    ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+    rc = slap_uring_input_len(&ur->ur_input[sbiod->sbiod_sb->sb_fd]) != 0;
+    ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+  }
+  return rc;
+}
+
+static ber_slen_t slap_uring_sb_read(Sockbuf_IO_Desc *sbiod, void *buf, ber_len_t len) {
+  slap_uring *ur = sbiod->sbiod_pvt;
+  ber_socket_t s = sbiod->sbiod_sb->sb_fd;
+  slap_uring_input *in = &ur->ur_input[s];
+  ber_slen_t rc = -1;
+  int err = EWOULDBLOCK, polled;
+
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  polled = in->in_kind == SLAP_URING_POLL;
+  if (in->in_head != in->in_tail) {
+    rc = slap_uring_input_len(in) < len ? slap_uring_input_len(in) : len;
+    slap_uring_input_get(in, buf, rc);
+    /* resume a recv canceled for the queue was full */
+    if (slap_uring_starving(ur, s)) {
+      slap_uring_todo(ur, s, 0);
+      slap_uring_kick(ur);
+    }
+  } else if (in->in_err) {
+    rc = in->in_err < 0 ? 0 : -1;
+    err = in->in_err;
+  }
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+
+  if (rc < 0 && err == EWOULDBLOCK && polled)
+    return read(s, buf, len);
+  if (rc < 0)
+    sock_errset(err);
+  return rc;
+}
+
+static ber_slen_t slap_uring_sb_write(Sockbuf_IO_Desc *sbiod, void *buf, ber_len_t len) {
+  return write(sbiod->sbiod_sb->sb_fd, buf, len);
+}
+
+static int slap_uring_sb_close(Sockbuf_IO_Desc *sbiod) {
+  slap_uring *ur = sbiod->sbiod_pvt;
+  ber_socket_t s = sbiod->sbiod_sb->sb_fd;
+
+  if (s != AC_SOCKET_INVALID) {
+    /* EPOLL_CTL_DEL dropped the input already, unless never added */
+    ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+    if (ur->ur_input[s].in_state == SLAP_URING_IDLE)
+      slap_uring_input_drop(&ur->ur_input[s]);
+    ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+    sbiod->sbiod_sb->sb_fd = AC_SOCKET_INVALID;
+    tcp_close(s);
+  }
+  return 0;
+}
+
+static Sockbuf_IO slap_uring_sbio = {
+    slap_uring_sb_setup, /* sbi_setup */
+    NULL,                /* sbi_remove */
+    slap_uring_sb_ctrl,  /* sbi_ctrl */
+    slap_uring_sb_read,  /* sbi_read */
+    slap_uring_sb_write, /* sbi_write */
+    slap_uring_sb_close  /* sbi_close */
+};
+
+/* The next descriptor the multishot accept queued for listener s, or
+ * SLAP_URING_NOACCEPT when s is polled for and accept() is up to the
+ * caller. */
+static ber_socket_t slap_uring_accept(ber_socket_t s, struct sockaddr *sa, ber_socklen_t *lenp) {
+  slap_uring *ur = slap_daemon[DAEMON_ID(s)].sd_uring;
+  slap_uring_input *in;
+  ber_socket_t fd = AC_SOCKET_INVALID;
+  int err = EWOULDBLOCK;
+
+  if (ur == NULL)
+    return SLAP_URING_NOACCEPT;
+
+  in = &ur->ur_input[s];
+  ldap_pvt_thread_mutex_lock(&ur->ur_mutex);
+  if (slap_uring_input_len(in) >= sizeof(fd)) {
+    slap_uring_input_get(in, &fd, sizeof(fd));
+  } else if (in->in_err) {
+    err = in->in_err;
+    in->in_err = 0;
+  } else if (in->in_kind != SLAP_URING_ACCEPT) {
+    fd = SLAP_URING_NOACCEPT;
+  }
+  if (slap_uring_starving(ur, s)) {
+    slap_uring_todo(ur, s, 0);
+    slap_uring_kick(ur);
+  }
+  ldap_pvt_thread_mutex_unlock(&ur->ur_mutex);
+
+  if (fd == AC_SOCKET_INVALID)
+    sock_errset(err);
+  else if (fd != SLAP_URING_NOACCEPT && getpeername(fd, sa, lenp) != 0)
+    sa->sa_family = AF_UNSPEC;
+  return fd;
+}
+
+static void slap_uring_destroy(slap_uring *ur) {
+  int i;
+
+  if (ur->ur_sqes != NULL)
+    munmap(ur->ur_sqes, ur->ur_sq_entries * sizeof(struct io_uring_sqe));
+  if (ur->ur_cq_ring != NULL && ur->ur_cq_ring != ur->ur_sq_ring)
+    munmap(ur->ur_cq_ring, ur->ur_cq_size);
+  if (ur->ur_sq_ring != NULL)
+    munmap(ur->ur_sq_ring, ur->ur_sq_size);
+  close(ur->ur_fd);
+  if (ur->ur_br != NULL)
+    munmap(ur->ur_br, SLAP_URING_BUFS * sizeof(struct io_uring_buf));
+  ch_free(ur->ur_bufs);
+  for (i = 0; i < dtblsize; i++)
+    ch_free(ur->ur_input[i].in_buf);
+  ldap_pvt_thread_mutex_destroy(&ur->ur_mutex);
+  ch_free(ur);
+}
+
+/* Provide the buffers the multishot recv picks from */
+static void slap_uring_bufs(slap_uring *ur, int t) {
+  struct io_uring_buf_reg reg;
+  unsigned i;
+
+  ur->ur_br = mmap(NULL, SLAP_URING_BUFS * sizeof(struct io_uring_buf), PROT_READ | PROT_WRITE,
+                   MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+  if (ur->ur_br == MAP_FAILED) {
+    ur->ur_br = NULL;
+  } else {
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (__u64)(uintptr_t)ur->ur_br;
+    reg.ring_entries = SLAP_URING_BUFS;
+    reg.bgid = SLAP_URING_BGID;
+    if (syscall(__NR_io_uring_register, ur->ur_fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0) {
+      munmap(ur->ur_br, SLAP_URING_BUFS * sizeof(struct io_uring_buf));
+      ur->ur_br = NULL;
+    }
+  }
+  if (ur->ur_br == NULL) {
+    Debug(LDAP_DEBUG_ANY, "daemon: io_uring buffer ring failed errno=%d, polling for input on thread %d\n", errno,
+          t);
+    return;
+  }
+
+  ur->ur_bufs = ch_malloc(SLAP_URING_BUFS * SLAP_URING_BUFSIZE);
+  for (i = 0; i < SLAP_URING_BUFS; i++)
+    slap_uring_recycle(ur, i);
+  ur->ur_recv = 1;
+}
+
+static slap_uring *slap_uring_init(int t) {
+  struct io_uring_params p;
+  slap_uring *ur;
+  unsigned i, *array;
+  int fd;
+
+  memset(&p, 0, sizeof(p));
+  fd = syscall(__NR_io_uring_setup, SLAP_URING_ENTRIES, &p);
+  if (fd < 0) {
+    int err = errno;
+    Debug(LDAP_DEBUG_ANY, "daemon: io_uring_setup() failed errno=%d (%s), using epoll for thread %d\n", err,
+          sock_errstr(err), t);
+    return NULL;
+  }
+
+  /* one-shot poll updates need 5.13, IORING_FEAT_RSRC_TAGS came with it */
+  if (!(p.features & IORING_FEAT_EXT_ARG) || !(p.features & IORING_FEAT_RSRC_TAGS)) {
+    Debug(LDAP_DEBUG_ANY, "daemon: io_uring lacks needed features (0x%x), using epoll for thread %d\n", p.features, t);
+    close(fd);
+    return NULL;
+  }
+
+  ur = ch_calloc(1, sizeof(slap_uring) + dtblsize * (sizeof(slap_uring_input) + 2 * sizeof(int) +
+                                                      sizeof(unsigned short) + sizeof(unsigned char)));
+  ur->ur_input = (slap_uring_input *)(ur + 1);
+  ur->ur_fired = (int *)(ur->ur_input + dtblsize);
+  ur->ur_todo = ur->ur_fired + dtblsize;
+  ur->ur_gen = (unsigned short *)(ur->ur_todo + dtblsize);
+  ur->ur_state = (unsigned char *)(ur->ur_gen + dtblsize);
+  ur->ur_fd = fd;
+  ldap_pvt_thread_mutex_init(&ur->ur_mutex);
+
+  ur->ur_sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  ur->ur_cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ur->ur_cq_size > ur->ur_sq_size)
+      ur->ur_sq_size = ur->ur_cq_size;
+    ur->ur_cq_size = ur->ur_sq_size;
+  }
+  ur->ur_sq_ring =
+      mmap(NULL, ur->ur_sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ur->ur_sq_ring == MAP_FAILED) {
+    ur->ur_sq_ring = NULL;
+    goto fail;
+  }
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    ur->ur_cq_ring = ur->ur_sq_ring;
+  } else {
+    ur->ur_cq_ring =
+        mmap(NULL, ur->ur_cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (ur->ur_cq_ring == MAP_FAILED) {
+      ur->ur_cq_ring = NULL;
+      goto fail;
+    }
+  }
+  ur->ur_sq_entries = p.sq_entries;
+  ur->ur_sqes = mmap(NULL, p.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (ur->ur_sqes == MAP_FAILED) {
+    ur->ur_sqes = NULL;
+    goto fail;
+  }
+
+  ur->ur_sq_head = (unsigned *)((char *)ur->ur_sq_ring + p.sq_off.head);
+  ur->ur_sq_tail = (unsigned *)((char *)ur->ur_sq_ring + p.sq_off.tail);
+  ur->ur_sq_mask = *(unsigned *)((char *)ur->ur_sq_ring + p.sq_off.ring_mask);
+  ur->ur_cq_head = (unsigned *)((char *)ur->ur_cq_ring + p.cq_off.head);
+  ur->ur_cq_tail = (unsigned *)((char *)ur->ur_cq_ring + p.cq_off.tail);
+  ur->ur_cq_mask = *(unsigned *)((char *)ur->ur_cq_ring + p.cq_off.ring_mask);
+  ur->ur_cqes = (struct io_uring_cqe *)((char *)ur->ur_cq_ring + p.cq_off.cqes);
+
+  /* submission slots are used in order */
+  array = (unsigned *)((char *)ur->ur_sq_ring + p.sq_off.array);
+  for (i = 0; i < p.sq_entries; i++)
+    array[i] = i;
+
+#ifdef IOSQE_CQE_SKIP_SUCCESS
+  if (p.features & IORING_FEAT_CQE_SKIP)
+    ur->ur_skip = IOSQE_CQE_SKIP_SUCCESS;
+#endif /* IOSQE_CQE_SKIP_SUCCESS */
+
+  ur->ur_accept = 1;
+  slap_uring_bufs(ur, t);
+
+  Debug(LDAP_DEBUG_CONNS, "daemon: using io_uring for thread %d\n", t);
+  return ur;
+
+fail:
+  Debug(LDAP_DEBUG_ANY, "daemon: io_uring mmap() failed errno=%d, using epoll for thread %d\n", errno, t);
+  slap_uring_destroy(ur);
+  return NULL;
+}
+
+#define SLAP_EPOLL_CTL(t, op, s, ev)                                                                                   \
+  (slap_daemon[t].sd_uring ? slap_uring_ctl(&slap_daemon[t], (op), (s), (ev))                                         \
+                           : epoll_ctl(slap_daemon[t].sd_epfd, (op), (s), (ev)))
+#define SLAP_EPOLL_WAIT(t, ev, n, tvp)                                                                                 \
+  (slap_daemon[t].sd_uring ? slap_uring_wait(&slap_daemon[t], (ev), (n), (tvp))                                       \
+                           : epoll_wait(slap_daemon[t].sd_epfd, (ev), (n), (tvp) ? ldap_to_milliseconds(*(tvp)) : -1))
+#define SLAP_URING_INIT(t) (slap_daemon[t].sd_uring = slapd_iouring ? slap_uring_init(t) : NULL)
+#define SLAP_URING_DESTROY(t)                                                                                          \
+  do {                                                                                                                 \
+    if (slap_daemon[t].sd_uring != NULL) {                                                                             \
+      slap_uring_destroy(slap_daemon[t].sd_uring);                                                                     \
+      slap_daemon[t].sd_uring = NULL;                                                                                  \
+    }                                                                                                                  \
+  } while (0)
+#define SLAP_URING_ACCEPTED(s, sa, lenp) slap_uring_accept((s), (sa), (lenp))
+#elif defined(HAVE_EPOLL)
+#define SLAP_EPOLL_CTL(t, op, s, ev) epoll_ctl(slap_daemon[t].sd_epfd, (op), (s), (ev))
+#define SLAP_EPOLL_WAIT(t, ev, n, tvp)                                                                                 \
+  epoll_wait(slap_daemon[t].sd_epfd, (ev), (n), (tvp) ? ldap_to_milliseconds(*(tvp)) : -1)
+#define SLAP_URING_INIT(t) ((void)0)
+#define SLAP_URING_DESTROY(t) ((void)0)
+#endif /* HAVE_EPOLL */
+
+#ifndef SLAP_URING_ACCEPTED
+#define SLAP_URING_NOACCEPT (-2)
+#define SLAP_URING_ACCEPTED(s, sa, lenp) SLAP_URING_NOACCEPT
+#endif /* ! SLAP_URING_ACCEPTED */
+
 /*
  * NOTE: naming convention for macros:
  *
@@ -214,11 +1051,18 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
 #define SLAP_SOCK_IS_READ(t, s) SLAP_EPOLL_SOCK_IS_SET(t, (s), EPOLLIN)
 #define SLAP_SOCK_IS_WRITE(t, s) SLAP_EPOLL_SOCK_IS_SET(t, (s), EPOLLOUT)
 
+/* io_uring defers a change it has no room for, a failed epoll_ctl() is logged */
+#define SLAP_EPOLL_SOCK_MOD(t, s)                                                                                      \
+  do {                                                                                                                 \
+    if (SLAP_EPOLL_CTL(t, EPOLL_CTL_MOD, (s), &SLAP_EPOLL_SOCK_EP(t, (s))) != 0)                                       \
+      Debug(LDAP_DEBUG_ANY, "daemon: epoll_ctl(MOD,fd=%d) failed, errno=%d\n", (s), errno);                            \
+  } while (0)
+
 #define SLAP_EPOLL_SOCK_SET(t, s, mode)                                                                                \
   do {                                                                                                                 \
     if ((SLAP_EPOLL_SOCK_EV(t, s) & (mode)) != (mode)) {                                                               \
       SLAP_EPOLL_SOCK_EV(t, s) |= (mode);                                                                              \
-      epoll_ctl(slap_daemon[t].sd_epfd, EPOLL_CTL_MOD, (s), &SLAP_EPOLL_SOCK_EP(t, s));                                \
+      SLAP_EPOLL_SOCK_MOD(t, (s));                                                                                     \
     }                                                                                                                  \
   } while (0)
 
@@ -226,7 +1070,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
   do {                                                                                                                 \
     if ((SLAP_EPOLL_SOCK_EV(t, s) & (mode))) {                                                                         \
       SLAP_EPOLL_SOCK_EV(t, s) &= ~(mode);                                                                             \
-      epoll_ctl(slap_daemon[t].sd_epfd, EPOLL_CTL_MOD, s, &SLAP_EPOLL_SOCK_EP(t, s));                                  \
+      SLAP_EPOLL_SOCK_MOD(t, (s));                                                                                     \
     }                                                                                                                  \
   } while (0)
 
@@ -255,7 +1099,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
     SLAP_EPOLL_SOCK_IX(t, (s)) = slap_daemon[t].sd_nfds;                                                               \
     SLAP_EPOLL_SOCK_EP(t, (s)).data.ptr = (l) ? (l) : (void *)(&SLAP_EPOLL_SOCK_IX(t, s));                             \
     SLAP_EPOLL_SOCK_EV(t, (s)) = EPOLLIN;                                                                              \
-    rc = epoll_ctl(slap_daemon[t].sd_epfd, EPOLL_CTL_ADD, (s), &SLAP_EPOLL_SOCK_EP(t, (s)));                           \
+    rc = SLAP_EPOLL_CTL(t, EPOLL_CTL_ADD, (s), &SLAP_EPOLL_SOCK_EP(t, (s)));                                           \
     if (rc == 0) {                                                                                                     \
       slap_daemon[t].sd_nfds++;                                                                                        \
     } else {                                                                                                           \
@@ -275,7 +1119,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
     int fd, rc, index = SLAP_EPOLL_SOCK_IX(t, (s));                                                                    \
     if (index < 0)                                                                                                     \
       break;                                                                                                           \
-    rc = epoll_ctl(slap_daemon[t].sd_epfd, EPOLL_CTL_DEL, (s), &SLAP_EPOLL_SOCK_EP(t, (s)));                           \
+    rc = SLAP_EPOLL_CTL(t, EPOLL_CTL_DEL, (s), &SLAP_EPOLL_SOCK_EP(t, (s)));                                           \
     if (rc) {                                                                                                          \
       Debug(LDAP_DEBUG_ANY,                                                                                            \
             "daemon: epoll_ctl(epfd=%d,DEL,fd=%d) failed, errno=%d, shutting "                                         \
@@ -312,6 +1156,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
     slap_daemon[t].sd_epfd = epoll_create(dtblsize / slapd_daemon_threads);                                            \
     for (j = 0; j < dtblsize; j++)                                                                                     \
       slap_daemon[t].sd_index[j] = -1;                                                                                 \
+    SLAP_URING_INIT(t);                                                                                                \
   } while (0)
 
 #define SLAP_SOCK_DESTROY(t)                                                                                           \
@@ -321,6 +1166,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
       slap_daemon[t].sd_epolls = NULL;                                                                                 \
       slap_daemon[t].sd_index = NULL;                                                                                  \
       close(slap_daemon[t].sd_epfd);                                                                                   \
+      SLAP_URING_DESTROY(t);                                                                                           \
     }                                                                                                                  \
   } while (0)
 
@@ -333,7 +1179,7 @@ static slap_daemon_st slap_daemon[SLAPD_MAX_DAEMON_THREADS];
 
 #define SLAP_EVENT_WAIT(t, tvp, nsp)                                                                                   \
   do {                                                                                                                 \
-    *(nsp) = epoll_wait(slap_daemon[t].sd_epfd, revents, dtblsize, (tvp) ? ldap_to_milliseconds(*tvp) : -1);           \
+    *(nsp) = SLAP_EPOLL_WAIT(t, revents, dtblsize, (tvp));                                                             \
   } while (0)
 
 #elif defined(SLAP_X_DEVPOLL) && defined(HAVE_DEVPOLL)
@@ -745,6 +1591,17 @@ static void slapd_add(ber_socket_t s, int isactive, Listener *sl, int id) {
   WAKE_LISTENER(id, 1);
 }
 
+/*
+ * The sockbuf provider for a connection socket
+ */
+Sockbuf_IO *slapd_sockbuf_io(ber_socket_t s) {
+#if defined(HAVE_EPOLL) && defined(SLAPD_IOURING)
+  if (slap_daemon[DAEMON_ID(s)].sd_uring != NULL)
+    return &slap_uring_sbio;
+#endif /* HAVE_EPOLL && SLAPD_IOURING */
+  return &ber_sockbuf_io_tcp;
+}
+
 /*
  * Remove the descriptor from daemon control
  */
@@ -1130,6 +1987,143 @@ errexit:
   return -1;
 }
 
+#ifdef SO_REUSEPORT
+/* With SO_REUSEPORT each listener thread may poll its own socket
+ * bound to the same address, so the kernel spreads incoming
+ * connections over per-thread accept queues. The sockets have to be
+ * bound now, before privileges are dropped and before listener-threads
+ * is configured, hence enough spares are opened for the largest number
+ * of threads; slap_shard_listeners() hands them out and closes the rest.
+ */
+static void slap_open_shards(Listener *l, struct sockaddr *sa, int addrlen) {
+  int i, tmp, rc;
+
+  l->sl_shards = ch_malloc((SLAPD_MAX_DAEMON_THREADS - 1) * sizeof(ber_socket_t));
+  for (i = 0; i < SLAPD_MAX_DAEMON_THREADS - 1; i++) {
+    ber_socket_t s = socket(sa->sa_family, SOCK_STREAM, 0);
+    if (s == AC_SOCKET_INVALID)
+      break;
+    if (s >= dtblsize) {
+      tcp_close(s);
+      break;
+    }
+
+#ifdef SO_REUSEADDR
+    tmp = 1;
+    (void)setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (char *)&tmp, sizeof(tmp));
+#endif /* SO_REUSEADDR */
+    tmp = 1;
+    rc = setsockopt(s, SOL_SOCKET, SO_REUSEPORT, (char *)&tmp, sizeof(tmp));
+#if defined(LDAP_PF_INET6) && defined(IPV6_V6ONLY)
+    if (rc == 0 && sa->sa_family == AF_INET6) {
+      tmp = 1;
+      rc = setsockopt(s, IPPROTO_IPV6, IPV6_V6ONLY, (char *)&tmp, sizeof(tmp));
+    }
+#endif /* LDAP_PF_INET6 && IPV6_V6ONLY */
+    if (rc == 0)
+      rc = bind(s, sa, addrlen);
+    if (rc) {
+      int err = sock_errno();
+      Debug(LDAP_DEBUG_ANY, "daemon: reuseport socket %d for listener %ld failed errno=%d (%s)\n", i + 1,
+            (long)l->sl_sd, err, sock_errstr(err));
+      tcp_close(s);
+      break;
+    }
+    l->sl_shards[i] = s;
+  }
+
+  l->sl_nshards = i;
+  if (i == 0) {
+    ch_free(l->sl_shards);
+    l->sl_shards = NULL;
+  }
+}
+
+/* Move a spare socket to a descriptor served by listener thread id. */
+static ber_socket_t slap_shard_move(ber_socket_t s, int id) {
+  int fd = id;
+
+  while (fd < dtblsize) {
+    int d = fcntl(s, F_DUPFD, fd);
+    if (d < 0)
+      break;
+    if (d < dtblsize && DAEMON_ID(d) == id) {
+      tcp_close(s);
+      return d;
+    }
+    tcp_close(d);
+    fd = d - DAEMON_ID(d) + id;
+    if (fd <= d)
+      fd += slapd_daemon_mask + 1;
+  }
+
+  tcp_close(s);
+  return AC_SOCKET_INVALID;
+}
+
+/* Give every listener thread a socket of its own for each listener
+ * opened with spares. The copies follow their primary in slap_listeners,
+ * as listeners of the same URL do, and inherit its settings.
+ */
+static void slap_shard_listeners(void) {
+  int l, n;
+
+  for (n = 0; slap_listeners[n] != NULL; n++)
+    ;
+
+  for (l = 0; slap_listeners[l] != NULL; l++) {
+    Listener *lr = slap_listeners[l];
+    ber_socket_t *shards = lr->sl_shards;
+    int i, t, nshards = lr->sl_nshards;
+
+    if (shards == NULL)
+      continue;
+    lr->sl_shards = NULL;
+    lr->sl_nshards = 0;
+
+    for (t = 0; lr->sl_sd != AC_SOCKET_INVALID && t < slapd_daemon_threads; t++) {
+      Listener *li;
+
+      if (t == DAEMON_ID(lr->sl_sd))
+        continue;
+
+      /* prefer a spare which already falls to this thread */
+      for (i = 0; i < nshards; i++)
+        if (shards[i] != AC_SOCKET_INVALID && DAEMON_ID(shards[i]) == t)
+          break;
+      if (i == nshards) {
+        for (i = 0; i < nshards && shards[i] == AC_SOCKET_INVALID; i++)
+          ;
+        if (i == nshards)
+          break;
+        shards[i] = slap_shard_move(shards[i], t);
+        if (shards[i] == AC_SOCKET_INVALID)
+          continue;
+      }
+
+      li = ch_malloc(sizeof(Listener));
+      *li = *lr;
+      li->sl_sd = shards[i];
+      ber_dupbv(&li->sl_url, &lr->sl_url);
+      ber_dupbv(&li->sl_name, &lr->sl_name);
+      shards[i] = AC_SOCKET_INVALID;
+
+      slap_listeners = ch_realloc(slap_listeners, (n + 2) * sizeof(Listener *));
+      memmove(&slap_listeners[l + 2], &slap_listeners[l + 1], (n - l) * sizeof(Listener *));
+      slap_listeners[++l] = li;
+      n++;
+
+      Debug(LDAP_DEBUG_CONNS, "daemon: listener %s, socket %d for thread %d\n", li->sl_url.bv_val, li->sl_sd, t);
+    }
+
+    for (i = 0; i < nshards; i++)
+      if (shards[i] != AC_SOCKET_INVALID)
+        tcp_close(shards[i]);
+    ch_free(shards);
+  }
+}
+#endif /* SO_REUSEPORT */
+
 static int slap_open_listener(const char *url, int *listeners, int *cur) {
   int tmp, rc;
   Listener l;
@@ -1183,6 +2177,8 @@ static int slap_open_listener(const char *url, int *listeners, int *cur) {
   l.sl_tcp_rmem = 0;
   l.sl_tcp_wmem = 0;
 #endif /* LDAP_TCP_BUFFER */
+  l.sl_shards = NULL;
+  l.sl_nshards = 0;
 
   port = (unsigned short)lud->lud_port;
 
@@ -1287,6 +2283,19 @@ static int slap_open_listener(const char *url, int *listeners, int *cur) {
               (long)l.sl_sd, err, sock_errstr(err));
       }
 #endif /* SO_REUSEADDR */
+#ifdef SO_REUSEPORT
+      if (slapd_listener_reuseport && socktype == SOCK_STREAM) {
+        tmp = 1;
+        rc = setsockopt(s, SOL_SOCKET, SO_REUSEPORT, (char *)&tmp, sizeof(tmp));
+        if (rc == AC_SOCKET_ERROR) {
+          int err = sock_errno();
+          Debug(LDAP_DEBUG_ANY,
+                "slapd(%ld): "
+                "setsockopt(SO_REUSEPORT) failed errno=%d (%s)\n",
+                (long)l.sl_sd, err, sock_errstr(err));
+        }
+      }
+#endif /* SO_REUSEPORT */
     }
 
     switch ((*sal)->sa_family) {
@@ -1355,6 +2364,17 @@ static int slap_open_listener(const char *url, int *listeners, int *cur) {
       continue;
     }
 
+    l.sl_shards = NULL;
+    l.sl_nshards = 0;
+#ifdef SO_REUSEPORT
+    if (slapd_listener_reuseport && socktype == SOCK_STREAM
+#ifdef LDAP_PF_LOCAL
+        && (*sal)->sa_family != AF_LOCAL
+#endif /* LDAP_PF_LOCAL */
+    )
+      slap_open_shards(&l, *sal, addrlen);
+#endif /* SO_REUSEPORT */
+
     switch ((*sal)->sa_family) {
 #ifdef LDAP_PF_LOCAL
     case AF_LOCAL: {
@@ -1536,6 +2556,13 @@ static void destroy_listeners(void) {
       ber_memfree(lr->sl_name.bv_val);
     }
 
+    if (lr->sl_shards) {
+      int i;
+      for (i = 0; i < lr->sl_nshards; i++)
+        tcp_close(lr->sl_shards[i]);
+      ch_free(lr->sl_shards);
+    }
+
     free(lr);
   }
 
@@ -1645,7 +2672,14 @@ static int slap_listener(Listener *sl) {
   from.sa_un_addr.sun_path[0] = '\0';
 #endif /* LDAP_PF_LOCAL */
 
-  s = accept(sl->sl_sd, (struct sockaddr *)&from, &len);
+  /* io_uring may have accepted already */
+  s = SLAP_URING_ACCEPTED(sl->sl_sd, (struct sockaddr *)&from, &len);
+  if (s == SLAP_URING_NOACCEPT)
+#ifdef HAVE_ACCEPT4
+    s = accept4(sl->sl_sd, (struct sockaddr *)&from, &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+    s = accept(sl->sl_sd, (struct sockaddr *)&from, &len);
+#endif /* HAVE_ACCEPT4 */
 
   /* Resume the listener FD to allow concurrent-processing of
    * additional incoming connections.
@@ -1879,6 +2913,15 @@ static int slap_listener_activate(Listener *sl) {
 
   sl->sl_busy = 1;
 
+  if (global_weighted_queue) {
+    /* accept right here, not behind the queued operations */
+#ifdef __SANITIZE_THREAD__
+    ldap_pvt_thread_mutex_unlock(&tsan_mutex);
+#endif
+    slap_listener_thread(NULL, sl);
+    return 0;
+  }
+
   rc = ldap_pvt_thread_pool_submit(&connection_pool, slap_listener_thread, (void *)sl);
 
   if (rc != 0) {
@@ -1893,10 +2936,20 @@ static int slap_listener_activate(Listener *sl) {
   return rc;
 }
 
+/* Hand a readable connection to the pool, or read it in place when
+ * listener-inline is configured.  With weighted-queue reads are done
+ * in place too, lest they wait in the pool behind queued operations. */
+static int slapd_read_activate(ber_socket_t s, void *ctx) {
+  if (ctx && (global_inline_ops || global_weighted_queue))
+    return connection_read_inline(s, ctx);
+  return connection_read_activate(s);
+}
+
 static void *slapd_daemon_task(void *ptr) {
   slap_time_t last_idle_check = {0};
   int ebadf = 0;
   int tid = (ldap_pvt_thread_t *)ptr - listener_tid;
+  void *inline_ctx;
 
 #define SLAPD_IDLE_CHECK_LIMIT 4
 
@@ -2067,6 +3120,7 @@ static void *slapd_daemon_task(void *ptr) {
   }
 
 loop:
+  inline_ctx = ldap_pvt_thread_pool_attach(&connection_pool);
 
   /* initialization complete. Here comes the loop. */
 
@@ -2196,6 +3250,8 @@ loop:
         int64_t diff_ns = cat.ns - now.ns;
         if (diff_ns < 0)
           diff_ns = 0;
+        /* the wait is in milliseconds, don't spin through the last one */
+        diff_ns = (diff_ns + 999999) / 1000000 * 1000000;
         if (tvp == NULL || diff_ns < (int64_t)tv.ns) {
           tv.ns = diff_ns;
           tvp = &tv;
@@ -2385,7 +3441,7 @@ loop:
        * active.
        */
 
-      connection_read_activate(rd);
+      slapd_read_activate(rd, inline_ctx);
     }
 #else /* !SLAP_EVENTS_ARE_INDEXED */
     /* FIXME */
@@ -2476,7 +3532,7 @@ loop:
           Debug(LDAP_DEBUG_CONNS, "daemon: read active on %d\n", fd);
 
           SLAP_EVENT_CLR_READ(i);
-          connection_read_activate(fd);
+          slapd_read_activate(fd, inline_ctx);
         }
         if (r + w < 0
 #ifdef SLAP_EVENT_IS_ERROR
@@ -2504,6 +3560,8 @@ loop:
 #endif /* ! HAVE_YIELDING_SELECT */
   }
 
+  ldap_pvt_thread_pool_detach(inline_ctx);
+
   /* Only thread 0 handles shutdown */
   if (tid)
     return NULL;
@@ -2529,6 +3587,9 @@ loop:
     Debug(LDAP_DEBUG_ANY, "slapd shutdown: waiting for %d operations/tasks to finish\n", t);
   }
   ldap_pvt_thread_pool_close(&connection_pool, 1);
+#ifdef WITH_TLS
+  ldap_pvt_thread_pool_close(&tls_handshake_pool, 1);
+#endif
 
   return NULL;
 }
@@ -2570,6 +3631,10 @@ int slapd_daemon(void) {
   if (slapd_daemon_threads > SLAPD_MAX_DAEMON_THREADS)
     slapd_daemon_threads = SLAPD_MAX_DAEMON_THREADS;
 
+#ifdef SO_REUSEPORT
+  slap_shard_listeners();
+#endif /* SO_REUSEPORT */
+
   listener_tid = ch_malloc(slapd_daemon_threads * sizeof(ldap_pvt_thread_t));
 
   /* daemon_init only inits element 0 */
@@ -52,10 +52,26 @@ static const struct berval dn_bv = BER_BVC("dn");
 #define CHUNK_SIZE 1000
 typedef struct slap_list {
   struct slap_list *next;
+  ber_len_t size; /* as charged to SLAP_MEM_ENTRY */
 } slap_list;
 static slap_list *entry_chunks;
 static Entry *entry_list;
 static ldap_pvt_thread_mutex_t entry_mutex;
+static slap_freelist_stats entry_stats; /* protected by entry_mutex */
+
+/*
+ * Per-thread caches in front of entry_list, same scheme as for
+ * attributes in attr.c.
+ */
+#define ENTRY_CACHE_MAX 64
+#define ENTRY_CACHE_BATCH 16
+typedef struct entry_cache {
+  Entry *ec_list;
+  int ec_count;
+} entry_cache;
+static __thread entry_cache *entry_tcache;
+static entry_cache entry_nocache;
+static void *entry_main_ctx;
 
 int entry_destroy(void) {
   slap_list *e;
@@ -67,8 +83,12 @@ int entry_destroy(void) {
 
   for (e = entry_chunks; e; e = entry_chunks) {
     entry_chunks = e->next;
+    slap_mem_uncharge(SLAP_MEM_ENTRY, e->size);
     free(e);
   }
+  entry_list = NULL;
+  memset(&entry_stats, 0, sizeof(entry_stats));
+  entry_tcache = NULL;
 
   ldap_pvt_thread_mutex_destroy(&entry_mutex);
   ldap_pvt_thread_mutex_destroy(&entry2str_mutex);
@@ -78,6 +98,7 @@ int entry_destroy(void) {
 int entry_init(void) {
   ldap_pvt_thread_mutex_init(&entry2str_mutex);
   ldap_pvt_thread_mutex_init(&entry_mutex);
+  entry_main_ctx = ldap_pvt_thread_pool_context();
   return attr_init();
 }
 
@@ -442,12 +463,25 @@ void entry_clean(Entry *e) {
   e->e_ocflags = 0;
 }
 
+static entry_cache *entry_cache_get(void);
+static void entry_cache_trim(entry_cache *ec, int keep);
+
 void entry_free(Entry *e) {
+  entry_cache *ec = entry_cache_get();
+
   entry_clean(e);
 
+  if (ec != &entry_nocache) {
+    e->e_private = ec->ec_list;
+    ec->ec_list = e;
+    if (++ec->ec_count > ENTRY_CACHE_MAX)
+      entry_cache_trim(ec, ENTRY_CACHE_BATCH);
+    return;
+  }
   ldap_pvt_thread_mutex_lock(&entry_mutex);
   e->e_private = entry_list;
   entry_list = e;
+  entry_stats.fs_free++;
   ldap_pvt_thread_mutex_unlock(&entry_mutex);
 }
 
@@ -477,8 +511,12 @@ int entry_prealloc(int num) {
 #endif
 
   s = ch_calloc(1, sizeof(slap_list) + num * sizeof(Entry));
+  s->size = sizeof(slap_list) + num * sizeof(Entry);
+  slap_mem_charge(SLAP_MEM_ENTRY, s->size);
   s->next = entry_chunks;
   entry_chunks = s;
+  entry_stats.fs_total += num;
+  entry_stats.fs_free += num;
 
   prev = &tmp;
   for (i = 0; i < STRIPE; i++) {
@@ -496,14 +534,106 @@ int entry_prealloc(int num) {
   return 0;
 }
 
+/* Move num entries from the shared list to the thread cache */
+static void entry_cache_refill(entry_cache *ec, int num) {
+  Entry **e, *head;
+  int n;
+
+  ldap_pvt_thread_mutex_lock(&entry_mutex);
+  if (entry_stats.fs_free < (unsigned long)num)
+    entry_prealloc(CHUNK_SIZE);
+  head = entry_list;
+  for (e = &entry_list, n = num; n > 0; n--)
+    e = (Entry **)&(*e)->e_private;
+  entry_list = *e;
+  entry_stats.fs_free -= num;
+  entry_stats.fs_refills++;
+  ldap_pvt_thread_mutex_unlock(&entry_mutex);
+
+  *e = ec->ec_list;
+  ec->ec_list = head;
+  ec->ec_count += num;
+}
+
+/* Give all but keep entries back to the shared list */
+static void entry_cache_trim(entry_cache *ec, int keep) {
+  Entry *head, *tail;
+  int n;
+
+  n = ec->ec_count - keep;
+  if (n <= 0)
+    return;
+  head = ec->ec_list;
+  for (tail = head; --n > 0;)
+    tail = tail->e_private;
+  ec->ec_list = tail->e_private;
+  n = ec->ec_count - keep;
+  ec->ec_count = keep;
+
+  ldap_pvt_thread_mutex_lock(&entry_mutex);
+  tail->e_private = entry_list;
+  entry_list = head;
+  entry_stats.fs_free += n;
+  entry_stats.fs_returns++;
+  ldap_pvt_thread_mutex_unlock(&entry_mutex);
+}
+
+/* pool key destructor, runs on the exiting thread */
+static void entry_cache_free(void *key, void *data) {
+  entry_cache *ec = data;
+
+  entry_cache_trim(ec, 0);
+  if (entry_tcache == ec)
+    entry_tcache = NULL;
+  ch_free(ec);
+}
+
+static entry_cache *entry_cache_get(void) {
+  entry_cache *ec = entry_tcache;
+  void *ctx;
+
+  if (likely(ec != NULL))
+    return ec;
+
+  ec = &entry_nocache;
+  ctx = ldap_pvt_thread_pool_context();
+  if (ctx != entry_main_ctx) {
+    entry_cache *nc = ch_calloc(1, sizeof(entry_cache));
+    if (ldap_pvt_thread_pool_setkey(ctx, (void *)entry_cache_get, nc, entry_cache_free, NULL, NULL) == 0)
+      ec = nc;
+    else
+      ch_free(nc);
+  }
+  entry_tcache = ec;
+  return ec;
+}
+
+void entry_freelist_stats(slap_freelist_stats *fs) {
+  ldap_pvt_thread_mutex_lock(&entry_mutex);
+  *fs = entry_stats;
+  ldap_pvt_thread_mutex_unlock(&entry_mutex);
+}
+
 Entry *entry_alloc(void) {
+  entry_cache *ec = entry_cache_get();
   Entry *e;
 
+  if (ec != &entry_nocache) {
+    if (!ec->ec_list)
+      entry_cache_refill(ec, ENTRY_CACHE_BATCH);
+    e = ec->ec_list;
+    ec->ec_list = e->e_private;
+    ec->ec_count--;
+    e->e_private = NULL;
+    return e;
+  }
+
   ldap_pvt_thread_mutex_lock(&entry_mutex);
   if (!entry_list)
     entry_prealloc(CHUNK_SIZE);
   e = entry_list;
   entry_list = e->e_private;
+  entry_stats.fs_free--;
   e->e_private = NULL;
   ldap_pvt_thread_mutex_unlock(&entry_mutex);
 
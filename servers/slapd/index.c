@@ -25,7 +25,8 @@
 
 static slap_verbmasks idxstr[] = {
     {BER_BVC("pres"), SLAP_INDEX_PRESENT},          {BER_BVC("eq"), SLAP_INDEX_EQUALITY},
-    {BER_BVC("approx"), SLAP_INDEX_APPROX},         {BER_BVC("subinitial"), SLAP_INDEX_SUBSTR_INITIAL},
+    {BER_BVC("approx"), SLAP_INDEX_APPROX},         {BER_BVC("ordered"), SLAP_INDEX_ORDERED},
+    {BER_BVC("ngram"), SLAP_INDEX_NGRAM},           {BER_BVC("subinitial"), SLAP_INDEX_SUBSTR_INITIAL},
     {BER_BVC("subany"), SLAP_INDEX_SUBSTR_ANY},     {BER_BVC("subfinal"), SLAP_INDEX_SUBSTR_FINAL},
     {BER_BVC("sub"), SLAP_INDEX_SUBSTR_DEFAULT},    {BER_BVC("substr"), 0},
     {BER_BVC("notags"), SLAP_INDEX_NOTAGS},         {BER_BVC("nolang"), 0}, /* backwards compat */
@@ -55,6 +55,10 @@ ldap_pvt_thread_pool_t connection_pool;
 int connection_pool_max = SLAP_MAX_WORKER_THREADS;
 int connection_pool_queues = 1;
 int slap_tool_thread_max = 1;
+#ifdef WITH_TLS
+ldap_pvt_thread_pool_t tls_handshake_pool;
+int tls_handshake_pool_max = 0; /* handshakes run on connection_pool */
+#endif
 
 slap_counters_t slap_counters, *slap_counters_list;
 
@@ -112,12 +116,16 @@ int slap_init(int mode, const char *name) {
     slap_name = name;
 
     ldap_pvt_thread_pool_init_q(&connection_pool, connection_pool_max, 0, connection_pool_queues);
+#ifdef WITH_TLS
+    ldap_pvt_thread_pool_init(&tls_handshake_pool, tls_handshake_pool_max, 0);
+#endif
 
     slap_counters_init(&slap_counters);
 
     ldap_pvt_thread_mutex_init(&slapd_rq.rq_mutex);
     LDAP_STAILQ_INIT(&slapd_rq.task_list);
     LDAP_STAILQ_INIT(&slapd_rq.run_list);
+    slap_write_batch_init();
 
     slap_passwd_init();
 
@@ -182,6 +190,9 @@ int slap_shutdown(Backend *be) {
 
   /* Make sure the pool stops now even if we did not start up fully */
   ldap_pvt_thread_pool_close(&connection_pool, 1);
+#ifdef WITH_TLS
+  ldap_pvt_thread_pool_close(&tls_handshake_pool, 1);
+#endif
 
   /* let backends do whatever cleanup they need to do */
   return backend_shutdown(be);
@@ -197,6 +208,9 @@ int slap_destroy(void) {
   }
 
   ldap_pvt_thread_pool_free(&connection_pool);
+#ifdef WITH_TLS
+  ldap_pvt_thread_pool_free(&tls_handshake_pool);
+#endif
 
   /* clear out any thread-keys for the main thread */
   ldap_pvt_thread_pool_context_reset(ldap_pvt_thread_pool_context());
@@ -214,6 +228,7 @@ int slap_destroy(void) {
   case SLAP_SERVER_MODE:
   case SLAP_TOOL_MODE:
     slap_counters_destroy(&slap_counters);
+    slap_write_batch_destroy();
     break;
 
   default:
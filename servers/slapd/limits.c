@@ -173,6 +173,26 @@ static int limits_get(Operation *op, struct slap_limits_set **limit) {
   return (0);
 }
 
+/*
+ * Weight of identity ndn for weighted-queue, as given by the global
+ * (frontend) limits.  Only the anonymous identity may be looked up
+ * outside of an operation, group patterns need a backend access.
+ */
+int limits_weight(Operation *op, struct berval *ndn) {
+  Operation op2 = *op;
+  struct slap_limits_set *lms;
+
+  op2.o_bd = frontendDB;
+  op2.o_ndn = *ndn;
+  BER_BVZERO(&op2.o_req_ndn);
+  op2.o_groups = NULL;
+
+  (void)limits_get(&op2, &lms);
+  slap_op_groups_free(&op2);
+
+  return lms->lms_weight > 0 ? lms->lms_weight : 1;
+}
+
 static int limits_add(Backend *be, unsigned flags, const char *pattern, ObjectClass *group_oc,
                       AttributeDescription *group_ad, struct slap_limits_set *limit) {
   int i;
@@ -782,6 +802,12 @@ int limits_parse_one(const char *arg, struct slap_limits_set *limit) {
     } else {
       return (1);
     }
+
+  } else if (STRSTART(arg, "weight=")) {
+    arg += STRLENOF("weight=");
+    if (lutil_atoi(&limit->lms_weight, arg) != 0 || limit->lms_weight < 1) {
+      return (1);
+    }
   }
 
   return 0;
@@ -845,6 +871,12 @@ int limits_unparse(struct slap_limits *lim, struct berval *bv, ber_len_t buflen)
     if (rc == 0)
       bv->bv_len += btmp.bv_len;
   }
+  if (rc == 0 && lim->lm_limits.lms_weight) {
+    ptr = bv->bv_val + bv->bv_len;
+    rc = ptr_APPEND_FMT1(" weight=%d", lim->lm_limits.lms_weight);
+    if (rc == 0)
+      bv->bv_len = ptr - bv->bv_val;
+  }
   return rc;
 }
 
@@ -118,6 +118,40 @@ static int slapd_opt_slp(const char *val, void *arg) {
 #endif
 }
 
+static int slapd_opt_reuseport(const char *val, void *arg) {
+  if (val == NULL || strcasecmp(val, "on") == 0) {
+#ifdef SO_REUSEPORT
+    slapd_listener_reuseport = 1;
+#else
+    fputs("slapd: SO_REUSEPORT is not available\n", stderr);
+#endif
+  } else if (strcasecmp(val, "off") == 0) {
+    slapd_listener_reuseport = 0;
+  } else {
+    fprintf(stderr, "unrecognized value \"%s\" for listener-reuseport option\n", val);
+    return -1;
+  }
+
+  return 0;
+}
+
+static int slapd_opt_iouring(const char *val, void *arg) {
+  if (val == NULL || strcasecmp(val, "on") == 0) {
+#ifdef SLAPD_IOURING
+    slapd_iouring = 1;
+#else
+    fputs("slapd: io_uring support is not available\n", stderr);
+#endif
+  } else if (strcasecmp(val, "off") == 0) {
+    slapd_iouring = 0;
+  } else {
+    fprintf(stderr, "unrecognized value \"%s\" for iouring option\n", val);
+    return -1;
+  }
+
+  return 0;
+}
+
 /*
  * Option helper structure:
  *
@@ -137,6 +171,10 @@ struct option_helper {
   void *oh_arg;
   const char *oh_usage;
 } option_helpers[] = {{BER_BVC("slp"), slapd_opt_slp, NULL, "slp[={on|off|(attrs)}] enable/disable SLP using (attrs)"},
+                      {BER_BVC("listener-reuseport"), slapd_opt_reuseport, NULL,
+                       "listener-reuseport[={on|off}] open one SO_REUSEPORT socket per listener thread"},
+                      {BER_BVC("iouring"), slapd_opt_iouring, NULL,
+                       "iouring[={on|off}] use io_uring in the event loop"},
                       {BER_BVNULL, 0, NULL, NULL}};
 
 #ifdef LDAP_SYSLOG
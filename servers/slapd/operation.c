@@ -32,12 +32,44 @@ void slap_op_init(void) {}
 
 void slap_op_destroy(void) {}
 
-static void slap_op_q_destroy(void *key, void *data) {
+/* Per-thread cache of recycled operations. Operations freed by a pool
+ * thread are kept here already reset, so the next slap_op_alloc() on
+ * that thread neither touches the heap nor looks up a pool key. */
+#define SLAP_OP_CACHE_MAX 16
+
+typedef struct slap_op_cache {
+  Operation *oc_list;
+  int oc_count;
+} slap_op_cache;
+static __thread slap_op_cache *slap_op_tcache;
+
+/* pool key destructor, runs on the exiting thread */
+static void slap_op_cache_free(void *key, void *data) {
+  slap_op_cache *oc = data;
   Operation *op, *op2;
-  for (op = data; op; op = op2) {
+
+  for (op = oc->oc_list; op; op = op2) {
     op2 = LDAP_STAILQ_NEXT(op, o_next);
     ber_memfree_x(op, NULL);
   }
+  if (slap_op_tcache == oc)
+    slap_op_tcache = NULL;
+  ch_free(oc);
+}
+
+static slap_op_cache *slap_op_cache_get(void *ctx) {
+  slap_op_cache *oc = slap_op_tcache;
+
+  if (likely(oc != NULL))
+    return oc;
+
+  oc = ch_calloc(1, sizeof(slap_op_cache));
+  if (ldap_pvt_thread_pool_setkey(ctx, (void *)slap_op_free, oc, slap_op_cache_free, NULL, NULL)) {
+    ch_free(oc);
+    return NULL;
+  }
+  slap_op_tcache = oc;
+  return oc;
 }
 
 void slap_op_groups_free(Operation *op) {
@@ -51,6 +83,8 @@ void slap_op_groups_free(Operation *op) {
 
 void slap_op_free(Operation *op, void *ctx) {
   OperationBuffer *opbuf;
+  slap_op_cache *oc;
+  int ctrls_parsed;
 
   assert(op->o_conn == NULL);
   assert(LDAP_STAILQ_NEXT(op, o_next) == NULL);
@@ -96,36 +130,36 @@ void slap_op_free(Operation *op, void *ctx) {
     op->o_tmpfree(op->o_pagedresults_state, op->o_tmpmemctx);
   }
 
+  if (!ctx || (oc = slap_op_cache_get(ctx)) == NULL || oc->oc_count >= SLAP_OP_CACHE_MAX) {
+    ber_memfree_x(op, NULL);
+    return;
+  }
+
   /* Selectively zero out the struct. Ignore fields that will
    * get explicitly initialized later anyway. Keep o_abandon intact.
+   * The log prefix is rewritten by connection_init_log_prefix() for
+   * every queued op, and o_controls[] slots are only filled by control
+   * parsers, so both are cleared only as far as needed.
    */
   opbuf = (OperationBuffer *)op;
+  ctrls_parsed = op->o_ctrls_parsed;
   op->o_bd = NULL;
   BER_BVZERO(&op->o_req_dn);
   BER_BVZERO(&op->o_req_ndn);
-  memset(op->o_hdr, 0, sizeof(*op->o_hdr));
+  memset(op->o_hdr, 0, offsetof(Opheader, oh_log_prefix));
+  op->o_log_prefix[0] = '\0';
+#ifdef LDAP_SLAPI
+  op->o_hdr->oh_extensions = NULL;
+#endif
   memset(&op->o_request, 0, sizeof(op->o_request));
   memset(&op->o_do_not_cache, 0, sizeof(Operation) - offsetof(Operation, o_do_not_cache));
-  memset(opbuf->ob_controls, 0, sizeof(opbuf->ob_controls));
+  if (ctrls_parsed)
+    memset(opbuf->ob_controls, 0, sizeof(opbuf->ob_controls));
   op->o_controls = opbuf->ob_controls;
 
-  if (ctx) {
-    Operation *op2 = NULL;
-    ldap_pvt_thread_pool_setkey(ctx, (void *)slap_op_free, op, slap_op_q_destroy, (void **)&op2, NULL);
-    LDAP_STAILQ_NEXT(op, o_next) = op2;
-    if (op2) {
-      op->o_tincr = op2->o_tincr + 1;
-      /* No more than 10 ops on per-thread free list */
-      if (op->o_tincr > 10) {
-        ldap_pvt_thread_pool_setkey(ctx, (void *)slap_op_free, op2, slap_op_q_destroy, NULL, NULL);
-        ber_memfree_x(op, NULL);
-      }
-    } else {
-      op->o_tincr = 1;
-    }
-  } else {
-    ber_memfree_x(op, NULL);
-  }
+  LDAP_STAILQ_NEXT(op, o_next) = oc->oc_list;
+  oc->oc_list = op;
+  oc->oc_count++;
 }
 
 void slap_op_time(time_t *t, int *nop) {
@@ -141,12 +175,12 @@ Operation *slap_op_alloc(BerElement *ber, ber_int_t msgid, ber_tag_t tag, ber_in
   Operation *op = NULL;
 
   if (ctx) {
-    void *otmp = NULL;
-    ldap_pvt_thread_pool_getkey(ctx, (void *)slap_op_free, &otmp, NULL);
-    if (otmp) {
-      op = otmp;
-      otmp = LDAP_STAILQ_NEXT(op, o_next);
-      ldap_pvt_thread_pool_setkey(ctx, (void *)slap_op_free, otmp, slap_op_q_destroy, NULL, NULL);
+    slap_op_cache *oc = slap_op_tcache;
+    if (oc && oc->oc_list) {
+      op = oc->oc_list;
+      oc->oc_list = LDAP_STAILQ_NEXT(op, o_next);
+      oc->oc_count--;
+      LDAP_STAILQ_NEXT(op, o_next) = NULL;
       slap_set_op_abandon(op, 0);
       slap_set_op_cancel(op, 0);
     }
@@ -1435,13 +1435,13 @@ static void free_query(CachedQuery *qc) {
   ldap_pvt_thread_mutex_destroy(&qc->answerable_cnt_mutex);
   ldap_pvt_thread_rdwr_destroy(&qc->rwlock);
   memset(qc, 0, sizeof(*qc));
-  free(qc);
+  ch_free_tag(qc);
 }
 
 /* Add query to query cache, the returned Query is locked for writing */
 static CachedQuery *add_query(Operation *op, query_manager *qm, Query *query, QueryTemplate *templ,
                               pc_caching_reason_t why, int wlock) {
-  CachedQuery *new_cached_query = (CachedQuery *)ch_malloc(sizeof(CachedQuery));
+  CachedQuery *new_cached_query = (CachedQuery *)ch_malloc_tag(sizeof(CachedQuery), SLAP_MEM_PCACHE);
   Qbase *qbase, qb;
   Filter *first;
   int rc;
@@ -1527,7 +1527,7 @@ static CachedQuery *add_query(Operation *op, query_manager *qm, Query *query, Qu
     if (wlock)
       ldap_pvt_thread_rdwr_wunlock(&new_cached_query->rwlock);
     ldap_pvt_thread_rdwr_destroy(&new_cached_query->rwlock);
-    ch_free(new_cached_query);
+    ch_free_tag(new_cached_query);
     new_cached_query = find_filter(op, qbase->scopes[query->scope], query->filter, first);
     filter_free(query->filter);
     query->filter = NULL;
@@ -111,6 +111,12 @@ typedef struct sort_op {
   int so_vlv_target;
   int so_session;
   size_t so_vcontext;
+  SortedSearch *so_ss; /* the sort handed down to the database */
+  char so_indexed;     /* the database sends the pages in order */
+  char so_more;
+  int so_sent;  /* the entries of the pages so far */
+  ID so_after; /* the last one of them */
+  struct berval so_after_val; /* and the value it sorted by */
 } sort_op;
 
 /* There is only one conn table for all overlay instances */
@@ -226,6 +232,12 @@ static int pack_vlv_response_control(Operation *op, SlapReply *rs, sort_op *so,
   return rs->sr_err;
 }
 
+/* The cookie of the next page, the session itself if the database
+ * sends the pages */
+static PagedResultsCookie so_cookie(sort_op *so) {
+  return so->so_indexed ? (PagedResultsCookie)so : (PagedResultsCookie)so->so_tree;
+}
+
 static int pack_pagedresult_response_control(Operation *op, SlapReply *rs, sort_op *so, LDAPControl **ctrlsp) {
   LDAPControl *ctrl;
   BerElementBuffer berbuf;
@@ -237,8 +249,8 @@ static int pack_pagedresult_response_control(Operation *op, SlapReply *rs, sort_
   ber_init2(ber, NULL, LBER_USE_DER);
   ber_set_option(ber, LBER_OPT_BER_MEMCTX, &op->o_tmpmemctx);
 
-  if (so->so_nentries > 0) {
-    resp_cookie = (PagedResultsCookie)so->so_tree;
+  if (so->so_nentries > 0 || so->so_more) {
+    resp_cookie = so_cookie(so);
     cookie.bv_len = sizeof(PagedResultsCookie);
     cookie.bv_val = (char *)&resp_cookie;
   } else {
@@ -331,7 +343,7 @@ static int find_session_by_context(int svi_max_percon, int conn_id, size_t vc_co
   for (sess_id = 0; sess_id < svi_max_percon; sess_id++) {
     if (sort_conns[conn_id] && sort_conns[conn_id][sess_id] &&
         (sort_conns[conn_id][sess_id]->so_vcontext == vc_context ||
-         (PagedResultsCookie)sort_conns[conn_id][sess_id]->so_tree == ps_cookie))
+         so_cookie(sort_conns[conn_id][sess_id]) == ps_cookie))
       return sess_id;
   }
   return -1;
@@ -372,16 +384,17 @@ static void free_sort_op(Connection *conn, sort_op *so) {
       TAvlnode *cur_node = so->so_tree;
       while (cur_node) {
         TAvlnode *next_node = tavl_next(cur_node, TAVL_DIR_RIGHT);
-        ch_free(cur_node->avl_data);
+        ch_free_tag(cur_node->avl_data);
         ber_memfree(cur_node);
 
         cur_node = next_node;
       }
     } else {
-      tavl_free(so->so_tree, ch_free);
+      tavl_free(so->so_tree, ch_free_tag);
     }
     so->so_tree = NULL;
   }
+  ber_memfree(so->so_after_val.bv_val);
 
   ch_free(so);
 }
@@ -569,7 +582,7 @@ static void send_page(Operation *op, SlapReply *rs, sort_op *so) {
     e = NULL;
     rc = be_entry_get_rw(op, &sn->sn_dn, NULL, NULL, 0, &e);
 
-    ch_free(cur_node->avl_data);
+    ch_free_tag(cur_node->avl_data);
     ber_memfree(cur_node);
 
     cur_node = next_node;
@@ -619,6 +632,17 @@ static void send_entry(Operation *op, SlapReply *rs, sort_op *so) {
         so->so_page_size = so->so_nentries;
       }
 
+      /* the database sent the first pages, then left it to us */
+      for (; so->so_sent > 0 && so->so_tree; so->so_sent--) {
+        TAvlnode *next_node = tavl_next(so->so_tree, TAVL_DIR_RIGHT);
+        ch_free_tag(so->so_tree->avl_data);
+        ber_memfree(so->so_tree);
+        so->so_tree = next_node;
+        so->so_nentries--;
+      }
+      if (so->so_tree)
+        so->so_tree->avl_left = NULL;
+
       send_page(op, rs, so);
     }
   }
@@ -644,14 +668,112 @@ static void send_result(Operation *op, SlapReply *rs, sort_op *so) {
 
   if (ctrls[0] != NULL)
     slap_add_ctrls(op, rs, ctrls);
-  send_ldap_result(op, rs);
 
-  if (so->so_tree == NULL) {
+  /* Release the session before the client sees the result,
+   * it may ask for the next page right away */
+  if (so->so_tree == NULL && !so->so_more) {
     /* Search finished, so clean up */
     free_sort_op(op->o_conn, so);
   } else {
     so->so_running = 0;
   }
+  send_ldap_result(op, rs);
+}
+
+/* Hand a single key sort down to the database, which sends the entries
+ * in order if it has an index for that, see SortedSearch. */
+static void sort_delegate(Operation *op, sort_op *so, vlv_ctrl *vc) {
+  sort_ctrl *sc = so->so_ctrl;
+  MatchingRule *mr = sc->sc_keys[0].sk_ordering;
+  SortedSearch *ss;
+
+  if (sc->sc_nkeys != 1 || SLAP_GLUE_INSTANCE(op->o_bd))
+    return;
+
+  ss = op->o_tmpcalloc(1, sizeof(SortedSearch), op->o_tmpmemctx);
+  if (vc) {
+    if (!BER_BVISNULL(&vc->vc_value)) {
+      if (!mr->smr_normalize) {
+        ber_dupbv_x(&ss->ss_vlv_value, &vc->vc_value, op->o_tmpmemctx);
+      } else if (mr->smr_normalize(SLAP_MR_VALUE_OF_SYNTAX, mr->smr_syntax, mr, &vc->vc_value, &ss->ss_vlv_value,
+                                   op->o_tmpmemctx)) {
+        /* let send_list() tell about it */
+        op->o_tmpfree(ss, op->o_tmpmemctx);
+        return;
+      }
+    }
+    ss->ss_vlv = 1;
+    ss->ss_vlv_before = vc->vc_before;
+    ss->ss_vlv_after = vc->vc_after;
+    ss->ss_vlv_offset = vc->vc_offset;
+    ss->ss_vlv_count = vc->vc_count;
+  } else if (so->so_paged > SLAP_CONTROL_IGNORED) {
+    ss->ss_after = so->so_after;
+    if (!BER_BVISNULL(&so->so_after_val))
+      ber_dupbv_x(&ss->ss_after_val, &so->so_after_val, op->o_tmpmemctx);
+    ss->ss_offset = so->so_sent;
+    ss->ss_size = so->so_page_size;
+  }
+  ss->ss_oe.oe_key = (void *)slap_sorted_search;
+  ss->ss_op = op;
+  ss->ss_private = op->o_bd->be_private;
+  ss->ss_ad = sc->sc_keys[0].sk_ad;
+  ss->ss_ordering = mr;
+  ss->ss_reverse = sc->sc_keys[0].sk_direction < 0;
+  LDAP_SLIST_INSERT_HEAD(&op->o_extra, &ss->ss_oe, oe_next);
+  so->so_ss = ss;
+}
+
+/* Take back the sort handed down, return whether it was served */
+static int sort_undelegate(Operation *op, SlapReply *rs, sort_op *so) {
+  SortedSearch *ss = so->so_ss;
+  int served;
+
+  if (!ss)
+    return 0;
+
+  LDAP_SLIST_REMOVE(&op->o_extra, &ss->ss_oe, OpExtra, oe_next);
+  so->so_ss = NULL;
+  served = ss->ss_served;
+  so->so_more = 0;
+  if (served) {
+    if (ss->ss_vlv) {
+      /* keep the session for the next window, as send_list() does */
+      so->so_indexed = 1;
+      so->so_more = 1;
+      so->so_nentries = ss->ss_nentries;
+      so->so_vlv_rc = LDAP_SUCCESS;
+      if (!ss->ss_range) {
+        so->so_vlv_target = ss->ss_target;
+      } else {
+        /* the same as send_list() does, which keeps the target
+         * of the previous window */
+        LDAPControl *ctrls[2];
+        so->so_vlv_rc = LDAP_VLV_RANGE_ERROR;
+        pack_vlv_response_control(op, rs, so, ctrls);
+        ctrls[1] = NULL;
+        slap_add_ctrls(op, rs, ctrls);
+        rs->sr_err = LDAP_VLV_ERROR;
+      }
+    } else if (ss->ss_more) {
+      so->so_indexed = 1;
+      so->so_more = 1;
+      so->so_sent += ss->ss_size;
+      so->so_after = ss->ss_after;
+      ber_memfree(so->so_after_val.bv_val);
+      BER_BVZERO(&so->so_after_val);
+      if (!BER_BVISNULL(&ss->ss_after_val))
+        ber_dupbv(&so->so_after_val, &ss->ss_after_val);
+    }
+  } else {
+    so->so_indexed = 0;
+  }
+  if (!BER_BVISNULL(&ss->ss_vlv_value))
+    op->o_tmpfree(ss->ss_vlv_value.bv_val, op->o_tmpmemctx);
+  if (!BER_BVISNULL(&ss->ss_after_val))
+    op->o_tmpfree(ss->ss_after_val.bv_val, op->o_tmpmemctx);
+  op->o_tmpfree(ss, op->o_tmpmemctx);
+  return served;
 }
 
 static int sssvlv_op_response(Operation *op, SlapReply *rs) {
@@ -659,6 +781,10 @@ static int sssvlv_op_response(Operation *op, SlapReply *rs) {
   sort_op *so = op->o_callback->sc_private;
 
   if (rs->sr_type == REP_SEARCH) {
+    /* already in order */
+    if (so->so_ss && so->so_ss->ss_served)
+      return SLAP_CB_CONTINUE;
+
     int i;
     size_t len;
     sort_node *sn, *sn2;
@@ -686,7 +812,7 @@ static int sssvlv_op_response(Operation *op, SlapReply *rs) {
     }
 
     /* Now dup into regular memory */
-    sn2 = ch_malloc(len);
+    sn2 = ch_malloc_tag(len, SLAP_MEM_SSSVLV);
     sn2->sn_vals = (struct berval *)(sn2 + 1);
     memcpy(sn2->sn_vals, sn->sn_vals, sc->sc_nkeys * sizeof(struct berval));
 
@@ -731,13 +857,24 @@ static int sssvlv_op_response(Operation *op, SlapReply *rs) {
       scp = &(*scp)->sc_next;
     }
 
-    send_entry(op, rs, so);
+    if (!sort_undelegate(op, rs, so))
+      send_entry(op, rs, so);
     send_result(op, rs, so);
   }
 
   return rs->sr_err;
 }
 
+static slap_callback *sort_callback(Operation *op, sort_op *so) {
+  slap_callback *cb = op->o_tmpcalloc(1, sizeof(slap_callback), op->o_tmpmemctx);
+  LDAP_ENSURE(cb != NULL); /* FIXME: LDAP_OTHER */
+
+  cb->sc_response = sssvlv_op_response;
+  cb->sc_next = op->o_callback;
+  cb->sc_private = so;
+  return cb;
+}
+
 static int sssvlv_op_search(Operation *op, SlapReply *rs) {
   slap_overinst *on = (slap_overinst *)op->o_bd->bd_info;
   sssvlv_info *si = on->on_bi.bi_private;
@@ -855,28 +992,41 @@ static int sssvlv_op_search(Operation *op, SlapReply *rs) {
     if (so && vc && vc->vc_context) {
       assert(need_unlock == 0);
       so->so_ctrl = sc;
-      send_list(op, rs, so);
-      send_result(op, rs, so);
-      rc = LDAP_SUCCESS;
+      if (so->so_indexed) {
+        /* the database sends the next window too */
+        so->so_nentries = 0;
+        op->o_callback = sort_callback(op, so);
+        sort_delegate(op, so, vc);
+        rc = SLAP_CB_CONTINUE;
+      } else {
+        send_list(op, rs, so);
+        send_result(op, rs, so);
+        rc = LDAP_SUCCESS;
+      }
       /* are we continuing a paged search? */
     } else if (so && ps && ps->ps_cookie) {
       assert(need_unlock == 0);
       so->so_ctrl = sc;
-      send_page(op, rs, so);
-      send_result(op, rs, so);
-      rc = LDAP_SUCCESS;
+      if (so->so_indexed) {
+        /* the database sends the next page too */
+        so->so_page_size = ps->ps_size;
+        op->o_pagedresults = SLAP_CONTROL_IGNORED;
+        op->o_callback = sort_callback(op, so);
+        sort_delegate(op, so, NULL);
+        rc = SLAP_CB_CONTINUE;
+      } else {
+        send_page(op, rs, so);
+        send_result(op, rs, so);
+        rc = LDAP_SUCCESS;
+      }
     } else {
       /* Install serversort response callback to handle a new search */
       assert(need_unlock != 0);
       assert(so == NULL);
 
       so = ch_calloc(1, sizeof(sort_op));
-      slap_callback *cb = op->o_tmpcalloc(1, sizeof(slap_callback), op->o_tmpmemctx);
-      LDAP_ENSURE(so != NULL && cb != NULL); /* FIXME: LDAP_OTHER */
-
-      cb->sc_response = sssvlv_op_response;
-      cb->sc_next = op->o_callback;
-      cb->sc_private = so;
+      LDAP_ENSURE(so != NULL); /* FIXME: LDAP_OTHER */
+      slap_callback *cb = sort_callback(op, so);
 
       assert(so->so_tree == NULL);
       so->so_ctrl = sc;
@@ -901,6 +1051,7 @@ static int sssvlv_op_search(Operation *op, SlapReply *rs) {
       so->so_vcontext = (size_t)so;
       assert(so->so_nentries == 0);
       op->o_callback = cb;
+      sort_delegate(op, so, vc);
 
       assert(sess_id >= 0);
       so->so_running = 1;
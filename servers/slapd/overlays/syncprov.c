@@ -1718,7 +1718,7 @@ static void syncprov_add_slog(Operation *op) {
       /* can only do this if no one else is reading the log at the moment */
       while ((se = sl->sl_head) != NULL) {
         sl->sl_head = se->se_next;
-        ch_free(se);
+        ch_free_tag(se);
       }
     }
     sl->sl_tail = NULL;
@@ -1728,7 +1728,7 @@ static void syncprov_add_slog(Operation *op) {
   }
 
   /* Allocate a record. UUIDs are not NUL-terminated. */
-  se = ch_malloc(sizeof(slog_entry) + opc->suuid.bv_len + op->o_csn.bv_len + 1);
+  se = ch_malloc_tag(sizeof(slog_entry) + opc->suuid.bv_len + op->o_csn.bv_len + 1, SLAP_MEM_SYNCPROV);
   se->se_next = NULL;
   se->se_tag = op->o_tag;
 
@@ -1784,7 +1784,7 @@ static void syncprov_add_slog(Operation *op) {
       } else if (slap_csn_compare_ts(&sl->sl_cookie.ctxcsn[i], &se->se_csn) < 0) {
         ber_bvreplace(&sl->sl_cookie.ctxcsn[i], &se->se_csn);
       }
-      ch_free(se);
+      ch_free_tag(se);
       sl->sl_num--;
     }
   }
@@ -3624,7 +3624,7 @@ static int syncprov_db_destroy(BackendDB *be, ConfigReply *cr) {
 
       while (se) {
         slog_entry *se_next = se->se_next;
-        ch_free(se);
+        ch_free_tag(se);
         se = se_next;
       }
       slap_cookie_free(&sl->sl_cookie, 0);
@@ -241,6 +241,7 @@ LDAP_SLAPD_F(void) comp_tree_free(Attribute *a);
 LDAP_SLAPD_F(Attribute *) attr_alloc(AttributeDescription *ad);
 LDAP_SLAPD_F(Attribute *) attrs_alloc(int num);
 LDAP_SLAPD_F(int) attr_prealloc(int num);
+LDAP_SLAPD_F(void) attr_freelist_stats(slap_freelist_stats *fs);
 LDAP_SLAPD_F(int)
 attr_valfind(Attribute *a, unsigned flags, struct berval *val, unsigned *slot, void *ctx);
 LDAP_SLAPD_F(int)
@@ -439,6 +440,12 @@ LDAP_SLAPD_F(void *) ch_realloc(void *block, ber_len_t size);
 LDAP_SLAPD_F(void *) ch_calloc(ber_len_t nelem, ber_len_t size);
 LDAP_SLAPD_F(char *) ch_strdup(const char *string);
 LDAP_SLAPD_F(void) ch_free(void *);
+LDAP_SLAPD_F(void *) ch_malloc_tag(ber_len_t size, slap_mem_tag tag);
+LDAP_SLAPD_F(void *) ch_calloc_tag(ber_len_t nelem, ber_len_t size, slap_mem_tag tag);
+LDAP_SLAPD_F(void) ch_free_tag(void *ptr);
+LDAP_SLAPD_F(void) slap_mem_charge(slap_mem_tag tag, ber_len_t size);
+LDAP_SLAPD_F(void) slap_mem_uncharge(slap_mem_tag tag, ber_len_t size);
+LDAP_SLAPD_F(void) slap_mem_stats_get(slap_mem_tag tag, slap_mem_stats *ms);
 
 #ifndef CH_FREE
 #undef free
@@ -550,6 +557,7 @@ LDAP_SLAPD_F(int) slap_find_control_id(const char *oid, int *cid);
 LDAP_SLAPD_F(int) slap_global_control(Operation *op, const char *oid, int *cid);
 LDAP_SLAPD_F(int)
 slap_remove_control(Operation *op, SlapReply *rs, int ctrl, BI_chk_controls fnc);
+LDAP_SLAPD_F(SortedSearch *) slap_sorted_search(Operation *op);
 
 #ifdef SLAP_CONTROL_X_SESSION_TRACKING
 LDAP_SLAPD_F(int)
@@ -637,9 +645,11 @@ connection_state2str(int state) __attribute__((const));
 int connections_socket_trouble(ber_socket_t s);
 
 LDAP_SLAPD_F(int) connection_read_activate(ber_socket_t s);
+LDAP_SLAPD_F(int) connection_read_inline(ber_socket_t s, void *ctx);
 LDAP_SLAPD_F(int) connection_write(ber_socket_t s);
 
 LDAP_SLAPD_F(void) connection_op_finish(Operation *op);
+LDAP_SLAPD_F(void) connection_write_done(Connection *c);
 
 LDAP_SLAPD_F(unsigned long) connections_nextid(void);
 
@@ -726,6 +736,7 @@ LDAP_SLAPD_F(int) slapd_daemon(void);
 LDAP_SLAPD_F(Listener **) slapd_get_listeners(void);
 LDAP_SLAPD_F(void)
 slapd_remove(ber_socket_t s, Sockbuf *sb, int wasactive, int wake, int locked);
+LDAP_SLAPD_F(Sockbuf_IO *) slapd_sockbuf_io(ber_socket_t s);
 
 LDAP_SLAPD_F(void) slap_sig_shutdown(int sig);
 LDAP_SLAPD_F(void) slap_sig_wake(int sig);
@@ -786,6 +797,8 @@ LDAP_SLAPD_V(slap_ssf_t) local_ssf;
 LDAP_SLAPD_V(struct runqueue_s) slapd_rq;
 LDAP_SLAPD_V(int) slapd_daemon_threads;
 LDAP_SLAPD_V(int) slapd_daemon_mask;
+LDAP_SLAPD_V(int) slapd_listener_reuseport;
+LDAP_SLAPD_V(int) slapd_iouring;
 #ifdef LDAP_TCP_BUFFER
 LDAP_SLAPD_V(int) slapd_tcp_rmem;
 LDAP_SLAPD_V(int) slapd_tcp_wmem;
@@ -892,6 +905,7 @@ LDAP_SLAPD_F(Entry *) entry_dup2(Entry *dest, Entry *src);
 LDAP_SLAPD_F(Entry *) entry_dup_bv(Entry *e);
 LDAP_SLAPD_F(Entry *) entry_alloc(void);
 LDAP_SLAPD_F(int) entry_prealloc(int num);
+LDAP_SLAPD_F(void) entry_freelist_stats(slap_freelist_stats *fs);
 
 /*
  * extended.c
@@ -1087,6 +1101,7 @@ limits_parse(Backend *be, const char *fname, int lineno, int argc, char **argv);
 LDAP_SLAPD_F(int)
 limits_parse_one(const char *arg, struct slap_limits_set *limit);
 LDAP_SLAPD_F(int) limits_check(Operation *op, SlapReply *rs);
+LDAP_SLAPD_F(int) limits_weight(Operation *op, struct berval *ndn);
 LDAP_SLAPD_F(int)
 limits_unparse_one(struct slap_limits_set *limit, int which, struct berval *bv, ber_len_t buflen);
 LDAP_SLAPD_F(int)
@@ -1399,6 +1414,12 @@ LDAP_SLAPD_F(void) slap_send_ldap_intermediate(Operation *op, SlapReply *rs);
 LDAP_SLAPD_F(void) slap_send_search_result(Operation *op, SlapReply *rs);
 LDAP_SLAPD_F(int) slap_send_search_reference(Operation *op, SlapReply *rs);
 LDAP_SLAPD_F(int) slap_send_search_entry(Operation *op, SlapReply *rs);
+LDAP_SLAPD_F(void) slap_write_batch_init(void);
+LDAP_SLAPD_F(void) slap_write_batch_destroy(void);
+LDAP_SLAPD_F(int) slap_write_batch_begin(Operation *op);
+LDAP_SLAPD_F(void) slap_write_batch_end(Operation *op);
+LDAP_SLAPD_F(int) slap_write_inline_begin(void *ctx, Operation *op);
+LDAP_SLAPD_F(void) slap_write_inline_end(void *ctx);
 LDAP_SLAPD_F(int) slap_null_cb(Operation *op, SlapReply *rs);
 LDAP_SLAPD_F(int) slap_freeself_cb(Operation *op, SlapReply *rs);
 
@@ -1588,6 +1609,9 @@ slap_sl_mem_create(ber_len_t size, int stack, void *ctx, int flag);
 LDAP_SLAPD_F(void) slap_sl_mem_setctx(void *ctx, void *memctx);
 LDAP_SLAPD_F(void) slap_sl_mem_destroy(void *key, void *data);
 LDAP_SLAPD_F(void *) slap_sl_context(void *ptr);
+LDAP_SLAPD_F(void) slap_sl_mem_stats(slap_sl_stats *ss);
+LDAP_SLAPD_V(int) slap_sl_hugepages;
+LDAP_SLAPD_V(int) slap_sl_numa;
 
 /*
  * starttls.c
@@ -1700,6 +1724,12 @@ LDAP_SLAPD_V(int) slap_conn_max_pending_auth;
 
 LDAP_SLAPD_V(slap_mask_t) global_allows;
 LDAP_SLAPD_V(slap_mask_t) global_disallows;
+LDAP_SLAPD_V(slap_mask_t) global_inline_ops;
+LDAP_SLAPD_V(unsigned) global_inline_budget;
+LDAP_SLAPD_V(int) global_weighted_queue;
+LDAP_SLAPD_V(unsigned) global_admission_target;
+LDAP_SLAPD_V(unsigned) global_admission_interval;
+LDAP_SLAPD_V(slap_mask_t) global_admission_shed;
 
 LDAP_SLAPD_V(BerVarray) default_referral;
 LDAP_SLAPD_V(const char) SlapdVersionStr[];
@@ -1730,6 +1760,10 @@ LDAP_SLAPD_V(ldap_pvt_thread_pool_t) connection_pool;
 LDAP_SLAPD_V(int) connection_pool_max;
 LDAP_SLAPD_V(int) connection_pool_queues;
 LDAP_SLAPD_V(int) slap_tool_thread_max;
+#ifdef WITH_TLS
+LDAP_SLAPD_V(ldap_pvt_thread_pool_t) tls_handshake_pool;
+LDAP_SLAPD_V(int) tls_handshake_pool_max;
+#endif
 
 LDAP_SLAPD_V(ldap_pvt_thread_mutex_t) entry2str_mutex;
 
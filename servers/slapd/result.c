@@ -27,6 +27,7 @@
 #include <ac/unistd.h>
 
 #include "slap.h"
+#include "ldap_rq.h"
 
 #if SLAP_STATS_ETIME
 #define ETIME_SETUP                                                                                                    \
@@ -329,21 +330,19 @@ static void send_ldap_ber__update_counters(Operation *op, int bytes, enum counte
   ldap_pvt_thread_mutex_unlock(&op->o_counters->sc_mutex);
 }
 
-static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_update_mode crutch) {
-  Connection *conn = op->o_conn;
-  ber_len_t bytes;
-  long ret = -1;
-  char *close_reason;
-
-  ber_get_option(ber, LBER_OPT_BER_BYTES_TO_WRITE, &bytes);
-
+/* Waits for the turn to write on conn, returns with c_write1_mutex
+ * locked and c_writing set, or -1 if the output is not to be sent.
+ * op is NULL for output that outlived its operation, connid then
+ * tells whether conn is still the same connection */
+static int send_ldap_ber_turn(Connection *conn, unsigned long connid, Operation *op) {
   ldap_pvt_thread_mutex_lock(&conn->c_mutex);
   ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
 
-  if ((slap_get_op_abandon(op) && !slap_get_op_cancel(op)) || !connection_valid(conn) || conn->c_writers < 0) {
+  if ((op ? slap_get_op_abandon(op) && !slap_get_op_cancel(op) : conn->c_connid != connid) || !connection_valid(conn) ||
+      conn->c_writers < 0) {
     ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
     ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
-    return ret;
+    return -1;
   }
 
   conn->c_writers++;
@@ -363,11 +362,23 @@ static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_upd
       ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
     conn->c_writers++;
     ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
-    return ret;
+    return -1;
   }
 
   /* Our turn */
   conn->c_writing = 1;
+  return 0;
+}
+
+/* Writes out the PDU(s) in ber on our turn, then passes the turn on;
+ * crutch is NULL if the statistics are already updated by the caller */
+static long send_ldap_ber_write(Connection *conn, Operation *op, BerElement *ber,
+                                const enum counters_send_update_mode *crutch) {
+  ber_len_t bytes;
+  long ret = -1;
+  char *close_reason;
+
+  ber_get_option(ber, LBER_OPT_BER_BYTES_TO_WRITE, &bytes);
 
   /* write the pdu */
   while (conn->c_conn_state >= SLAP_C_ACTIVE) {
@@ -375,7 +386,8 @@ static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_upd
 
     if (ber_flush2(conn->c_sb, ber, LBER_FLUSH_FREE_NEVER) == 0) {
       ret = bytes;
-      send_ldap_ber__update_counters(op, bytes, crutch);
+      if (crutch)
+        send_ldap_ber__update_counters(op, bytes, *crutch);
       break;
     }
 
@@ -405,7 +417,8 @@ static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_upd
     conn->c_writewaiter = 1;
     ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
     ldap_pvt_thread_pool_idle(&connection_pool);
-    slap_writewait_play(op);
+    if (op)
+      slap_writewait_play(op);
     err = slapd_wait_writer(conn->c_sd);
     conn->c_writewaiter = 0;
     ldap_pvt_thread_pool_unidle(&connection_pool);
@@ -441,6 +454,534 @@ static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_upd
   return ret;
 }
 
+/* Writes out the PDU(s) in ber; crutch is NULL if the statistics are
+ * already updated by the caller */
+static long send_ldap_ber_flush(Operation *op, BerElement *ber, const enum counters_send_update_mode *crutch) {
+  if (send_ldap_ber_turn(op->o_conn, op->o_connid, op) != 0)
+    return -1;
+  return send_ldap_ber_write(op->o_conn, op, ber, crutch);
+}
+
+/* Search results are coalesced per thread: while the backend runs a
+ * search started by fe_op_search(), the PDUs of that operation are
+ * copied into one buffer of SLAP_WRITE_BATCH bytes, which is written
+ * out when the next PDU does not fit, once its first PDU is
+ * SLAP_WRITE_BATCH_DELAY milliseconds old, or together with any PDU
+ * other than an entry or a reference (e.g. the final result). The
+ * buffer is written by send_ldap_ber_flush(), so writetimeout and the
+ * writewait callbacks behave as before, only per batch instead of per
+ * entry. The statistics are updated when a PDU is queued, so that
+ * cn=Monitor does not lag behind a running search.
+ *
+ * A backend may take long to find the next entry, so the delay is also
+ * kept by slap_write_batch_timer() on slapd_rq: every
+ * SLAP_WRITE_BATCH_DELAY milliseconds while some batch holds PDUs, it
+ * writes out those that are due, as far as that goes without blocking.
+ * The rest of a batch it could only partly write is left to the thread
+ * of the search, together with the turn to write (c_writing).
+ *
+ * The output of a listener-inline operation is collected the same
+ * way, but whole, and written by slap_write_inline_end() without
+ * waiting: what cannot be written at once is left to connection_pool.
+ */
+#ifndef SLAP_WRITE_BATCH
+#define SLAP_WRITE_BATCH (64 * 1024)
+#endif
+#ifndef SLAP_WRITE_BATCH_DELAY
+#define SLAP_WRITE_BATCH_DELAY 10 /* milliseconds */
+#endif
+
+typedef struct slap_write_batch {
+  ldap_pvt_thread_mutex_t wb_mutex; /* against slap_write_batch_timer() */
+  Connection *wb_conn;              /* NULL when not batching */
+  unsigned long wb_connid;
+  ber_int_t wb_msgid;
+  int wb_inline;
+  int wb_partial; /* wb_ber is partly written, c_writing is set for it */
+  char *wb_buf;
+  ber_len_t wb_size;
+  ber_len_t wb_len;
+  slap_time_t wb_since;
+  BerElementBuffer wb_ber;
+  LDAP_SLIST_ENTRY(slap_write_batch) wb_next;
+} slap_write_batch;
+
+static ldap_pvt_thread_mutex_t slap_write_batch_mutex;
+static LDAP_SLIST_HEAD(, slap_write_batch) slap_write_batches = LDAP_SLIST_HEAD_INITIALIZER(&slap_write_batches);
+static struct re_s *slap_write_batch_task;
+static int slap_write_batch_rearm; /* a batch filled while the timer ran */
+
+/* The output of an inline operation left to connection_pool */
+typedef struct slap_write_pending {
+  Connection *wp_conn;
+  unsigned long wp_connid;
+  int wp_owned; /* partly written, c_writing is still set for it */
+  char *wp_buf;
+  BerElementBuffer wp_ber;
+} slap_write_pending;
+
+static void slap_write_batch_free(void *key, void *data) {
+  slap_write_batch *wb = data;
+
+  ldap_pvt_thread_mutex_lock(&slap_write_batch_mutex);
+  LDAP_SLIST_REMOVE(&slap_write_batches, wb, slap_write_batch, wb_next);
+  ldap_pvt_thread_mutex_unlock(&slap_write_batch_mutex);
+  ldap_pvt_thread_mutex_destroy(&wb->wb_mutex);
+  ch_free_tag(wb->wb_buf);
+  ch_free(wb);
+}
+
+static slap_write_batch *slap_write_batch_get(void *ctx) {
+  void *data = NULL;
+
+  if (ctx == NULL || ldap_pvt_thread_pool_getkey(ctx, (void *)slap_write_batch_begin, &data, NULL) != 0)
+    return NULL;
+  return data;
+}
+
+/* Makes room for len more bytes in the buffer */
+static void slap_write_batch_grow(slap_write_batch *wb, ber_len_t len) {
+  ber_len_t size = wb->wb_size ? wb->wb_size : SLAP_WRITE_BATCH;
+  char *buf;
+
+  if (wb->wb_buf != NULL && wb->wb_len + len <= wb->wb_size)
+    return;
+  while (size < wb->wb_len + len)
+    size *= 2;
+  buf = ch_malloc_tag(size, SLAP_MEM_CONN);
+  if (wb->wb_len)
+    memcpy(buf, wb->wb_buf, wb->wb_len);
+  ch_free_tag(wb->wb_buf);
+  wb->wb_buf = buf;
+  wb->wb_size = size;
+}
+
+static BerElement *slap_write_batch_ber(slap_write_batch *wb) {
+  BerElement *ber = (BerElement *)&wb->wb_ber;
+  struct berval bv;
+
+  bv.bv_val = wb->wb_buf;
+  bv.bv_len = wb->wb_len;
+  ber_init2(ber, &bv, LBER_USE_DER);
+  ber_set_option(ber, LBER_OPT_BER_BYTES_TO_WRITE, &bv.bv_len);
+  return ber;
+}
+
+/* Writes out the batch, waiting as needed; wb_mutex is locked */
+static long slap_write_batch_flush(Operation *op, slap_write_batch *wb) {
+  Connection *conn = wb->wb_conn;
+  long bytes = -1;
+
+  if (wb->wb_len == 0)
+    return 0;
+
+  if (!wb->wb_partial) {
+    bytes = send_ldap_ber_flush(op, slap_write_batch_ber(wb), NULL);
+    wb->wb_len = 0;
+    return bytes;
+  }
+
+  /* finish what the timer started, it left us the turn */
+  wb->wb_partial = 0;
+  wb->wb_len = 0;
+  ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+  ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
+  if (conn->c_writers >= 0 && conn->c_conn_state >= SLAP_C_ACTIVE) {
+    conn->c_writers++;
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    return send_ldap_ber_write(conn, op, (BerElement *)&wb->wb_ber, NULL);
+  }
+  conn->c_writing = 0;
+  ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+  ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+  ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+  return bytes;
+}
+
+/* Writes out what the socket takes of a batch that is due, without
+ * waiting for the turn or for the socket; wb_mutex is locked */
+static void slap_write_batch_try(slap_write_batch *wb) {
+  Connection *conn = wb->wb_conn;
+  int err;
+
+  ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+  ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
+  if (conn->c_connid != wb->wb_connid || !connection_valid(conn) || conn->c_writers != 0 || conn->c_writing) {
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    return;
+  }
+  conn->c_writing = 1;
+  ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+
+  if (ber_flush2(conn->c_sb, slap_write_batch_ber(wb), LBER_FLUSH_FREE_NEVER) == 0) {
+    Debug(LDAP_DEBUG_CONNS, "slap_write_batch_try: conn=%lu batch of %lu bytes written\n", wb->wb_connid,
+          (unsigned long)wb->wb_len);
+    wb->wb_len = 0;
+  } else if ((err = sock_errno()) == EWOULDBLOCK || err == EAGAIN) {
+    /* keep the turn, the rest of a PDU must come next */
+    Debug(LDAP_DEBUG_CONNS, "slap_write_batch_try: conn=%lu batch partly written, left to its thread\n",
+          wb->wb_connid);
+    wb->wb_partial = 1;
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    return;
+  } else {
+    Debug(LDAP_DEBUG_CONNS, "ber_flush2 failed errno=%d reason=\"%s\"\n", err, sock_errstr(err));
+    wb->wb_len = 0;
+    conn->c_writing = 0;
+    ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+    connection_closing(conn, "connection lost on write");
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    return;
+  }
+  conn->c_writing = 0;
+  ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+  ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+}
+
+static void *slap_write_batch_timer(void *ctx, void *arg) {
+  struct re_s *rtask = arg;
+  slap_write_batch *wb;
+  slap_time_t now = ldap_now_steady();
+  int held = 0;
+
+  ldap_pvt_thread_mutex_lock(&slap_write_batch_mutex);
+  LDAP_SLIST_FOREACH(wb, &slap_write_batches, wb_next) {
+    /* its thread is queuing or writing, look again next time */
+    if (ldap_pvt_thread_mutex_trylock(&wb->wb_mutex) != 0) {
+      held = 1;
+      continue;
+    }
+    if (wb->wb_conn != NULL && !wb->wb_inline && wb->wb_len != 0 && !wb->wb_partial) {
+      if (now.ns - wb->wb_since.ns >= SLAP_WRITE_BATCH_DELAY * (uint64_t)1000000)
+        slap_write_batch_try(wb);
+      if (wb->wb_len != 0 && !wb->wb_partial)
+        held = 1;
+    }
+    ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+  }
+  ldap_pvt_thread_mutex_unlock(&slap_write_batch_mutex);
+
+  ldap_pvt_thread_mutex_lock(&slapd_rq.rq_mutex);
+  if (ldap_pvt_runqueue_isrunning(&slapd_rq, rtask))
+    ldap_pvt_runqueue_stoptask(&slapd_rq, rtask);
+  /* stay idle until a batch holds PDUs again */
+  ldap_pvt_runqueue_resched(&slapd_rq, rtask, !held && !slap_write_batch_rearm);
+  slap_write_batch_rearm = 0;
+  ldap_pvt_thread_mutex_unlock(&slapd_rq.rq_mutex);
+  return NULL;
+}
+
+/* Has slap_write_batch_timer() look at the batches that hold PDUs */
+static void slap_write_batch_arm(void) {
+  slap_time_t delay = {SLAP_WRITE_BATCH_DELAY * (uint64_t)1000000};
+  int wake = 0;
+
+  ldap_pvt_thread_mutex_lock(&slapd_rq.rq_mutex);
+  if (slap_write_batch_task == NULL) {
+    slap_write_batch_task =
+        ldap_pvt_runqueue_insert_ns(&slapd_rq, delay, slap_write_batch_timer, NULL, "slap_write_batch_timer", "");
+    if (slap_write_batch_task != NULL) {
+      slap_write_batch_task->arg = slap_write_batch_task;
+      ldap_pvt_runqueue_resched(&slapd_rq, slap_write_batch_task, 0);
+      wake = 1;
+    }
+  } else if (ldap_pvt_runqueue_isrunning(&slapd_rq, slap_write_batch_task)) {
+    slap_write_batch_rearm = 1;
+  } else if (slap_write_batch_task->next_sched.ns == 0) {
+    ldap_pvt_runqueue_resched(&slapd_rq, slap_write_batch_task, 0);
+    wake = 1;
+  }
+  ldap_pvt_thread_mutex_unlock(&slapd_rq.rq_mutex);
+
+  /* the daemon may be sleeping without a timeout */
+  if (wake)
+    slap_wake_listener();
+}
+
+void slap_write_batch_init(void) { ldap_pvt_thread_mutex_init(&slap_write_batch_mutex); }
+
+void slap_write_batch_destroy(void) {
+  if (slap_write_batch_task != NULL) {
+    ldap_pvt_thread_mutex_lock(&slapd_rq.rq_mutex);
+    if (ldap_pvt_runqueue_isrunning(&slapd_rq, slap_write_batch_task))
+      ldap_pvt_runqueue_stoptask(&slapd_rq, slap_write_batch_task);
+    ldap_pvt_runqueue_remove(&slapd_rq, slap_write_batch_task);
+    slap_write_batch_task = NULL;
+    ldap_pvt_thread_mutex_unlock(&slapd_rq.rq_mutex);
+  }
+  ldap_pvt_thread_mutex_destroy(&slap_write_batch_mutex);
+}
+
+static slap_write_batch *slap_write_batch_start(void *ctx, Operation *op) {
+  slap_write_batch *wb;
+
+  if (ctx == NULL || op->o_conn == NULL)
+    return NULL;
+#ifdef LDAP_CONNECTIONLESS
+  if (op->o_conn->c_is_udp)
+    return NULL;
+#endif
+
+  wb = slap_write_batch_get(ctx);
+  if (wb == NULL) {
+    wb = ch_calloc(1, sizeof(slap_write_batch));
+    if (ldap_pvt_thread_pool_setkey(ctx, (void *)slap_write_batch_begin, wb, slap_write_batch_free, NULL, NULL) != 0) {
+      ch_free(wb);
+      return NULL;
+    }
+    ldap_pvt_thread_mutex_init(&wb->wb_mutex);
+    ldap_pvt_thread_mutex_lock(&slap_write_batch_mutex);
+    LDAP_SLIST_INSERT_HEAD(&slap_write_batches, wb, wb_next);
+    ldap_pvt_thread_mutex_unlock(&slap_write_batch_mutex);
+  }
+
+  /* a nested search is sent as is */
+  if (wb->wb_conn != NULL)
+    return NULL;
+
+  ldap_pvt_thread_mutex_lock(&wb->wb_mutex);
+  wb->wb_conn = op->o_conn;
+  wb->wb_connid = op->o_connid;
+  wb->wb_msgid = op->o_msgid;
+  ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+  return wb;
+}
+
+int slap_write_batch_begin(Operation *op) {
+  return slap_write_batch_start(op->o_threadctx, op) != NULL;
+}
+
+void slap_write_batch_end(Operation *op) {
+  slap_write_batch *wb = slap_write_batch_get(op->o_threadctx);
+
+  if (wb == NULL || wb->wb_conn == NULL)
+    return;
+
+  assert(wb->wb_conn == op->o_conn && wb->wb_msgid == op->o_msgid && !wb->wb_inline);
+  ldap_pvt_thread_mutex_lock(&wb->wb_mutex);
+  slap_write_batch_flush(op, wb);
+  wb->wb_conn = NULL;
+  ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+}
+
+/* Collects the output of op, which is about to run on the listener */
+int slap_write_inline_begin(void *ctx, Operation *op) {
+  slap_write_batch *wb = slap_write_batch_start(ctx, op);
+
+  if (wb == NULL)
+    return 0;
+  wb->wb_inline = 1;
+  return 1;
+}
+
+/* Writes out what wp holds on its connection_pool thread, waiting for
+ * the turn and for the socket as any other writer would */
+static void *slap_write_inline_thread(void *ctx, void *arg) {
+  slap_write_pending *wp = arg;
+  Connection *conn = wp->wp_conn;
+  BerElement *ber = (BerElement *)&wp->wp_ber;
+
+  if (!wp->wp_owned) {
+    if (send_ldap_ber_turn(conn, wp->wp_connid, NULL) == 0)
+      send_ldap_ber_write(conn, NULL, ber, NULL);
+    goto done;
+  }
+
+  /* c_writing kept conn from being closed, so it is still ours */
+  ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+  ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
+  if (conn->c_writers >= 0 && conn->c_conn_state >= SLAP_C_ACTIVE) {
+    conn->c_writers++;
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    send_ldap_ber_write(conn, NULL, ber, NULL);
+    ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+  } else {
+    /* the rest of a PDU is not worth sending to a closing connection */
+    conn->c_writing = 0;
+    ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+  }
+  /* the close was deferred while we were writing */
+  if (conn->c_connid == wp->wp_connid)
+    connection_write_done(conn);
+  ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+
+done:
+  ch_free_tag(wp->wp_buf);
+  ch_free(wp);
+  return NULL;
+}
+
+static void slap_write_inline_send(slap_write_batch *wb) {
+  slap_write_pending *wp;
+  Connection *conn;
+  BerElement *ber;
+  struct berval bv;
+  int err;
+
+  conn = wb->wb_conn;
+  wb->wb_conn = NULL;
+  wb->wb_inline = 0;
+  if (wb->wb_len == 0)
+    return;
+
+  wp = ch_calloc(1, sizeof(slap_write_pending));
+  wp->wp_conn = conn;
+  wp->wp_connid = wb->wb_connid;
+  ber = (BerElement *)&wp->wp_ber;
+  bv.bv_val = wb->wb_buf;
+  bv.bv_len = wb->wb_len;
+  ber_init2(ber, &bv, LBER_USE_DER);
+  ber_set_option(ber, LBER_OPT_BER_BYTES_TO_WRITE, &bv.bv_len);
+  wb->wb_len = 0;
+
+  ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+  ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
+  if (conn->c_connid != wp->wp_connid || !connection_valid(conn) || conn->c_writers < 0) {
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    ch_free(wp);
+    return;
+  }
+  if (conn->c_writing || conn->c_writers > 0) {
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    goto pool;
+  }
+
+  /* keep others from writing in between, but don't count as a writer:
+   * connection_wake_writers() would wait for us on the listener */
+  conn->c_writing = 1;
+  ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+  if (ber_flush2(conn->c_sb, ber, LBER_FLUSH_FREE_NEVER) == 0) {
+    conn->c_writing = 0;
+    ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ch_free(wp);
+    return;
+  }
+
+  err = sock_errno();
+  if (err != EWOULDBLOCK && err != EAGAIN) {
+    Debug(LDAP_DEBUG_CONNS, "ber_flush2 failed errno=%d reason=\"%s\"\n", err, sock_errstr(err));
+    conn->c_writing = 0;
+    ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+    ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+    connection_closing(conn, "connection lost on write");
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    ch_free(wp);
+    return;
+  }
+  wp->wp_owned = 1;
+  ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+
+pool:
+  Debug(LDAP_DEBUG_CONNS, "slap_write_inline_end: conn=%lu output left to the pool%s\n", wp->wp_connid,
+        wp->wp_owned ? " partly written" : "");
+  /* the buffer goes along, ber points into it */
+  wp->wp_buf = wb->wb_buf;
+  wb->wb_buf = NULL;
+  wb->wb_size = 0;
+  if (ldap_pvt_thread_pool_submit(&connection_pool, slap_write_inline_thread, wp) != 0) {
+    Debug(LDAP_DEBUG_ANY, "slap_write_inline_end: conn=%lu submit failed, closing\n", wp->wp_connid);
+    ldap_pvt_thread_mutex_lock(&conn->c_mutex);
+    if (wp->wp_owned) {
+      ldap_pvt_thread_mutex_lock(&conn->c_write1_mutex);
+      conn->c_writing = 0;
+      ldap_pvt_thread_cond_signal(&conn->c_write1_cv);
+      ldap_pvt_thread_mutex_unlock(&conn->c_write1_mutex);
+    }
+    if (conn->c_connid == wp->wp_connid)
+      connection_closing(conn, "output not sent");
+    ldap_pvt_thread_mutex_unlock(&conn->c_mutex);
+    ch_free_tag(wp->wp_buf);
+    ch_free(wp);
+  }
+}
+
+/* Writes out the output collected since slap_write_inline_begin(), as
+ * far as it goes without blocking; the rest, or all of it if another
+ * thread is writing on the connection, is left to connection_pool */
+void slap_write_inline_end(void *ctx) {
+  slap_write_batch *wb = slap_write_batch_get(ctx);
+
+  if (wb == NULL || !wb->wb_inline)
+    return;
+
+  ldap_pvt_thread_mutex_lock(&wb->wb_mutex);
+  slap_write_inline_send(wb);
+  ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+}
+
+static long send_ldap_ber(Operation *op, BerElement *ber, enum counters_send_update_mode crutch) {
+  slap_write_batch *wb = slap_write_batch_get(op->o_threadctx);
+  struct berval bv;
+  slap_time_t now;
+  long ret = -1;
+  int arm = 0;
+
+  if (wb == NULL || wb->wb_conn != op->o_conn || wb->wb_msgid != op->o_msgid || ber_flatten2(ber, &bv, 0) != 0)
+    goto direct;
+
+  ldap_pvt_thread_mutex_lock(&wb->wb_mutex);
+  if (slap_get_op_abandon(op) && !slap_get_op_cancel(op)) {
+    /* the rest of a partly written PDU must go out still */
+    if (wb->wb_partial)
+      slap_write_batch_flush(op, wb);
+    wb->wb_len = 0;
+    goto done;
+  }
+
+  if (wb->wb_inline) {
+    slap_write_batch_grow(wb, bv.bv_len);
+    memcpy(wb->wb_buf + wb->wb_len, bv.bv_val, bv.bv_len);
+    wb->wb_len += bv.bv_len;
+    send_ldap_ber__update_counters(op, bv.bv_len, crutch);
+    ret = bv.bv_len;
+    goto done;
+  }
+
+  if (wb->wb_partial && slap_write_batch_flush(op, wb) < 0)
+    goto done;
+  if (wb->wb_len + bv.bv_len > SLAP_WRITE_BATCH && slap_write_batch_flush(op, wb) < 0)
+    goto done;
+  if (bv.bv_len > SLAP_WRITE_BATCH || (wb->wb_len == 0 && crutch == crutch_ldap_response)) {
+    ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+    goto direct;
+  }
+
+  now = ldap_now_steady();
+  if (wb->wb_len == 0) {
+    slap_write_batch_grow(wb, SLAP_WRITE_BATCH);
+    wb->wb_since = now;
+    arm = 1;
+  }
+  memcpy(wb->wb_buf + wb->wb_len, bv.bv_val, bv.bv_len);
+  wb->wb_len += bv.bv_len;
+  send_ldap_ber__update_counters(op, bv.bv_len, crutch);
+
+  if (crutch == crutch_ldap_response || now.ns - wb->wb_since.ns >= SLAP_WRITE_BATCH_DELAY * (uint64_t)1000000) {
+    arm = 0;
+    if (slap_write_batch_flush(op, wb) < 0)
+      goto done;
+  }
+  ret = bv.bv_len;
+
+done:
+  ldap_pvt_thread_mutex_unlock(&wb->wb_mutex);
+  /* the next PDU may be long in coming */
+  if (arm)
+    slap_write_batch_arm();
+  return ret;
+
+direct:
+  return send_ldap_ber_flush(op, ber, &crutch);
+}
+
 static int send_ldap_control(BerElement *ber, LDAPControl *c) {
   int rc;
 
@@ -923,6 +1464,13 @@ void slap_send_ldap_intermediate(Operation *op, SlapReply *rs) {
     (rs)->sr_text = text;                                                                                              \
   } while (0)
 
+/* The room an entry takes in BER beyond what entry_partsize() counts,
+ * each header being a tag and at most five length octets: the SEQUENCE
+ * and SET OF around each attribute, and the message SEQUENCE, messageID,
+ * SearchResultEntry and attribute list around the whole, rounded up. */
+#define SLAP_BER_ATTR_HEADERS 16
+#define SLAP_BER_ENTRY_HEADERS 64
+
 /*
  * returns:
  *
@@ -1003,13 +1551,15 @@ int slap_send_search_entry(Operation *op, SlapReply *rs) {
     /* read back control or LDAP_CONNECTIONLESS */
     ber = op->o_res_ber;
   } else {
-    struct berval bv;
+    ber_len_t len;
+    int nattrs, nvals;
 
-    bv.bv_len = entry_flatsize(rs->sr_entry, 0);
-    bv.bv_val = op->o_tmpalloc(bv.bv_len, op->o_tmpmemctx);
-
-    ber_init2(ber, &bv, LBER_USE_DER);
-    ber_set_option(ber, LBER_OPT_BER_MEMCTX, &op->o_tmpmemctx);
+    /* Encode into a buffer from the per-thread BER pool rather than
+     * the operation's slab, so long searches don't exhaust the latter.
+     * Reserve the entry's size plus room for the sequence headers. */
+    entry_partsize(rs->sr_entry, &len, &nattrs, &nvals, 0);
+    ber_init2(ber, NULL, LBER_USE_DER);
+    ber_pvt_ber_reserve(ber, len + nattrs * SLAP_BER_ATTR_HEADERS + SLAP_BER_ENTRY_HEADERS);
   }
 
 #ifdef LDAP_CONNECTIONLESS
@@ -1061,7 +1611,8 @@ int slap_send_search_entry(Operation *op, SlapReply *rs) {
       e_flags = slap_sl_calloc(1, i * sizeof(char *) + k, op->o_tmpmemctx);
       if (e_flags == NULL) {
         Debug(LDAP_DEBUG_ANY, "send_search_entry: conn %lu slap_sl_calloc failed\n", op->o_connid);
-        ber_free(ber, 1);
+        if (op->o_res_ber == NULL)
+          ber_free_buf(ber);
 
         set_ldap_error(rs, LDAP_OTHER, "out of memory");
         goto error_return;
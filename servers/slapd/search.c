@@ -372,7 +372,10 @@ int fe_op_search(Operation *op, SlapReply *rs) {
   } else if (op->o_bd->be_search) {
     if (limits_check(op, rs) == 0) {
       /* actually do the search and send the result(s) */
+      int batch = slap_write_batch_begin(op);
       (op->o_bd->be_search)(op, rs);
+      if (batch)
+        slap_write_batch_end(op);
     }
     /* else limits_check() sends error */
 
@@ -18,10 +18,21 @@
 #include "reldap.h"
 
 #include <stdio.h>
+#include <ac/errno.h>
 #include <ac/string.h>
 
 #include "slap.h"
 
+#if defined(__linux__) && defined(HAVE_SCHED_H) && defined(HAVE_SYS_SYSCALL_H)
+#define SLAP_SL_PLACEMENT
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif /* __linux__ */
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+
 /* LY: With respect to http://en.wikipedia.org/wiki/Fail-fast */
 #if LDAP_MEMORY_DEBUG > 0
 #include <lber_hipagut.h>
@@ -81,7 +92,10 @@ struct slab_heap {
   void *sh_base;
   void *sh_last;
   void *sh_end;
+  ber_len_t sh_maplen; /* size of the arena as allocated, sh_end may stop short of it */
   int sh_stack;
+  int sh_mapped; /* sh_base was mmap()ed rather than malloc()ed */
+  int sh_node;   /* NUMA node of the owner thread, -1 if not bound */
   int sh_maxorder;
   unsigned char **sh_map;
   LDAP_LIST_HEAD(sh_freelist, slab_object) * sh_free;
@@ -96,6 +110,10 @@ enum {
 };
 
 static struct slab_object *slap_replenish_sopool(struct slab_heap *sh);
+static void *slap_sl_arena_alloc(struct slab_heap *sh, ber_len_t *sizep);
+static void slap_sl_arena_free(struct slab_heap *sh);
+static void slap_sl_numa_bind(struct slab_heap *sh);
+static void slap_sl_numa_unbind(struct slab_heap *sh);
 #ifdef SLAPD_UNUSED
 static void print_slheap(int level, void *ctx);
 #endif
@@ -155,7 +173,8 @@ void slap_sl_mem_destroy(void *key, void *data) {
   if (key != NULL) {
     ASAN_UNPOISON_MEMORY_REGION(sh->sh_base, (char *)sh->sh_end - (char *)sh->sh_base);
     VALGRIND_MAKE_MEM_UNDEFINED(sh->sh_base, (char *)sh->sh_end - (char *)sh->sh_base);
-    ber_memfree_x(sh->sh_base, NULL);
+    slap_sl_arena_free(sh);
+    slap_sl_numa_unbind(sh);
     VALGRIND_DESTROY_MEMPOOL(sh);
     ber_memfree_x(sh, NULL);
   }
@@ -163,8 +182,204 @@ void slap_sl_mem_destroy(void *key, void *data) {
 
 const BerMemoryFunctions slap_sl_mfuncs = {slap_sl_malloc, slap_sl_calloc, slap_sl_realloc, slap_sl_free};
 
+/*
+ * Placement of the per-thread slabs.
+ *
+ * With slab-hugepages the slabs are mmap()ed in 2M units, from the
+ * reserved huge page pool if possible, else advised for transparent huge
+ * pages.  With slab-numa each thread is pinned, when it creates its slab,
+ * to the CPUs of the next NUMA node round-robin, and its slab is placed on
+ * that node.  Both only affect slabs created after they are set.
+ */
+int slap_sl_hugepages;
+int slap_sl_numa;
+
+#define SLAP_SL_HUGEPAGE (2 * 1024 * 1024)
+
+static ldap_pvt_thread_mutex_t slap_sl_stats_mutex;
+static slap_sl_stats slap_sl_counters; /* protected by slap_sl_stats_mutex */
+
+#ifdef SLAP_SL_PLACEMENT
+#define SLAP_MPOL_PREFERRED 1 /* from <linux/mempolicy.h> */
+static int slap_sl_numa_ready;
+static int slap_sl_numa_next;
+static cpu_set_t slap_sl_node_cpus[SLAP_SL_MAXNODES];
+
+/* Parse a sysfs list such as "0-3,8-11", calling fn for each member */
+static int slap_sl_parse_list(const char *path, void (*fn)(int n, void *arg), void *arg) {
+  char buf[4096], *ptr, *next;
+  FILE *fp;
+  long lo, hi;
+
+  fp = fopen(path, "r");
+  if (fp == NULL)
+    return -1;
+  ptr = fgets(buf, sizeof(buf), fp);
+  fclose(fp);
+  if (ptr == NULL)
+    return -1;
+
+  while (*ptr && *ptr != '\n') {
+    lo = hi = strtol(ptr, &next, 10);
+    if (next == ptr)
+      return -1;
+    if (*next == '-')
+      hi = strtol(ptr = next + 1, &next, 10);
+    if (next == ptr || lo < 0 || hi < lo)
+      return -1;
+    for (; lo <= hi; lo++)
+      fn(lo, arg);
+    ptr = *next == ',' ? next + 1 : next;
+  }
+  return 0;
+}
+
+static void slap_sl_add_node(int n, void *arg) {
+  int *maxnode = arg;
+
+  if (n < SLAP_SL_MAXNODES && n >= *maxnode)
+    *maxnode = n + 1;
+}
+
+static void slap_sl_add_cpu(int n, void *arg) {
+  if (n < CPU_SETSIZE)
+    CPU_SET(n, (cpu_set_t *)arg);
+}
+
+/* called with slap_sl_stats_mutex locked */
+static void slap_sl_numa_init(void) {
+  char path[64];
+  int i, nodes = 0;
+
+  slap_sl_numa_ready = 1;
+  if (slap_sl_parse_list("/sys/devices/system/node/online", slap_sl_add_node, &nodes) || nodes < 1)
+    nodes = 1;
+  for (i = 0; i < nodes; i++) {
+    CPU_ZERO(&slap_sl_node_cpus[i]);
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", i);
+    slap_sl_parse_list(path, slap_sl_add_cpu, &slap_sl_node_cpus[i]);
+  }
+  slap_sl_counters.ss_nodes = nodes;
+}
+#endif /* SLAP_SL_PLACEMENT */
+
+/* Pin the calling thread to the next NUMA node, on its first slab */
+static void slap_sl_numa_bind(struct slab_heap *sh) {
+  sh->sh_node = -1;
+#ifdef SLAP_SL_PLACEMENT
+  int i;
+
+  if (!slap_sl_numa)
+    return;
+
+  ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+  if (!slap_sl_numa_ready)
+    slap_sl_numa_init();
+  /* skip memory-only nodes */
+  for (i = 0; i < slap_sl_counters.ss_nodes; i++) {
+    sh->sh_node = slap_sl_numa_next++ % slap_sl_counters.ss_nodes;
+    if (CPU_COUNT(&slap_sl_node_cpus[sh->sh_node]))
+      break;
+  }
+  slap_sl_counters.ss_node_threads[sh->sh_node]++;
+  ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
+
+  if (slap_sl_counters.ss_nodes > 1 && CPU_COUNT(&slap_sl_node_cpus[sh->sh_node]) &&
+      sched_setaffinity(0, sizeof(cpu_set_t), &slap_sl_node_cpus[sh->sh_node]) != 0) {
+    Debug(LDAP_DEBUG_ANY, "slap_sl_numa_bind: unable to bind thread to node %d, errno %d\n", sh->sh_node, errno);
+  }
+#endif /* SLAP_SL_PLACEMENT */
+}
+
+/* The owner thread is going away, forget it in the per-node counts */
+static void slap_sl_numa_unbind(struct slab_heap *sh) {
+#ifdef SLAP_SL_PLACEMENT
+  if (sh->sh_node < 0)
+    return;
+  ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+  slap_sl_counters.ss_node_threads[sh->sh_node]--;
+  ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
+  sh->sh_node = -1;
+#endif /* SLAP_SL_PLACEMENT */
+}
+
+/* Allocate the arena of a slab, updating *sizep to its usable size */
+static void *slap_sl_arena_alloc(struct slab_heap *sh, ber_len_t *sizep) {
+  sh->sh_mapped = 0;
+#ifdef SLAP_SL_PLACEMENT
+  if (slap_sl_hugepages) {
+    ber_len_t size = (*sizep + SLAP_SL_HUGEPAGE - 1) & ~(ber_len_t)(SLAP_SL_HUGEPAGE - 1);
+    unsigned long *counter = &slap_sl_counters.ss_hugetlb;
+    void *base = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (base == MAP_FAILED) {
+      counter = &slap_sl_counters.ss_fallback;
+      base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+      if (base != MAP_FAILED && madvise(base, size, MADV_HUGEPAGE) == 0)
+        counter = &slap_sl_counters.ss_thp;
+#endif
+    }
+    if (base != MAP_FAILED) {
+#ifdef SYS_mbind
+      if (sh->sh_node >= 0 && slap_sl_counters.ss_nodes > 1) {
+        unsigned long mask[SLAP_SL_MAXNODES / (8 * sizeof(unsigned long)) + 1] = {0};
+        mask[sh->sh_node / (8 * sizeof(unsigned long))] |= 1UL << (sh->sh_node % (8 * sizeof(unsigned long)));
+        (void)syscall(SYS_mbind, base, size, SLAP_MPOL_PREFERRED, mask, SLAP_SL_MAXNODES + 1, 0);
+      }
+#endif
+      ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+      (*counter)++;
+      ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
+      sh->sh_mapped = 1;
+      sh->sh_maplen = *sizep = size;
+      slap_mem_charge(SLAP_MEM_SLAB, size);
+      return base;
+    }
+    ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+    slap_sl_counters.ss_fallback++;
+    ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
+  }
+#endif /* SLAP_SL_PLACEMENT */
+  /* a malloc()ed arena is placed on first touch by the (pinned) owner */
+  sh->sh_maplen = *sizep;
+  slap_mem_charge(SLAP_MEM_SLAB, *sizep);
+  return ch_malloc(*sizep);
+}
+
+static void slap_sl_arena_free(struct slab_heap *sh) {
+  slap_mem_uncharge(SLAP_MEM_SLAB, sh->sh_maplen);
+#ifdef SLAP_SL_PLACEMENT
+  if (sh->sh_mapped) {
+    munmap(sh->sh_base, sh->sh_maplen);
+    return;
+  }
+#endif /* SLAP_SL_PLACEMENT */
+  ber_memfree_x(sh->sh_base, NULL);
+}
+
+void slap_sl_mem_stats(slap_sl_stats *ss) {
+#ifdef HAVE_SYS_RESOURCE_H
+  struct rusage ru;
+#endif
+
+  ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+  *ss = slap_sl_counters;
+  ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
+#ifdef HAVE_SYS_RESOURCE_H
+  if (getrusage(RUSAGE_SELF, &ru) == 0) {
+    ss->ss_minflt = ru.ru_minflt;
+    ss->ss_majflt = ru.ru_majflt;
+  }
+#endif
+}
+
 void slap_sl_mem_init() {
   assert(Align == 1 << Align_log2);
+  ldap_pvt_thread_mutex_init(&slap_sl_stats_mutex);
   ber_set_option(NULL, LBER_OPT_MEMORY_FNS, &slap_sl_mfuncs);
 }
 
@@ -187,17 +402,30 @@ void *slap_sl_mem_create(ber_len_t size, int stack, void *thrctx, int new) {
 
   if (!sh) {
     sh = ch_malloc(sizeof(struct slab_heap));
-    base = ch_malloc(size);
+    slap_sl_numa_bind(sh);
+    base = slap_sl_arena_alloc(sh, &size);
     SET_MEMCTX(thrctx, sh, slap_sl_mem_destroy);
     VALGRIND_CREATE_MEMPOOL(sh, 0, 0);
+    ldap_pvt_thread_mutex_lock(&slap_sl_stats_mutex);
+    slap_sl_counters.ss_slabs++;
+    ldap_pvt_thread_mutex_unlock(&slap_sl_stats_mutex);
   } else {
     slap_sl_mem_destroy(NULL, sh);
     base = sh->sh_base;
-    if (size > (ber_len_t)((char *)sh->sh_end - base)) {
-      newptr = ch_realloc(base, size);
-      if (newptr == NULL)
-        return NULL;
-      base = newptr;
+    if (size > sh->sh_maplen) {
+      if (sh->sh_mapped) {
+        /* the slab was just reset, nothing to copy */
+        slap_sl_arena_free(sh);
+        base = slap_sl_arena_alloc(sh, &size);
+      } else {
+        newptr = ch_realloc(base, size);
+        if (newptr == NULL)
+          return NULL;
+        slap_mem_uncharge(SLAP_MEM_SLAB, sh->sh_maplen);
+        slap_mem_charge(SLAP_MEM_SLAB, size);
+        sh->sh_maplen = size;
+        base = newptr;
+      }
     }
   }
   VALGRIND_MAKE_MEM_NOACCESS(base, size);
@@ -135,6 +135,16 @@ LDAP_BEGIN_DECL
 #define SLAP_CONN_MAX_PENDING_DEFAULT 100
 #define SLAP_CONN_MAX_PENDING_AUTH 1000
 
+#define SLAP_INLINE_BUDGET_DEFAULT 200 /* microseconds */
+
+/* listener-inline operations, run on the listener thread */
+#define SLAP_INLINE_ABANDON 0x0001U
+#define SLAP_INLINE_COMPARE 0x0002U
+#define SLAP_INLINE_SEARCH_BASE 0x0004U /* base-scope search */
+
+#define SLAP_ADMISSION_INTERVAL_DEFAULT 100 /* milliseconds */
+#define SLAP_ADMISSION_SHED_DEFAULT (1U << SLAP_OP_SEARCH)
+
 #define SLAP_TEXT_BUFLEN (256)
 
 /* pseudo error code indicating abandoned operation */
@@ -238,6 +248,8 @@ typedef struct slap_ssf_set {
 #define SLAP_INDEX_APPROX 0x0008UL
 #define SLAP_INDEX_SUBSTR 0x0010UL
 #define SLAP_INDEX_EXTENDED 0x0020UL
+#define SLAP_INDEX_ORDERED 0x0040UL /* order-preserving keys, see back-mdb */
+#define SLAP_INDEX_NGRAM 0x0080UL   /* unhashed n-gram keys, see back-mdb */
 
 #define SLAP_INDEX_DEFAULT SLAP_INDEX_EQUALITY
 
@@ -1155,6 +1167,36 @@ struct Entry {
   void *e_private;
 };
 
+/*
+ * counters of the Entry and Attribute free lists
+ */
+typedef struct slap_freelist_stats {
+  unsigned long fs_total;   /* structures carved from the heap */
+  unsigned long fs_free;    /* structures on the shared free list */
+  unsigned long fs_refills; /* batches moved into per-thread caches */
+  unsigned long fs_returns; /* batches given back by per-thread caches */
+} slap_freelist_stats;
+
+/*
+ * subsystems whose heap usage is accounted, see ch_malloc_tag()
+ */
+typedef enum slap_mem_tag {
+  SLAP_MEM_CONN = 0, /* connection write batches and handshakes */
+  SLAP_MEM_ENTRY,    /* chunks of the Entry and Attribute free lists */
+  SLAP_MEM_SLAB,     /* per-thread slab arenas */
+  SLAP_MEM_SYNCPROV, /* syncprov session log records */
+  SLAP_MEM_PCACHE,   /* pcache cached queries */
+  SLAP_MEM_SSSVLV,   /* sssvlv sort tree nodes */
+  SLAP_MEM_LAST
+} slap_mem_tag;
+
+typedef struct slap_mem_stats {
+  unsigned long ms_bytes;  /* currently allocated */
+  unsigned long ms_peak;   /* high watermark of ms_bytes */
+  unsigned long ms_allocs; /* allocations since startup */
+  unsigned long ms_frees;  /* deallocations since startup */
+} slap_mem_stats;
+
 /*
  * A list of LDAPMods
  * desc, values, nvalues, numvals must align with Attribute
@@ -1611,6 +1653,9 @@ struct slap_limits_set {
   int lms_s_pr;
   int lms_s_pr_hide;
   int lms_s_pr_total;
+
+  /* share of the thread pool, see weighted-queue */
+  int lms_weight;
 };
 
 /* Note: this is different from LDAP_NO_LIMIT (0); slapd internal use only */
@@ -2570,6 +2615,45 @@ typedef struct OpExtraDB {
   BackendDB *oe_db;
 } OpExtraDB;
 
+/*
+ * Server side sorting handed down to the database, so that one with an
+ * index in the requested order can send the entries in that order
+ * instead of the sort overlay collecting and sorting all of them.
+ * Attached to the search by the overlay, see slap_sorted_search().
+ */
+typedef struct SortedSearch {
+  OpExtra ss_oe;
+  Operation *ss_op; /* the search it was attached to */
+  void *ss_private; /* be_private of the database it is meant for */
+  AttributeDescription *ss_ad;
+  MatchingRule *ss_ordering;
+  int ss_reverse;
+
+  /* without VLV: go on after the entry ss_after of the previous page,
+   * which sorted by ss_after_val, or if that fails skip ss_offset
+   * entries, then send at most ss_size */
+  ID ss_after;                /* set to the last one sent */
+  struct berval ss_after_val; /* normalized, in o_tmpmemctx, null without the attribute */
+  int ss_offset;
+  int ss_size; /* 0 for all */
+
+  /* with VLV: the target is ss_vlv_offset of ss_vlv_count, or the first
+   * entry not before ss_vlv_value, sent with the entries around it */
+  int ss_vlv;
+  int ss_vlv_before;
+  int ss_vlv_after;
+  int ss_vlv_offset;
+  int ss_vlv_count;
+  struct berval ss_vlv_value; /* normalized */
+
+  /* set by the database */
+  int ss_served;   /* the entries are sent in order */
+  int ss_more;     /* more entries follow the ss_size ones */
+  int ss_nentries; /* VLV content count */
+  int ss_target;   /* VLV target position */
+  int ss_range;    /* VLV target out of range, nothing sent */
+} SortedSearch;
+
 struct Operation {
   Opheader *o_hdr;
 
@@ -2672,6 +2756,7 @@ struct Operation {
 #define get_no_schema_check(op) ((op)->o_no_schema_check)
   char o_no_subordinate_glue;
 #define get_no_subordinate_glue(op) ((op)->o_no_subordinate_glue)
+  char o_ctrls_parsed; /* a control parser may have filled o_controls[] */
 
 #define SLAP_CONTROL_NONE 0
 #define SLAP_CONTROL_IGNORED 1
@@ -2783,7 +2868,8 @@ struct Operation {
   void *o_private;                       /* anything the backend needs */
   LDAP_SLIST_HEAD(o_e, OpExtra) o_extra; /* anything the backend needs */
 
-  LDAP_STAILQ_ENTRY(Operation) o_next; /* next operation in list */
+  LDAP_STAILQ_ENTRY(Operation) o_next;       /* next operation in list */
+  LDAP_STAILQ_ENTRY(Operation) o_sched_next; /* next operation of the same identity */
 };
 
 #ifdef __SANITIZE_THREAD__
@@ -2921,10 +3007,12 @@ struct Connection {
 
   BerElement *c_currentber; /* ber we're attempting to read */
   int c_writers;            /* number of writers waiting */
+  int c_sched_weight;       /* weighted-queue weight of the identity, 0 if unknown */
   char c_writing;           /* someone is writing */
 
   char c_sasl_bind_in_progress; /* multi-op bind in progress */
   char c_writewaiter;           /* true if blocked on write */
+  char c_inline_slow;           /* an inline op overran listener-inline-budget */
   char c_gentle_kick;           /* connection is internal (e.g. syncrepl)
                                  * and should be kicked/closed on gentle-shutdown. */
 
@@ -3012,6 +3100,8 @@ struct Listener {
   int sl_mute; /* Listener is temporarily disabled due to emfile */
   int sl_busy; /* Listener is busy (accept thread activated) */
   ber_socket_t sl_sd;
+  ber_socket_t *sl_shards; /* spare SO_REUSEPORT sockets on the same address */
+  int sl_nshards;
   Sockaddr sl_sa;
 #define sl_addr sl_sa.sa_in_addr
 #define LDAP_TCP_BUFFER
@@ -3063,6 +3153,19 @@ typedef int (*SLAP_ENTRY_INFO_FN)(void *arg, Entry *e);
 #define SLAP_SLAB_SIZE (1024 * 1024)
 #define SLAP_SLAB_STACK 1
 
+/* placement counters of the per-thread slabs, see sl_malloc.c */
+#define SLAP_SL_MAXNODES 64
+typedef struct slap_sl_stats {
+  unsigned long ss_slabs;    /* thread slabs created */
+  unsigned long ss_hugetlb;  /* slabs on reserved huge pages */
+  unsigned long ss_thp;      /* slabs advised for transparent huge pages */
+  unsigned long ss_fallback; /* slabs wanting huge pages, left on small ones */
+  int ss_nodes;              /* NUMA nodes threads are spread over */
+  unsigned long ss_node_threads[SLAP_SL_MAXNODES];
+  long ss_minflt; /* page faults of the whole process */
+  long ss_majflt;
+} slap_sl_stats;
+
 #ifdef LDAP_COMP_MATCH
 /*
  * Extensible Filter Definition
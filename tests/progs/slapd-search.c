@@ -57,6 +57,7 @@ static void usage(char *name, char opt) {
           "-f <searchfilter> "
           "[-a <attr>] "
           "[-A] "
+          "[-c] "
           "[-F] "
           "[-N] "
           "[-S[S[S]]] "
@@ -66,6 +67,9 @@ static void usage(char *name, char opt) {
   exit(EXIT_FAILURE);
 }
 
+/* -c: abandon every request right after sending it */
+static int abandon;
+
 /* -S: just send requests without reading responses
  * -SS: send all requests asynchronous and immediately start reading responses
  * -SSS: send all requests asynchronous; then read responses
@@ -90,7 +94,7 @@ int main(int argc, char **argv) {
   /* by default, tolerate referrals and no such object */
   tester_ignore_str2errlist("REFERRAL,NO_SUCH_OBJECT");
 
-  while ((i = getopt(argc, argv, TESTER_COMMON_OPTS "Aa:b:f:FNSs:T:")) != EOF) {
+  while ((i = getopt(argc, argv, TESTER_COMMON_OPTS "Aa:b:cf:FNSs:T:")) != EOF) {
     switch (i) {
     case 'A':
       noattrs++;
@@ -108,6 +112,10 @@ int main(int argc, char **argv) {
       sbase = strdup(optarg);
       break;
 
+    case 'c':
+      abandon++;
+      break;
+
     case 'f': /* the search request */
       filter = strdup(optarg);
       break;
@@ -395,6 +403,22 @@ retry:;
           break;
       }
 
+      if (abandon) {
+        int msgid;
+        rc = ldap_search_ext(ld, sbase, scope, filter, attrs, noattrs, NULL, NULL, NULL, LDAP_NO_LIMIT, &msgid);
+        if (rc == LDAP_SUCCESS) {
+          /* give the server a chance to read the abandon on its own,
+           * not together with the next request or the unbind */
+          sleep(1);
+          rc = ldap_abandon_ext(ld, msgid, NULL, NULL);
+          sleep(1);
+        }
+        if (rc == LDAP_SUCCESS)
+          continue;
+        tester_ldap_error(ld, "ldap_abandon_ext", NULL);
+        break;
+      }
+
       rc = ldap_search_ext_s(ld, sbase, scope, filter, attrs, noattrs, NULL, NULL, NULL, LDAP_NO_LIMIT, &res);
       if (res != NULL) {
         ldap_msgfree(res);
@@ -195,12 +195,15 @@ P3SRSLAVECONF=$DATADIR/slapd-syncrepl-slave-persist3.conf
 REFSLAVECONF=$DATADIR/slapd-ref-slave.conf
 SCHEMACONF=$DATADIR/slapd-schema.conf
 TLSCONF=$DATADIR/slapd-tls.conf
+TLSTUNINGCONF=$DATADIR/slapd-tls-tuning.conf
 TLSSASLCONF=$DATADIR/slapd-tls-sasl.conf
 GLUECONF=$DATADIR/slapd-glue.conf
 REFINTCONF=$DATADIR/slapd-refint.conf
 RETCODECONF=$DATADIR/slapd-retcode.conf
 UNIQUECONF=$DATADIR/slapd-unique.conf
 LIMITSCONF=$DATADIR/slapd-limits.conf
+SCHEDCONF=$DATADIR/slapd-sched.conf
+MDBCONF=$DATADIR/slapd-mdb.conf
 DNCONF=$DATADIR/slapd-dn.conf
 EMPTYDNCONF=$DATADIR/slapd-emptydn.conf
 IDASSERTCONF=$DATADIR/slapd-idassert.conf
@@ -880,6 +883,7 @@ function config_filter {
 		-e "s/^#refint=${AC_conf[refint]}#//g"		\
 		-e "s/^#retcode=${AC_conf[retcode]}#//g"	\
 		-e "s/^#rwm=${AC_conf[rwm]}#//g"		\
+		-e "s/^#sssvlv=${AC_conf[sssvlv]}#//g"		\
 		-e "s/^#syncprov=${AC_conf[syncprov]}#//g"	\
 		-e "s/^#translucent=${AC_conf[translucent]}#//g"\
 		-e "s/^#unique=${AC_conf[unique]}#//g"		\
@@ -927,6 +931,120 @@ function config_filter {
 		-e "s;@SCHEMADIR@;${SCHEMADIR};g"
 }
 
+# config_features <tag> [feature...]
+#	enables the lines of stdin tagged #<tag>=<feature>#
+function config_features {
+	local tag=$1 features
+	shift
+	features="$*"
+
+	sed -e "s/^#${tag}=\(${features// /\\|}\)#//"
+}
+
+# mdb_config [feature...]
+#	$MDBCONF with the lines tagged #mdb=<feature># enabled
+function mdb_config {
+	config_filter $BACKEND ${AC_conf[monitor]} < $MDBCONF | config_features mdb "$@"
+}
+
+# sched_config [feature...]
+#	$SCHEDCONF with the lines tagged #sched=<feature># enabled
+function sched_config {
+	config_filter $BACKEND ${AC_conf[monitor]} < $SCHEDCONF | config_features sched "$@"
+}
+
+# mdb_ordered_ldif <output>
+#	$LDIFORDERED with modifyTimestamps spread over some days, so that
+#	ranges select some of the entries
+function mdb_ordered_ldif {
+	awk 'function stamp() { n++; printf "modifyTimestamp: 201801%02d%02d0000Z\n", n * 5 % 28 + 1, n * 7 % 24 }
+		/^$/ { if (dn) stamp(); dn = 0 }
+		/^dn:/ { dn = 1 }
+		{ print }
+		END { if (dn) stamp() }' $LDIFORDERED > $1
+}
+
+# mdb_search_filters <output> [attrs...]
+#	appends a subtree search of $BASEDN for each line of $FILTERS
+function mdb_search_filters {
+	local output=$1 FILTER RC
+	shift
+
+	while read FILTER ; do
+		echo "# $FILTER $*" >> $output
+		$LDAPSEARCH -S "" -b "$BASEDN" -h $LOCALHOST -p $PORT1 \
+			"$FILTER" "$@" >> $output 2>&1
+		RC=$?
+		if test $RC != 0 ; then
+			echo "ldapsearch \"$FILTER\" failed ($RC)!"
+			return $RC
+		fi
+	done <<< "$FILTERS"
+}
+
+# mdb_compare_runs <feature> <trace> <command> [args...]
+#	runs "command <output> args..." against slapd with the feature
+#	enabled, then against the same database with it disabled, and
+#	compares the outputs. The first run must have logged the trace.
+#	The features in $MDBBASELINE are enabled in both runs, the debug
+#	levels in $MDBLEVEL are added to the first one.
+function mdb_compare_runs {
+	local feature=$1 trace=$2 RC
+	shift 2
+
+	echo "Starting slapd with $feature on TCP/IP port $PORT1..."
+	mdb_config $MDBBASELINE $feature > $CONF1
+	$SLAPD -f $CONF1 -h $URI1 -d $LVL,trace${MDBLEVEL:+,$MDBLEVEL} $TIMING > $LOG1 2>&1 &
+	PID=$!
+	if test $WAIT != 0 ; then
+		echo PID $PID
+		read foo
+	fi
+	KILLPIDS="$PID"
+	check_running 1
+
+	echo "Searching with $feature..."
+	cat /dev/null > $SEARCHOUT
+	"$1" $SEARCHOUT "${@:2}"
+	RC=$?
+	killservers
+	if test $RC != 0 ; then
+		return $RC
+	fi
+
+	if test -n "$trace" && ! grep -q "$trace" $LOG1 ; then
+		echo "slapd did not use $feature"
+		return 1
+	fi
+
+	echo "Starting slapd without $feature on TCP/IP port $PORT1..."
+	mdb_config $MDBBASELINE > $CONF2
+	$SLAPD -f $CONF2 -h $URI1 $TIMING > $LOG2 2>&1 &
+	PID=$!
+	if test $WAIT != 0 ; then
+		echo PID $PID
+		read foo
+	fi
+	KILLPIDS="$PID"
+	check_running 1
+
+	echo "Searching the same without $feature..."
+	cat /dev/null > $SEARCHOUT2
+	"$1" $SEARCHOUT2 "${@:2}"
+	RC=$?
+	killservers
+	if test $RC != 0 ; then
+		return $RC
+	fi
+
+	echo "Comparing the results with $feature and without..."
+	$CMP $SEARCHOUT $SEARCHOUT2 > $CMPOUT
+	if test $? != 0 ; then
+		echo "Comparison failed"
+		return 1
+	fi
+}
+
 function monitor_data {
 	[ $# = 2 ] || failure "monitor_data srcdir dstdir"
 